@@ -0,0 +1,548 @@
+//
+//  AsyncFileIO.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of AsyncLoader / AsyncWriter.
+//   - io_uring backend: one I/O thread opens each file, queues an
+//     IORING_OP_READ for the whole file and reaps completions in batches;
+//     short reads are resubmitted for the remainder.
+//   - Thread backend: a few reader threads call FileManipulation::LoadFileInto.
+//   - Both backends share the credit counter (bounded in-flight buffers) and
+//     the ready queue that parse workers pop from.
+//
+
+#include "AsyncFileIO.hpp"
+
+#include "FileManipulation.hpp"
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define SAVEGENIE_HAVE_IO_URING 1
+#include <atomic>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define SAVEGENIE_HAVE_IO_URING 0
+#endif
+
+namespace savegenie {
+
+namespace {
+
+// Reader threads for the thread backend (bounded by depth).
+constexpr std::size_t kReaderThreads = 4;
+
+// Largest ring we ask for; deeper queues just wait for credits.
+constexpr unsigned kMaxRingEntries = 4096;
+
+} // namespace
+
+// =========================================================
+// Ring (io_uring, raw syscalls)
+// =========================================================
+
+#if SAVEGENIE_HAVE_IO_URING
+
+class AsyncLoader::Ring {
+public:
+    // nullptr if the kernel lacks io_uring or refuses it (ENOSYS, EPERM under
+    // seccomp, ...).
+    static std::unique_ptr<Ring> Create(unsigned entries) {
+        io_uring_params p{};
+        const int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &p));
+        if (fd < 0) return nullptr;
+
+        std::unique_ptr<Ring> ring(new Ring());
+        ring->fd_ = fd;
+
+        ring->sqSize_ = p.sq_off.array + p.sq_entries * sizeof(std::uint32_t);
+        ring->cqSize_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        const bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) ring->sqSize_ = ring->cqSize_ = std::max(ring->sqSize_, ring->cqSize_);
+
+        ring->sq_ = ::mmap(nullptr, ring->sqSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                           IORING_OFF_SQ_RING);
+        if (ring->sq_ == MAP_FAILED) {
+            ring->sq_ = nullptr;
+            return nullptr;
+        }
+        if (single) {
+            ring->cq_ = ring->sq_;
+        } else {
+            ring->cq_ = ::mmap(nullptr, ring->cqSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                               IORING_OFF_CQ_RING);
+            if (ring->cq_ == MAP_FAILED) {
+                ring->cq_ = nullptr;
+                return nullptr;
+            }
+        }
+        ring->sqesSize_ = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, ring->sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                            IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return nullptr;
+        ring->sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<std::uint8_t*>(ring->sq_);
+        auto* cq = static_cast<std::uint8_t*>(ring->cq_);
+        ring->sqTail_ = reinterpret_cast<std::uint32_t*>(sq + p.sq_off.tail);
+        ring->sqMask_ = *reinterpret_cast<std::uint32_t*>(sq + p.sq_off.ring_mask);
+        ring->sqArray_ = reinterpret_cast<std::uint32_t*>(sq + p.sq_off.array);
+        ring->cqHead_ = reinterpret_cast<std::uint32_t*>(cq + p.cq_off.head);
+        ring->cqTail_ = reinterpret_cast<std::uint32_t*>(cq + p.cq_off.tail);
+        ring->cqMask_ = *reinterpret_cast<std::uint32_t*>(cq + p.cq_off.ring_mask);
+        ring->cqes_ = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+        ring->entries_ = p.sq_entries;
+        return ring;
+    }
+
+    ~Ring() {
+        if (sqes_) ::munmap(sqes_, sqesSize_);
+        if (cq_ && cq_ != sq_) ::munmap(cq_, cqSize_);
+        if (sq_) ::munmap(sq_, sqSize_);
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    unsigned Entries() const { return entries_; }
+
+    // Queue a read (not submitted until Enter). The caller keeps at most
+    // Entries() requests outstanding, so the SQ cannot overflow.
+    void PrepRead(int fd, std::uint8_t* buf, std::size_t len, std::uint64_t off, std::uint64_t userData) {
+        const std::uint32_t tail = *sqTail_; // only this thread writes the tail
+        const std::uint32_t idx = tail & sqMask_;
+        io_uring_sqe& sqe = sqes_[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(buf);
+        sqe.len = static_cast<std::uint32_t>(std::min<std::size_t>(len, 1u << 30));
+        sqe.off = off;
+        sqe.user_data = userData;
+        sqArray_[idx] = idx;
+        std::atomic_ref<std::uint32_t>(*sqTail_).store(tail + 1, std::memory_order_release);
+        ++unsubmitted_;
+    }
+
+    // Submit everything queued and wait for at least `minComplete` completions.
+    // Returns false on a ring error (the caller then gives up on the ring).
+    bool Enter(unsigned minComplete) {
+        for (;;) {
+            const long n = ::syscall(__NR_io_uring_enter, fd_, unsubmitted_, minComplete,
+                                     minComplete ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+            if (n >= 0) {
+                unsubmitted_ -= std::min<unsigned>(unsubmitted_, static_cast<unsigned>(n));
+                return true;
+            }
+            if (errno == EINTR) continue;
+            // EAGAIN / EBUSY: the kernel wants completions reaped first.
+            return errno == EAGAIN || errno == EBUSY;
+        }
+    }
+
+    // Call fn(userData, res) for every available completion.
+    template <typename Fn>
+    void Drain(Fn&& fn) {
+        std::uint32_t head = *cqHead_;
+        const std::uint32_t tail = std::atomic_ref<std::uint32_t>(*cqTail_).load(std::memory_order_acquire);
+        while (head != tail) {
+            const io_uring_cqe& cqe = cqes_[head & cqMask_];
+            const std::uint64_t userData = cqe.user_data;
+            const int res = cqe.res;
+            ++head;
+            std::atomic_ref<std::uint32_t>(*cqHead_).store(head, std::memory_order_release);
+            fn(userData, res);
+        }
+    }
+
+private:
+    Ring() = default;
+
+    int fd_ = -1;
+    void* sq_ = nullptr;
+    void* cq_ = nullptr;
+    std::size_t sqSize_ = 0;
+    std::size_t cqSize_ = 0;
+    std::size_t sqesSize_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    std::uint32_t* sqTail_ = nullptr;
+    std::uint32_t sqMask_ = 0;
+    std::uint32_t* sqArray_ = nullptr;
+    std::uint32_t* cqHead_ = nullptr;
+    std::uint32_t* cqTail_ = nullptr;
+    std::uint32_t cqMask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+    unsigned entries_ = 0;
+    unsigned unsubmitted_ = 0;
+};
+
+#else
+
+class AsyncLoader::Ring {
+public:
+    static std::unique_ptr<Ring> Create(unsigned) { return nullptr; }
+};
+
+#endif
+
+// =========================================================
+// AsyncLoader
+// =========================================================
+
+AsyncLoader::AsyncLoader(const std::vector<std::string>& paths, std::size_t depth, IoBackend backend)
+: paths_(paths), depth_(std::max<std::size_t>(depth, 1)), credits_(depth_) {
+    if (backend != IoBackend::Threads) {
+        ring_ = Ring::Create(static_cast<unsigned>(std::min<std::size_t>(depth_, kMaxRingEntries)));
+    }
+    backend_ = ring_ ? IoBackend::IoUring : IoBackend::Threads;
+
+    if (paths_.empty()) return;
+    if (ring_) {
+        readersLeft_ = 1;
+        threads_.emplace_back([this] { RunUringReader(); });
+    } else {
+        const std::size_t n = std::min({kReaderThreads, depth_, paths_.size()});
+        readersLeft_ = n;
+        for (std::size_t t = 0; t < n; ++t) threads_.emplace_back([this] { RunThreadReader(); });
+    }
+}
+
+AsyncLoader::~AsyncLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        stop_ = true;
+    }
+    creditCv_.notify_all();
+    for (std::thread& t : threads_) t.join();
+}
+
+bool AsyncLoader::Next(LoadedFile& out) {
+    std::unique_lock<std::mutex> lock(mu_);
+    readyCv_.wait(lock, [&] { return !ready_.empty() || delivered_ == paths_.size() || readersLeft_ == 0; });
+    if (ready_.empty()) return false;
+    out = std::move(ready_.front());
+    ready_.pop_front();
+    ++delivered_;
+    if (delivered_ == paths_.size()) readyCv_.notify_all();
+    return true;
+}
+
+void AsyncLoader::Recycle(LoadedFile&& done) {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (done.bytes.capacity() != 0) spare_.push_back(std::move(done.bytes));
+        ++credits_;
+    }
+    creditCv_.notify_one();
+}
+
+bool AsyncLoader::AcquireCredit(bool wait) {
+    std::unique_lock<std::mutex> lock(mu_);
+    if (wait) creditCv_.wait(lock, [&] { return credits_ > 0 || stop_; });
+    if (stop_ || credits_ == 0) return false;
+    --credits_;
+    return true;
+}
+
+std::vector<std::uint8_t> AsyncLoader::TakeBuffer() {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (spare_.empty()) return {};
+    std::vector<std::uint8_t> buf = std::move(spare_.back());
+    spare_.pop_back();
+    return buf;
+}
+
+void AsyncLoader::Complete(LoadedFile&& file) {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        ready_.push_back(std::move(file));
+    }
+    readyCv_.notify_one();
+}
+
+void AsyncLoader::ReaderExited() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        --readersLeft_;
+    }
+    readyCv_.notify_all();
+}
+
+void AsyncLoader::RunThreadReader() {
+    while (AcquireCredit(true)) {
+        std::size_t i = 0;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (nextPath_ >= paths_.size()) {
+                ++credits_; // hand it back for the other readers to notice the end
+                break;
+            }
+            i = nextPath_++;
+        }
+
+        LoadedFile file;
+        file.index = i;
+        file.bytes = TakeBuffer();
+        try {
+            FileManipulation::LoadFileInto(paths_[i], file.bytes);
+        } catch (const std::exception& e) {
+            file.bytes.clear();
+            file.error = e.what();
+        }
+        Complete(std::move(file));
+    }
+    creditCv_.notify_all();
+    ReaderExited();
+}
+
+#if SAVEGENIE_HAVE_IO_URING
+
+namespace {
+
+// One read in flight on the ring.
+struct PendingRead {
+    LoadedFile file;
+    int fd = -1;
+    std::size_t done = 0; // bytes read so far
+};
+
+std::string ReadError(const std::string& path, int err) {
+    return "LoadFile failed: read error for file: " + path + " (" + std::strerror(err) + ")";
+}
+
+// Blocking fallback for one file (a kernel without IORING_OP_READ rejects it with EINVAL).
+bool PreadRest(PendingRead& r) {
+    while (r.done < r.file.bytes.size()) {
+        const ssize_t n = ::pread(r.fd, r.file.bytes.data() + r.done, r.file.bytes.size() - r.done,
+                                  static_cast<off_t>(r.done));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return n == 0;
+        r.done += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+void AsyncLoader::RunUringReader() {
+    Ring& ring = *ring_;
+    std::vector<PendingRead> slots(ring.Entries());
+    std::vector<std::uint32_t> freeSlots;
+    freeSlots.reserve(slots.size());
+    for (std::uint32_t s = static_cast<std::uint32_t>(slots.size()); s-- > 0;) freeSlots.push_back(s);
+
+    std::size_t next = 0;
+    std::size_t inflight = 0;
+    bool ringFailed = false;
+
+    const auto finish = [&](std::uint32_t s, std::string error) {
+        PendingRead& r = slots[s];
+        ::close(r.fd);
+        r.fd = -1;
+        if (error.empty()) {
+            r.file.bytes.resize(r.done); // shorter if the file shrank since fstat
+            SAVEGENIE_COUNT(BytesRead, r.done);
+        } else {
+            r.file.bytes.clear();
+            r.file.error = std::move(error);
+        }
+        Complete(std::move(r.file));
+        r.file = LoadedFile();
+        freeSlots.push_back(s);
+        --inflight;
+    };
+
+    const auto submitRest = [&](std::uint32_t s) {
+        PendingRead& r = slots[s];
+        ring.PrepRead(r.fd, r.file.bytes.data() + r.done, r.file.bytes.size() - r.done, r.done, s);
+    };
+
+    for (;;) {
+        // Start reads while there are credits and ring slots. Only block for a
+        // credit when nothing is in flight (otherwise reap first).
+        while (next < paths_.size() && !freeSlots.empty() && AcquireCredit(inflight == 0)) {
+            const std::size_t i = next++;
+            LoadedFile file;
+            file.index = i;
+
+            const int fd = ::open(paths_[i].c_str(), O_RDONLY | O_CLOEXEC);
+            struct stat st {};
+            if (fd < 0 || ::fstat(fd, &st) != 0 || st.st_size < 0) {
+                const int err = errno;
+                if (fd >= 0) ::close(fd);
+                file.error = (fd < 0 ? "LoadFile failed: could not open input file: "
+                                     : "LoadFile failed: could not determine file size: ") +
+                             paths_[i] + " (" + std::strerror(err) + ")";
+                Complete(std::move(file));
+                continue;
+            }
+
+            file.bytes = TakeBuffer();
+            file.bytes.resize(static_cast<std::size_t>(st.st_size));
+            if (file.bytes.empty()) {
+                ::close(fd);
+                Complete(std::move(file));
+                continue;
+            }
+
+            const std::uint32_t s = freeSlots.back();
+            freeSlots.pop_back();
+            slots[s].file = std::move(file);
+            slots[s].fd = fd;
+            slots[s].done = 0;
+            ++inflight;
+            submitRest(s);
+        }
+
+        if (inflight == 0) break;
+
+        if (!ring.Enter(1)) {
+            // The ring broke mid-run. Tear it down first so no new reads start,
+            // then finish what was in flight synchronously and leave the
+            // remaining paths to a thread reader. Closing the ring does not
+            // wait for reads the kernel already took, so their buffers are
+            // abandoned (deliberately leaked, never reused) and each file is
+            // read again from the start into a fresh one.
+            ringFailed = true;
+            ring_.reset();
+            for (std::uint32_t s = 0; s < slots.size(); ++s) {
+                PendingRead& r = slots[s];
+                if (r.fd < 0) continue;
+                const std::size_t size = r.file.bytes.size();
+                static_cast<void>(new std::vector<std::uint8_t>(std::move(r.file.bytes)));
+                r.file.bytes.assign(size, 0);
+                r.done = 0;
+                const bool ok = PreadRest(r);
+                finish(s, ok ? std::string() : ReadError(paths_[r.file.index], errno));
+            }
+            break;
+        }
+
+        ring.Drain([&](std::uint64_t userData, int res) {
+            const std::uint32_t s = static_cast<std::uint32_t>(userData);
+            PendingRead& r = slots[s];
+            if (res == -EINTR || res == -EAGAIN) {
+                submitRest(s);
+            } else if (res == -EINVAL || res == -EOPNOTSUPP) {
+                const bool ok = PreadRest(r);
+                finish(s, ok ? std::string() : ReadError(paths_[r.file.index], errno));
+            } else if (res < 0) {
+                finish(s, ReadError(paths_[r.file.index], -res));
+            } else if (res == 0) {
+                finish(s, std::string()); // EOF early: keep what was read
+            } else {
+                r.done += static_cast<std::size_t>(res);
+                if (r.done < r.file.bytes.size()) {
+                    submitRest(s);
+                } else {
+                    finish(s, std::string());
+                }
+            }
+        });
+    }
+
+    if (ringFailed) {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            nextPath_ = next;
+        }
+        RunThreadReader();
+        return;
+    }
+    ReaderExited();
+}
+
+#else
+
+void AsyncLoader::RunUringReader() {
+    RunThreadReader();
+}
+
+#endif
+
+const char* AsyncLoader::BackendName(IoBackend backend) {
+    switch (backend) {
+        case IoBackend::Auto:    return "auto";
+        case IoBackend::IoUring: return "io_uring";
+        case IoBackend::Threads: return "threads";
+    }
+    return "unknown";
+}
+
+std::optional<IoBackend> AsyncLoader::ParseBackend(std::string_view name) {
+    if (name == "auto") return IoBackend::Auto;
+    if (name == "io_uring" || name == "uring") return IoBackend::IoUring;
+    if (name == "threads") return IoBackend::Threads;
+    return std::nullopt;
+}
+
+// =========================================================
+// AsyncWriter
+// =========================================================
+
+AsyncWriter::AsyncWriter(std::size_t depth, unsigned threads) : depth_(std::max<std::size_t>(depth, 1)) {
+    threads = std::max(threads, 1u);
+    threads_.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) threads_.emplace_back([this] { RunWorker(); });
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        closing_ = true;
+    }
+    workCv_.notify_all();
+    for (std::thread& t : threads_) t.join();
+}
+
+WriteTicket AsyncWriter::Submit(Mode mode, std::string path, std::vector<std::uint8_t> bytes) {
+    Job job;
+    job.mode = mode;
+    job.path = std::move(path);
+    job.bytes = std::move(bytes);
+    WriteTicket ticket = job.done.get_future();
+    {
+        std::unique_lock<std::mutex> lock(mu_);
+        spaceCv_.wait(lock, [&] { return jobs_.size() < depth_; });
+        jobs_.push_back(std::move(job));
+    }
+    workCv_.notify_one();
+    return ticket;
+}
+
+void AsyncWriter::RunWorker() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mu_);
+            workCv_.wait(lock, [&] { return !jobs_.empty() || closing_; });
+            if (jobs_.empty()) return; // closing, and everything queued is done
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        spaceCv_.notify_one();
+
+        try {
+            if (job.mode == Mode::Backup) {
+                FileManipulation::BackupFromBytes(job.path, job.bytes);
+            } else {
+                FileManipulation::WriteFile(job.path, job.bytes);
+            }
+            job.done.set_value();
+        } catch (...) {
+            job.done.set_exception(std::current_exception());
+        }
+    }
+}
+
+} // namespace savegenie
@@ -0,0 +1,693 @@
+//
+//  BatchScanner.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of BatchScanner (corpus mode).
+//   - Workers fill result slots; the calling thread drains them in index order.
+//
+
+#include "BatchScanner.hpp"
+
+#include "AsyncFileIO.hpp"
+#include "ContentHash.hpp"
+#include "FileManipulation.hpp"
+#include "ReadOnlyData.hpp"
+#include "ResultCache.hpp"
+#include "SaveGenerator.hpp"
+#include "SaveQuery.hpp"
+#include "SaveStream.hpp"
+#include "SaveStructure.hpp"
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace savegenie {
+
+// =========================================================
+// BatchStats
+// =========================================================
+
+double BatchStats::FilesPerSecond() const {
+    return seconds > 0.0 ? static_cast<double>(filesTotal) / seconds : 0.0;
+}
+
+std::string BatchStats::ToString() const {
+    std::ostringstream oss;
+    oss << "Scanned " << filesTotal << " file(s)"
+        << " (" << filesFailed << " failed)"
+        << " on " << threads << " thread(s) in "
+        << std::fixed << std::setprecision(3) << seconds << "s"
+        << " -> " << std::setprecision(1) << FilesPerSecond() << " files/sec";
+    if (cacheEnabled) {
+        oss << " (cache: " << cacheHits << " hit, " << cacheMisses << " miss)";
+    }
+    if (!ioBackend.empty()) {
+        oss << " (io: " << ioBackend << ")";
+    }
+    if (queryEnabled) {
+        oss << " (query: " << filesMatched << " matched)";
+    }
+    return oss.str();
+}
+
+// =========================================================
+// Input expansion
+// =========================================================
+
+static bool HasSaveExtension(const std::filesystem::path& p) {
+    std::string ext = p.extension().string();
+    for (char& c : ext) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return ext == ".sav";
+}
+
+static bool IsGeneratedCopy(const std::string& filename) {
+    // Outputs of FileManipulation::MakeBackupPath / MakeEditedPath.
+    return filename.rfind("(BACKUP) ", 0) == 0 || filename.rfind("(EDITED) ", 0) == 0;
+}
+
+static bool HasWildcard(const std::string& s) {
+    return s.find_first_of("*?") != std::string::npos;
+}
+
+bool BatchScanner::WildcardMatch(const std::string& pattern, const std::string& text) {
+    // Iterative matcher with single-star backtracking.
+    std::size_t p = 0, t = 0;
+    std::size_t starP = std::string::npos, starT = 0;
+
+    while (t < text.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t])) {
+            ++p;
+            ++t;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            starP = p++;
+            starT = t;
+        } else if (starP != std::string::npos) {
+            p = starP + 1;
+            t = ++starT;
+        } else {
+            return false;
+        }
+    }
+
+    while (p < pattern.size() && pattern[p] == '*') ++p;
+    return p == pattern.size();
+}
+
+std::vector<std::string> BatchScanner::CollectInputs(const std::vector<std::string>& inputs, bool recursive) {
+    namespace fs = std::filesystem;
+
+    std::vector<std::string> out;
+
+    auto addDirectory = [&](const fs::path& dir) {
+        auto visit = [&](const fs::directory_entry& e) {
+            if (!e.is_regular_file()) return;
+            const fs::path& p = e.path();
+            if (!HasSaveExtension(p) || IsGeneratedCopy(p.filename().string())) return;
+            out.push_back(p.string());
+        };
+
+        if (recursive) {
+            for (const auto& e : fs::recursive_directory_iterator(dir, fs::directory_options::skip_permission_denied)) visit(e);
+        } else {
+            for (const auto& e : fs::directory_iterator(dir, fs::directory_options::skip_permission_denied)) visit(e);
+        }
+    };
+
+    for (const std::string& in : inputs) {
+        const fs::path p(in);
+
+        if (HasWildcard(p.filename().string())) {
+            // Glob: wildcard in the filename part only; the directory part is literal.
+            const fs::path dir = p.parent_path().empty() ? fs::path(".") : p.parent_path();
+            const std::string pattern = p.filename().string();
+
+            std::error_code ec;
+            if (!fs::is_directory(dir, ec)) {
+                throw std::runtime_error("Batch input directory not found: " + dir.string());
+            }
+            for (const auto& e : fs::directory_iterator(dir, fs::directory_options::skip_permission_denied)) {
+                if (!e.is_regular_file()) continue;
+                if (WildcardMatch(pattern, e.path().filename().string())) {
+                    out.push_back(e.path().string());
+                }
+            }
+            continue;
+        }
+
+        std::error_code ec;
+        if (fs::is_directory(p, ec)) {
+            addDirectory(p);
+        } else if (fs::is_regular_file(p, ec)) {
+            // Explicit files are taken as-is (no extension filter).
+            out.push_back(p.string());
+        } else {
+            throw std::runtime_error("Batch input not found: " + in);
+        }
+    }
+
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+// =========================================================
+// Run
+// =========================================================
+
+namespace {
+
+// Per-worker scratch: the buffer is reloaded in place, so the reader's
+// reference stays valid and the vector's capacity is reused across files.
+struct WorkerState {
+    SaveBuffer buffer;
+    ReadOnlyData reader{buffer};
+
+    // Structured output: records are built here and copied out once.
+    OutputBuffer records;
+    std::unique_ptr<SummarySink> sink;
+
+    // Async I/O: the "(BACKUP)" write of the file being decoded.
+    WriteTicket pendingBackup;
+};
+
+// State shared by every worker of one scan.
+struct ScanContext {
+    const BatchOptions& opts;
+    std::optional<ResultCache> cache;
+    std::string_view cacheKind;
+    std::vector<std::unique_ptr<WorkerState>> workers;
+
+    ScanContext(const BatchOptions& o, unsigned threads)
+        : opts(o), cacheKind(o.format ? SummarySink::FormatName(*o.format) : "summary") {
+        if (!opts.cacheDir.empty() && !opts.query) cache.emplace(opts.cacheDir);
+        workers.reserve(threads);
+        for (unsigned w = 0; w < threads; ++w) {
+            auto ws = std::make_unique<WorkerState>();
+            if (opts.format || opts.query) {
+                ws->sink = SummarySink::Create(opts.format.value_or(SummaryFormat::Text), ws->records);
+            }
+            workers.push_back(std::move(ws));
+        }
+    }
+
+    // Per-emitted-file totals (called on the draining thread).
+    void Tally(const BatchFileResult& r, BatchStats& stats) const {
+        stats.bytesRead += r.sizeBytes;
+        if (!r.ok) stats.filesFailed++;
+        if (r.ok && r.matched && opts.query) stats.filesMatched++;
+    }
+
+    void Finish(BatchStats& stats) const {
+        stats.queryEnabled = opts.query != nullptr;
+        if (cache) {
+            stats.cacheEnabled = true;
+            stats.cacheHits = cache->Hits();
+            stats.cacheMisses = cache->Misses();
+        }
+    }
+};
+
+// Builds the output for one save into `result` (path already set) on worker
+// `ws`. `load(mapped)` produces the bytes; `mapped` keeps a mapping alive until
+// the summary is built. Failures become an error result, never an exception.
+template <typename Load>
+void ProcessFile(ScanContext& ctx, WorkerState& ws, bool viewIsWorkerBuffer, BatchFileResult& result,
+                 const Load& load) {
+    const BatchOptions& opts = ctx.opts;
+    const std::string& name = result.path;
+
+    try {
+        MappedFile mapped;
+        const SaveView view = load(mapped);
+        result.sizeBytes = view.Size();
+
+        // The worker's reader is bound to its buffer (sections may be
+        // cached); anything else gets a throwaway reader.
+        auto withReader = [&](auto&& fn) {
+            if (viewIsWorkerBuffer) {
+                fn(ws.reader);
+            } else {
+                fn(ReadOnlyData(view));
+            }
+        };
+
+        // A hit skips decoding entirely; only the per-file header is rebuilt.
+        SaveDigest digest;
+        std::optional<std::string> cached;
+        if (ctx.cache) {
+            digest = SaveDigest::Of(view);
+            cached = ctx.cache->Lookup(digest, ctx.cacheKind);
+        }
+
+        if (opts.query) {
+            // Reads only the fields the query names; no summary is built.
+            result.matched = opts.query->Matches(view);
+            if (result.matched) {
+                ws.records.Clear();
+                ws.sink->BeginRecord();
+                ws.sink->String("path", name);
+                opts.query->Project(view, *ws.sink);
+                ws.sink->EndRecord();
+                result.output.assign(ws.records.Data());
+            }
+        } else if (ws.sink) {
+            ws.records.Clear();
+            ws.sink->BeginRecord();
+            ws.sink->String("path", name);
+            ws.sink->Bool("ok", true);
+            ws.sink->Uint("size", view.Size());
+            if (cached) {
+                ws.sink->AppendRendered(*cached);
+            } else {
+                const std::size_t summaryStart = ws.records.Size();
+                withReader([&](const ReadOnlyData& reader) { reader.WriteSummary(*ws.sink); });
+                if (ctx.cache) ctx.cache->Store(digest, ctx.cacheKind, ws.records.Data().substr(summaryStart));
+            }
+            ws.sink->EndRecord();
+            result.output.assign(ws.records.Data());
+        } else {
+            if (!cached) {
+                withReader([&](const ReadOnlyData& reader) { cached = reader.DumpFullSummary(); });
+                if (ctx.cache) ctx.cache->Store(digest, ctx.cacheKind, *cached);
+            }
+            std::ostringstream oss;
+            oss << "### " << name << "\n";
+            if (!SaveValidator::HasExpectedSize(view)) {
+                oss << "[WARN] Save size is not 0x8000 (32KB). This may not be a Gen I save.\n";
+            }
+            oss << *cached;
+            result.output = oss.str();
+        }
+
+        // An asynchronous backup overlapped the decode; its failure fails the file.
+        if (ws.pendingBackup.valid()) ws.pendingBackup.get();
+        result.ok = true;
+    } catch (const std::exception& e) {
+        if (ws.pendingBackup.valid()) ws.pendingBackup = WriteTicket();
+        result.error = e.what();
+        result.ok = false;
+        result.output.clear();
+
+        if (ws.sink) {
+            // Drop the partial record; failures still get one.
+            ws.records.Clear();
+            ws.sink->BeginRecord();
+            ws.sink->String("path", name);
+            ws.sink->Bool("ok", false);
+            ws.sink->String("error", result.error);
+            ws.sink->EndRecord();
+            result.output.assign(ws.records.Data());
+        }
+    }
+}
+
+// Completed results waiting to be emitted in order. Result i lives in
+// slots[i % size]; a worker may only start input i once i - emitted < size,
+// so at most `size` results are ever parked.
+struct ResultQueue {
+    std::mutex mu;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<BatchFileResult>> slots;
+    std::size_t emitted = 0;
+    bool producerDone = false;
+    bool aborted = false; // emit threw; workers stop
+};
+
+// Produces the bytes for input i on worker `ws`. `mapped` keeps a mapping
+// alive until the summary is built.
+using LoadFn = std::function<SaveView(WorkerState& ws, std::size_t i, MappedFile& mapped)>;
+
+// Builds and queues the result for input i on worker w, reading it through `load`.
+// Returns false (without loading) once the run was aborted.
+using ProcessFn = std::function<bool(unsigned w, std::size_t i, const LoadFn& load)>;
+
+// Calls `process` once per input, on `threads` workers, and returns when all are done.
+using DriveFn = std::function<void(unsigned threads, const ProcessFn& process)>;
+
+// Shared driver for file and generated inputs: fan out over the workers,
+// drain results in index order on the calling thread. `window` bounds the
+// results waiting for the drain; the driver must start the oldest pending
+// input without waiting (see ParallelDrive / RunAsync).
+BatchStats RunIndexed(const BatchOptions& opts, const std::vector<std::string>& names, const DriveFn& drive,
+                      bool viewIsWorkerBuffer, std::size_t window, const BatchScanner::EmitFn& emit) {
+    using Clock = std::chrono::steady_clock;
+
+    BatchStats stats;
+    stats.filesTotal = names.size();
+    stats.threads = WorkStealingPool::ResolveThreadCount(opts.threads);
+
+    const auto t0 = Clock::now();
+
+    ScanContext ctx(opts, stats.threads);
+
+    ResultQueue queue;
+    queue.slots.resize(std::max<std::size_t>(window, 1));
+    const std::size_t depth = queue.slots.size();
+
+    std::exception_ptr poolError;
+
+    std::thread producer([&] {
+        try {
+            drive(stats.threads, [&](unsigned w, std::size_t i, const LoadFn& load) {
+                {
+                    std::unique_lock<std::mutex> lock(queue.mu);
+                    queue.cv.wait(lock, [&] { return queue.aborted || i - queue.emitted < depth; });
+                    if (queue.aborted) return false;
+                }
+                WorkerState& ws = *ctx.workers[w];
+
+                auto result = std::make_unique<BatchFileResult>();
+                result->index = i;
+                result->path = names[i];
+                ProcessFile(ctx, ws, viewIsWorkerBuffer, *result,
+                            [&](MappedFile& mapped) { return load(ws, i, mapped); });
+
+                std::lock_guard<std::mutex> lock(queue.mu);
+                queue.slots[i % depth] = std::move(result);
+                queue.cv.notify_all();
+                return true;
+            });
+        } catch (...) {
+            poolError = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(queue.mu);
+        queue.producerDone = true;
+        queue.cv.notify_all();
+    });
+
+    // Drain in order on the calling thread; each emit frees a slot.
+    try {
+        for (std::size_t next = 0; next < names.size(); ++next) {
+            std::unique_ptr<BatchFileResult> r;
+            {
+                std::unique_lock<std::mutex> lock(queue.mu);
+                std::unique_ptr<BatchFileResult>& slot = queue.slots[next % depth];
+                queue.cv.wait(lock, [&] { return slot != nullptr || queue.producerDone; });
+                if (!slot) break; // producer aborted
+                r = std::move(slot);
+                queue.emitted = next + 1;
+                queue.cv.notify_all();
+            }
+
+            ctx.Tally(*r, stats);
+            emit(*r);
+        }
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(queue.mu);
+            queue.aborted = true;
+            queue.cv.notify_all();
+        }
+        producer.join();
+        throw;
+    }
+
+    producer.join();
+    if (poolError) std::rethrow_exception(poolError);
+
+    stats.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    ctx.Finish(stats);
+    return stats;
+}
+
+// Inputs per work-stealing pass: enough per worker for stealing to even out
+// slow files, few enough that the parked results stay small.
+std::size_t DriveBlock(unsigned threads) { return 16 * static_cast<std::size_t>(threads); }
+
+// Results parked for the drain: two blocks, so the drain can empty one while
+// the workers fill the next.
+std::size_t ResultWindow(unsigned threads) { return 2 * DriveBlock(threads); }
+
+// Index-based driving: inputs go through the work-stealing pool one block at
+// a time. Block k only starts once block k-1 is done, so every result a
+// worker waits to park behind is already finished and the drain always makes
+// progress. `load` reads each one.
+DriveFn ParallelDrive(std::size_t count, LoadFn load) {
+    return [count, load = std::move(load)](unsigned threads, const ProcessFn& process) {
+        const std::size_t block = DriveBlock(threads);
+        for (std::size_t base = 0; base < count; base += block) {
+            const std::size_t n = std::min(block, count - base);
+            bool aborted = false;
+            WorkStealingPool::ParallelFor(n, threads, [&](unsigned w, std::size_t k) {
+                if (!process(w, base + k, load)) aborted = true;
+            });
+            if (aborted) return;
+        }
+    };
+}
+
+// Pull-based driving for async I/O: each worker takes whichever read finished
+// next, so no worker waits on a particular file.
+BatchStats RunAsync(const BatchOptions& opts, const std::vector<std::string>& files, const BatchScanner::EmitFn& emit) {
+    AsyncLoader loader(files, opts.ioDepth, *opts.asyncIo);
+    std::optional<AsyncWriter> writer;
+    if (opts.makeBackups) writer.emplace(opts.ioDepth);
+
+    // Reads are issued in index order, and a file's read credit only comes back
+    // once its result has been emitted (`parked` holds it until then), so every
+    // delivered index is within ioDepth of the oldest unemitted one: with a
+    // window of at least ioDepth, a worker never waits to park a result.
+    const unsigned workers = WorkStealingPool::ResolveThreadCount(opts.threads);
+    const std::size_t window = std::max(ResultWindow(workers), std::max<std::size_t>(opts.ioDepth, 1) + workers);
+    std::vector<LoadedFile> parked(window);
+
+    const DriveFn drive = [&](unsigned threads, const ProcessFn& process) {
+        WorkStealingPool::ParallelFor(threads, threads, [&](unsigned w, std::size_t) {
+            LoadedFile next;
+            while (loader.Next(next)) {
+                // Parked before the result is queued, so the drain always finds it.
+                LoadedFile& file = parked[next.index % window];
+                file = std::move(next);
+                next = LoadedFile();
+                const bool queued = process(w, file.index, [&](WorkerState& ws, std::size_t i, MappedFile&) {
+                    if (!file.error.empty()) throw std::runtime_error(file.error);
+                    // Swap, not copy: the worker's old buffer goes back to the loader.
+                    std::swap(ws.buffer.BytesMutable(), file.bytes);
+                    if (writer) ws.pendingBackup = writer->Submit(AsyncWriter::Mode::Backup, files[i], ws.buffer.BytesView());
+                    return ws.buffer.View();
+                });
+                if (!queued) {
+                    // Aborted: nothing will be emitted, so hand it back here to keep Next() moving.
+                    loader.Recycle(std::move(file));
+                    file = LoadedFile();
+                }
+            }
+        });
+    };
+
+    BatchStats stats = RunIndexed(opts, files, drive, true, window, [&](const BatchFileResult& r) {
+        emit(r);
+        // Clear the slot before returning the credit: the next file for it may
+        // arrive as soon as Recycle() does.
+        LoadedFile done = std::move(parked[r.index % window]);
+        parked[r.index % window] = LoadedFile();
+        loader.Recycle(std::move(done));
+    });
+    stats.ioBackend = AsyncLoader::BackendName(loader.Backend());
+    return stats;
+}
+
+// Archive members are filtered like a directory walk; raw frames are all saves.
+bool IsStreamSave(const StreamFrame& frame) {
+    if (frame.member.empty()) return true;
+    const std::filesystem::path p(frame.member);
+    return HasSaveExtension(p) && !IsGeneratedCopy(p.filename().string());
+}
+
+// Bounded window over a stream: frame i lives in slots[i % size] from the
+// moment a worker reads it until the calling thread has emitted it.
+struct StreamRing {
+    struct Slot {
+        StreamFrame frame;                        // bytes swap with the worker's buffer, so capacity circulates
+        std::unique_ptr<BatchFileResult> result;  // set when frame is done
+    };
+
+    std::mutex mu;
+    std::condition_variable cv;
+    std::vector<Slot> slots;
+    std::size_t claimed = 0;  // frames read so far
+    std::size_t emitted = 0;  // frames handed to emit
+    bool ended = false;       // stream exhausted (or failed); `claimed` is the total
+    bool aborted = false;     // emit threw; workers stop
+    bool workersDone = false;
+    std::exception_ptr streamError;
+
+    // Serializes reads: one worker at a time pulls the next frame, in stream order.
+    std::mutex readMu;
+};
+
+} // namespace
+
+BatchStats BatchScanner::Run(const BatchOptions& opts, const EmitFn& emit) {
+    const std::vector<std::string> files = CollectInputs(opts.inputs, opts.recursive);
+    if (opts.asyncIo) return RunAsync(opts, files, emit);
+
+    const LoadFn load = [&](WorkerState& ws, std::size_t i, MappedFile& mapped) {
+        // Backups are written from the bytes just read, so each input is read once.
+        if (opts.useMmap) {
+            mapped = MappedFile::Open(files[i]);
+            if (opts.makeBackups) FileManipulation::BackupFromBytes(files[i], mapped.Bytes());
+            return SaveView(mapped.Bytes());
+        }
+        if (opts.makeBackups) {
+            FileManipulation::LoadFileWithBackup(files[i], ws.buffer.BytesMutable());
+        } else {
+            FileManipulation::LoadFileInto(files[i], ws.buffer.BytesMutable());
+        }
+        return ws.buffer.View();
+    };
+    return RunIndexed(opts, files, ParallelDrive(files.size(), load), !opts.useMmap,
+                      ResultWindow(WorkStealingPool::ResolveThreadCount(opts.threads)), emit);
+}
+
+BatchStats BatchScanner::RunGenerated(const BatchOptions& opts, const SaveGenerator& generator, std::size_t count,
+                                      const EmitFn& emit) {
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) names.push_back(GeneratedName(i));
+
+    const LoadFn load = [&](WorkerState& ws, std::size_t i, MappedFile&) {
+        generator.Generate(i, ws.buffer);
+        return ws.buffer.View();
+    };
+    return RunIndexed(opts, names, ParallelDrive(names.size(), load), true,
+                      ResultWindow(WorkStealingPool::ResolveThreadCount(opts.threads)), emit);
+}
+
+BatchStats BatchScanner::RunStream(const BatchOptions& opts, SaveStream& stream, const EmitFn& emit) {
+    using Clock = std::chrono::steady_clock;
+
+    BatchStats stats;
+    stats.threads = WorkStealingPool::ResolveThreadCount(opts.threads);
+    const auto t0 = Clock::now();
+
+    ScanContext ctx(opts, stats.threads);
+
+    StreamRing ring;
+    const std::size_t depth = opts.streamDepth ? opts.streamDepth : 4 * static_cast<std::size_t>(stats.threads);
+    ring.slots.resize(depth);
+
+    auto work = [&](unsigned w, std::size_t) {
+        WorkerState& ws = *ctx.workers[w];
+        for (;;) {
+            std::size_t i = 0;
+            {
+                std::lock_guard<std::mutex> readLock(ring.readMu);
+                {
+                    // Frame i reuses the slot of frame i - depth, so wait for that one to be emitted.
+                    std::unique_lock<std::mutex> lock(ring.mu);
+                    ring.cv.wait(lock, [&] { return ring.ended || ring.aborted || ring.claimed - ring.emitted < depth; });
+                    if (ring.ended || ring.aborted) return;
+                    i = ring.claimed;
+                }
+
+                bool more = false;
+                std::exception_ptr error;
+                try {
+                    StreamFrame& frame = ring.slots[i % depth].frame;
+                    do {
+                        more = stream.Next(frame);
+                    } while (more && !IsStreamSave(frame));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(ring.mu);
+                if (!more) {
+                    ring.ended = true;
+                    ring.streamError = error;
+                    ring.cv.notify_all();
+                    return;
+                }
+                ring.claimed = i + 1;
+            }
+
+            StreamRing::Slot& slot = ring.slots[i % depth];
+            auto result = std::make_unique<BatchFileResult>();
+            result->index = i;
+            result->path = slot.frame.name;
+            ProcessFile(ctx, ws, true, *result, [&](MappedFile&) {
+                if (!slot.frame.error.empty()) throw std::runtime_error(slot.frame.error);
+                // Swap, not copy: the worker's old buffer stays in the ring for a later frame.
+                std::swap(ws.buffer.BytesMutable(), slot.frame.bytes);
+                return ws.buffer.View();
+            });
+
+            std::lock_guard<std::mutex> lock(ring.mu);
+            slot.result = std::move(result);
+            ring.cv.notify_all();
+        }
+    };
+
+    std::exception_ptr poolError;
+    std::thread producer([&] {
+        try {
+            WorkStealingPool::ParallelFor(stats.threads, stats.threads, work);
+        } catch (...) {
+            poolError = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(ring.mu);
+        ring.workersDone = true;
+        ring.cv.notify_all();
+    });
+
+    // Drain in stream order on the calling thread; each emit frees a slot.
+    try {
+        for (std::size_t next = 0;; ++next) {
+            std::unique_ptr<BatchFileResult> r;
+            {
+                std::unique_lock<std::mutex> lock(ring.mu);
+                StreamRing::Slot& slot = ring.slots[next % depth];
+                ring.cv.wait(lock, [&] {
+                    return slot.result != nullptr || (ring.ended && next >= ring.claimed) || ring.workersDone;
+                });
+                if (!slot.result) break;
+                r = std::move(slot.result);
+                ring.emitted = next + 1;
+                ring.cv.notify_all();
+            }
+
+            stats.filesTotal++;
+            ctx.Tally(*r, stats);
+            emit(*r);
+        }
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(ring.mu);
+            ring.aborted = true;
+            ring.cv.notify_all();
+        }
+        producer.join();
+        throw;
+    }
+
+    producer.join();
+    if (poolError) std::rethrow_exception(poolError);
+    if (ring.streamError) std::rethrow_exception(ring.streamError);
+
+    stats.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    ctx.Finish(stats);
+    return stats;
+}
+
+std::string BatchScanner::GeneratedName(std::size_t index) {
+    std::string digits = std::to_string(index);
+    if (digits.size() < 7) digits.insert(0, 7 - digits.size(), '0');
+    return "gen:" + digits;
+}
+
+} // namespace savegenie
@@ -0,0 +1,331 @@
+//
+//  Benchmark.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of Benchmark (timing loop, benchmark list; saves come from SaveGenerator).
+//   - Global operator new/delete replacement for allocation counting.
+//
+
+#include "Benchmark.hpp"
+
+#include "ChecksumKernels.hpp"
+#include "ContentHash.hpp"
+#include "ReadOnlyData.hpp"
+#include "SaveGenerator.hpp"
+#include "SavePatch.hpp"
+#include "SaveQuery.hpp"
+#include "SummarySink.hpp"
+#include "WriteOnlyData.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+// =========================================================
+// Allocation counting (global replacement)
+// =========================================================
+
+namespace {
+thread_local std::uint64_t t_allocations = 0;
+} // namespace
+
+void* operator new(std::size_t size) {
+    ++t_allocations;
+    if (size == 0) size = 1;
+    for (;;) {
+        if (void* p = std::malloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace savegenie {
+
+std::uint64_t Benchmark::ThreadAllocations() { return t_allocations; }
+
+// =========================================================
+// BenchResult
+// =========================================================
+
+void BenchResult::WriteTo(SummarySink& sink) const {
+    sink.String("bench", name);
+    sink.String("save", save);
+    sink.Uint("iterations", iterations);
+    sink.Double("nsPerOp", nsPerOp);
+    sink.Double("allocsPerOp", allocsPerOp);
+    sink.Uint("bytesPerOp", bytesPerOp);
+    sink.Double("mbPerSec", mbPerSec);
+}
+
+namespace {
+
+// =========================================================
+// Timing
+// =========================================================
+
+// Keeps `value` observable so the measured call is not optimized away.
+template <class T>
+void KeepAlive(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+}
+
+class Runner {
+public:
+    Runner(const BenchOptions& opts, const Benchmark::ReportFn& report) : opts_(opts), report_(report) {}
+
+    template <class Fn>
+    void Run(const char* name, const std::string& save, std::size_t bytesPerOp, Fn&& fn) {
+        if (!opts_.filter.empty() && std::string_view(name).find(opts_.filter) == std::string_view::npos) return;
+
+        using Clock = std::chrono::steady_clock;
+        fn(); // warm-up (first-use allocations, caches)
+
+        std::uint64_t iterations = 1;
+        for (;;) {
+            const std::uint64_t allocs0 = Benchmark::ThreadAllocations();
+            const auto t0 = Clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) fn();
+            const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+            const std::uint64_t allocs = Benchmark::ThreadAllocations() - allocs0;
+
+            if (seconds >= opts_.minSeconds || iterations >= (std::uint64_t{1} << 32)) {
+                BenchResult r;
+                r.name = name;
+                r.save = save;
+                r.iterations = iterations;
+                r.nsPerOp = seconds * 1e9 / static_cast<double>(iterations);
+                r.allocsPerOp = static_cast<double>(allocs) / static_cast<double>(iterations);
+                r.bytesPerOp = bytesPerOp;
+                r.mbPerSec = (bytesPerOp > 0 && seconds > 0.0)
+                    ? static_cast<double>(bytesPerOp) * static_cast<double>(iterations) / seconds / 1e6
+                    : 0.0;
+                report_(r);
+                return;
+            }
+
+            // Aim ~20% past the target from the current rate, at least doubling.
+            const double scale = seconds > 0.0 ? opts_.minSeconds * 1.2 / seconds : 100.0;
+            iterations = std::max(iterations * 2, static_cast<std::uint64_t>(static_cast<double>(iterations) * scale));
+        }
+    }
+
+private:
+    const BenchOptions& opts_;
+    const Benchmark::ReportFn& report_;
+};
+
+} // namespace
+
+std::vector<std::pair<std::string, SaveBuffer>> Benchmark::SyntheticSaves() {
+    // Fixed ranges (lo == hi) pin the content; "typical" draws box fill per box.
+    auto fixed = [](int v) { return IntRange{v, v}; };
+
+    GeneratorSpec blank;
+    blank.seed = 1;
+    blank.partyMons = blank.monsPerBox = blank.hallOfFameRecords = fixed(0);
+    blank.bagItems = blank.pcItems = blank.dexPercent = blank.flagPercent = fixed(0);
+
+    GeneratorSpec typical;
+    typical.seed = 2;
+    typical.partyMons = fixed(4);
+    typical.monsPerBox = IntRange{0, Gen1Layout::BoxMaxMons};
+    typical.hallOfFameRecords = fixed(3);
+    typical.bagItems = fixed(8);
+    typical.pcItems = fixed(5);
+    typical.dexPercent = fixed(40);
+    typical.flagPercent = fixed(30);
+
+    GeneratorSpec full;
+    full.seed = 3;
+    full.partyMons = fixed(Gen1Layout::PartyMaxMons);
+    full.monsPerBox = fixed(Gen1Layout::BoxMaxMons);
+    full.hallOfFameRecords = fixed(Gen1Layout::HallOfFameMaxRecords);
+    full.bagItems = fixed(Gen1Layout::BagItemsMaxPairs);
+    full.pcItems = fixed(Gen1Layout::PCItemBoxMaxPairs);
+    full.dexPercent = fixed(100);
+    full.flagPercent = fixed(100);
+
+    std::vector<std::pair<std::string, SaveBuffer>> out;
+    out.emplace_back("blank", SaveGenerator(blank).Generate(0));
+    out.emplace_back("typical", SaveGenerator(typical).Generate(0));
+    out.emplace_back("full", SaveGenerator(full).Generate(0));
+    return out;
+}
+
+// =========================================================
+// Benchmark list
+// =========================================================
+
+void Benchmark::RunAll(const BenchOptions& opts, const ReportFn& report) {
+    Runner run(opts, report);
+
+    constexpr std::size_t kMainLen = Gen1Layout::MainChecksumEnd - Gen1Layout::MainChecksumStart + 1;
+    constexpr std::size_t kBoxesLen = 12 * Gen1Layout::BoxBlockSize;
+
+    auto saves = SyntheticSaves();
+    for (auto& [saveName, save] : saves) {
+        const SaveView sv = save.View();
+        SaveBuffer scratch = save; // target for encode / edit benchmarks
+
+        // --- Checksums ---
+        // Throughput counts the bytes the op actually covers (Fix* after a write: the write).
+        run.Run("checksum.ComputeMain", saveName, kMainLen, [&] { KeepAlive(Gen1Checksum::ComputeMain(sv)); });
+        run.Run("checksum.ComputeBankAll", saveName, kBoxesLen, [&] {
+            KeepAlive(Gen1Checksum::ComputeBankAll(sv, 2));
+            KeepAlive(Gen1Checksum::ComputeBankAll(sv, 3));
+        });
+        run.Run("checksum.ComputeBox", saveName, kBoxesLen, [&] {
+            for (int box = 1; box <= 12; ++box) KeepAlive(Gen1Checksum::ComputeBox(sv, box));
+        });
+        run.Run("checksum.ScanAll", saveName, kMainLen + kBoxesLen, [&] { KeepAlive(Gen1Checksum::ScanAll(sv)); });
+        run.Run("checksum.FixMainAfterWrite", saveName, Gen1Layout::MoneyLen, [&] {
+            BcdCodec::WriteBcd3(scratch, Gen1Layout::MoneyOff, 123456);
+            Gen1Checksum::FixMain(scratch); // incremental after the first call
+        });
+
+        // Kernels are data-independent; measure them once.
+        if (&save == &saves.front().second) {
+            for (ChecksumKernelKind kind : {ChecksumKernelKind::Scalar, ChecksumKernelKind::SSE2,
+                                            ChecksumKernelKind::AVX2, ChecksumKernelKind::NEON}) {
+                if (!ChecksumKernels::IsSupported(kind)) continue;
+                const std::string name = std::string("kernel.") + ChecksumKernels::Name(kind);
+                run.Run(name.c_str(), saveName, sv.Size(), [&] {
+                    KeepAlive(ChecksumKernels::SumWith(kind, sv.Span()));
+                });
+            }
+        }
+
+        // --- Text / BCD codecs ---
+        run.Run("text.DecodeName", saveName, Gen1Layout::TrainerNameLen, [&] {
+            KeepAlive(Gen1TextCodec::DecodeName(sv, Gen1Layout::TrainerNameOff, Gen1Layout::TrainerNameLen));
+        });
+        run.Run("text.DecodeNameInline", saveName, Gen1Layout::TrainerNameLen, [&] {
+            KeepAlive(Gen1TextCodec::DecodeNameInline(sv, Gen1Layout::TrainerNameOff, Gen1Layout::TrainerNameLen));
+        });
+        run.Run("text.EncodeName", saveName, Gen1Layout::RivalNameLen, [&] {
+            Gen1TextCodec::EncodeName(scratch, Gen1Layout::RivalNameOff, Gen1Layout::RivalNameLen, "BLUE");
+        });
+        run.Run("bcd.ReadBcd3", saveName, Gen1Layout::MoneyLen, [&] {
+            KeepAlive(BcdCodec::ReadBcd3(sv, Gen1Layout::MoneyOff));
+        });
+        run.Run("bcd.WriteBcd3", saveName, Gen1Layout::MoneyLen, [&] {
+            BcdCodec::WriteBcd3(scratch, Gen1Layout::MoneyOff, 123456);
+        });
+        run.Run("bcd.ReadBcd2", saveName, Gen1Layout::CoinsLen, [&] {
+            KeepAlive(BcdCodec::ReadBcd2(sv, Gen1Layout::CoinsOff));
+        });
+        run.Run("bcd.WriteBcd2", saveName, Gen1Layout::CoinsLen, [&] {
+            BcdCodec::WriteBcd2(scratch, Gen1Layout::CoinsOff, 1234);
+        });
+
+        // --- ReadOnlyData (uncached reader: every call decodes) ---
+        const ReadOnlyData reader(sv);
+        run.Run("reader.GetIntegrityReport", saveName, kMainLen + kBoxesLen, [&] { KeepAlive(reader.GetIntegrityReport()); });
+        run.Run("reader.GetTrainerSummary", saveName, 0, [&] { KeepAlive(reader.GetTrainerSummary()); });
+        run.Run("reader.GetBoxStats", saveName, kBoxesLen, [&] {
+            for (int box = 1; box <= 12; ++box) KeepAlive(reader.GetBoxStats(box));
+        });
+        BoxMonTable table;
+        run.Run("reader.DecodeBoxMons", saveName, kBoxesLen, [&] {
+            reader.DecodeBoxMons(table);
+            KeepAlive(table);
+        });
+        run.Run("reader.GetBoxMons", saveName, kBoxesLen, [&] { KeepAlive(reader.GetBoxMons()); });
+        run.Run("reader.GetEventFlagSummary", saveName, Gen1Layout::EventFlagsLen, [&] {
+            KeepAlive(reader.GetEventFlagSummary());
+        });
+        run.Run("reader.GetPokedexSummary", saveName, 2 * Gen1Layout::PokedexBitsLen, [&] {
+            KeepAlive(reader.GetPokedexSummary(true));
+        });
+        run.Run("reader.GetBagSummary", saveName, Gen1Layout::BagItemsLen, [&] { KeepAlive(reader.GetBagSummary(true)); });
+        run.Run("reader.GetPCItemBoxSummary", saveName, Gen1Layout::PCItemBoxLen, [&] {
+            KeepAlive(reader.GetPCItemBoxSummary(true));
+        });
+        run.Run("reader.GetHallOfFame", saveName, Gen1Layout::HallOfFameLen, [&] { KeepAlive(reader.GetHallOfFame()); });
+        run.Run("reader.GetHallOfFameRange", saveName, Gen1Layout::HallOfFameLen, [&] {
+            for (const HallOfFameRecordView record : reader.GetHallOfFameRange()) {
+                for (const HallOfFameMonView mon : record) KeepAlive(mon.DecodeName());
+            }
+        });
+        SaveSnapshot snapshot;
+        run.Run("reader.DecodeAll", saveName, sv.Size(), [&] {
+            reader.DecodeAll(snapshot);
+            KeepAlive(snapshot);
+        });
+        run.Run("reader.DumpFullSummary", saveName, sv.Size(), [&] { KeepAlive(reader.DumpFullSummary()); });
+
+        OutputBuffer records;
+        NdjsonSink sink(records);
+        run.Run("reader.WriteSummary.ndjson", saveName, sv.Size(), [&] {
+            records.Clear();
+            sink.BeginRecord();
+            reader.WriteSummary(sink);
+            sink.EndRecord();
+            KeepAlive(records);
+        });
+
+        // --- Queries (only the referenced fields are read) ---
+        const SaveQuery selective = SaveQuery::Compile("badges == 0xFF && money > 500000 || owns(\"MEW\")");
+        run.Run("query.MatchSelective", saveName, 0, [&] { KeepAlive(selective.Matches(sv)); });
+        const SaveQuery projection = SaveQuery::Compile("", "name, money, dex_owned, box_mons");
+        run.Run("query.Project.ndjson", saveName, 0, [&] {
+            records.Clear();
+            sink.BeginRecord();
+            projection.Project(sv, sink);
+            sink.EndRecord();
+            KeepAlive(records);
+        });
+
+        // --- Hashing ---
+        run.Run("hash.SaveDigest", saveName, sv.Size(), [&] { KeepAlive(SaveDigest::Of(sv)); });
+
+        // --- WriteOnlyData ---
+        EditRequest req;
+        req.newTrainerName = "ASH";
+        req.newRivalName = "GARY";
+        req.newMoney = 654321;
+        req.newCoins = 4321;
+        req.newBadges = 0xFF;
+        req.newMapId = 1;
+        req.newX = 3;
+        req.newY = 4;
+        WriteOnlyData writer(scratch);
+        run.Run("writer.Apply", saveName, 0, [&] { KeepAlive(writer.Apply(req)); });
+
+        // Three edits, one journal, one checksum repair.
+        EditBatch batch;
+        batch.Add(req);
+        ItemEditRequest potion;
+        potion.itemId = 0x14;
+        potion.quantity = 1;
+        potion.maxQuantity = 255;
+        batch.Add(potion);
+        ItemEditRequest dropPotion = potion;
+        dropPotion.action = ItemEditAction::Remove;
+        batch.Add(dropPotion);
+        run.Run("writer.ApplyBatch", saveName, 0, [&] { KeepAlive(writer.ApplyBatch(batch)); });
+
+        // --- Patches (the edit above, as a SavePatch against the original) ---
+        writer.Apply(req);
+        const SavePatch patch = SavePatch::Diff(save, scratch);
+        run.Run("patch.Diff", saveName, sv.Size(), [&] { KeepAlive(SavePatch::Diff(save, scratch).RunBytes()); });
+        const SavePatch undo = patch.Inverted();
+        run.Run("patch.ApplyAndUndo", saveName, 2 * patch.RunBytes(), [&] {
+            KeepAlive(undo.Apply(scratch));
+            KeepAlive(patch.Apply(scratch));
+        });
+    }
+}
+
+} // namespace savegenie
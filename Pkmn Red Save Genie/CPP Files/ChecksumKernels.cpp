@@ -0,0 +1,228 @@
+//
+//  ChecksumKernels.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of ChecksumKernels.
+//   - x86 kernels are compiled with per-function target attributes, so the
+//     binary runs on any x86-64 CPU and only dispatches to AVX2 if present.
+//
+
+#include "ChecksumKernels.hpp"
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define SAVEGENIE_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define SAVEGENIE_X86_KERNELS 0
+#endif
+
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define SAVEGENIE_NEON_KERNELS 1
+#include <arm_neon.h>
+#else
+#define SAVEGENIE_NEON_KERNELS 0
+#endif
+
+namespace savegenie {
+
+namespace {
+
+using SumFn = std::uint32_t (*)(const std::uint8_t* data, std::size_t len);
+
+std::uint32_t SumScalar(const std::uint8_t* data, std::size_t len) {
+    std::uint32_t sum = 0;
+    for (std::size_t i = 0; i < len; ++i) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+#if SAVEGENIE_X86_KERNELS
+
+// psadbw against zero = horizontal sum of 8 bytes into each 64-bit lane.
+__attribute__((target("sse2")))
+std::uint32_t SumSSE2(const std::uint8_t* data, std::size_t len) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+    }
+
+    const std::uint64_t lo = static_cast<std::uint64_t>(_mm_cvtsi128_si64(acc));
+    const std::uint64_t hi = static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(acc, acc)));
+    std::uint32_t sum = static_cast<std::uint32_t>(lo + hi);
+
+    for (; i < len; ++i) sum += data[i];
+    return sum;
+}
+
+__attribute__((target("avx2")))
+std::uint32_t SumAVX2(const std::uint8_t* data, std::size_t len) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    // Two independent accumulators hide the vpsadbw latency.
+    for (; i + 64 <= len; i += 64) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+        acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(b, zero));
+    }
+    for (; i + 32 <= len; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+    }
+
+    const __m256i acc = _mm256_add_epi64(acc0, acc1);
+    const __m128i folded = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    const std::uint64_t lo = static_cast<std::uint64_t>(_mm_cvtsi128_si64(folded));
+    const std::uint64_t hi = static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(folded, folded)));
+    std::uint32_t sum = static_cast<std::uint32_t>(lo + hi);
+
+    for (; i < len; ++i) sum += data[i];
+    return sum;
+}
+
+#endif // SAVEGENIE_X86_KERNELS
+
+#if SAVEGENIE_NEON_KERNELS
+
+std::uint32_t SumNEON(const std::uint8_t* data, std::size_t len) {
+    uint32x4_t acc32 = vdupq_n_u32(0);
+
+    const std::size_t vecEnd = len & ~static_cast<std::size_t>(15);
+    std::size_t i = 0;
+    while (i < vecEnd) {
+        // u16 lanes take 2 bytes per step: flush every 128 steps (2 * 128 * 255 < 65536).
+        const std::size_t chunkEnd = std::min(vecEnd, i + 16 * 128);
+        uint16x8_t acc16 = vdupq_n_u16(0);
+        for (; i < chunkEnd; i += 16) {
+            acc16 = vpadalq_u8(acc16, vld1q_u8(data + i));
+        }
+        acc32 = vpadalq_u16(acc32, acc16);
+    }
+
+    std::uint32_t sum = vgetq_lane_u32(acc32, 0) + vgetq_lane_u32(acc32, 1) +
+                        vgetq_lane_u32(acc32, 2) + vgetq_lane_u32(acc32, 3);
+    for (; i < len; ++i) sum += data[i];
+    return sum;
+}
+
+#endif // SAVEGENIE_NEON_KERNELS
+
+SumFn FnFor(ChecksumKernelKind kind) {
+    switch (kind) {
+        case ChecksumKernelKind::Scalar: return &SumScalar;
+#if SAVEGENIE_X86_KERNELS
+        case ChecksumKernelKind::SSE2:   return &SumSSE2;
+        case ChecksumKernelKind::AVX2:   return &SumAVX2;
+#endif
+#if SAVEGENIE_NEON_KERNELS
+        case ChecksumKernelKind::NEON:   return &SumNEON;
+#endif
+        default: return nullptr;
+    }
+}
+
+ChecksumKernelKind BestSupported() {
+    for (ChecksumKernelKind k : {ChecksumKernelKind::AVX2, ChecksumKernelKind::SSE2, ChecksumKernelKind::NEON}) {
+        if (ChecksumKernels::IsSupported(k)) return k;
+    }
+    return ChecksumKernelKind::Scalar;
+}
+
+// Resolved lazily on first Sum() unless Select() ran first.
+std::atomic<int> g_activeKind{static_cast<int>(ChecksumKernelKind::Auto)};
+std::atomic<SumFn> g_activeFn{nullptr};
+
+SumFn RequireFn(ChecksumKernelKind kind) {
+    if (kind == ChecksumKernelKind::Auto) kind = BestSupported();
+    if (!ChecksumKernels::IsSupported(kind)) {
+        throw std::invalid_argument(std::string("Checksum kernel not supported on this CPU: ") +
+                                    ChecksumKernels::Name(kind));
+    }
+    return FnFor(kind);
+}
+
+} // namespace
+
+bool ChecksumKernels::IsSupported(ChecksumKernelKind kind) {
+    switch (kind) {
+        case ChecksumKernelKind::Auto:
+        case ChecksumKernelKind::Scalar:
+            return true;
+#if SAVEGENIE_X86_KERNELS
+        case ChecksumKernelKind::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case ChecksumKernelKind::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#if SAVEGENIE_NEON_KERNELS
+        case ChecksumKernelKind::NEON:
+            return true; // baseline on AArch64
+#endif
+        default:
+            return false;
+    }
+}
+
+std::uint32_t ChecksumKernels::Sum(std::span<const std::uint8_t> bytes) {
+    SumFn fn = g_activeFn.load(std::memory_order_acquire);
+    if (fn == nullptr) {
+        Select(ChecksumKernelKind::Auto);
+        fn = g_activeFn.load(std::memory_order_acquire);
+    }
+    SAVEGENIE_COUNT(ChecksumBytes, bytes.size());
+    return fn(bytes.data(), bytes.size());
+}
+
+std::uint32_t ChecksumKernels::SumWith(ChecksumKernelKind kind, std::span<const std::uint8_t> bytes) {
+    return RequireFn(kind)(bytes.data(), bytes.size());
+}
+
+void ChecksumKernels::Select(ChecksumKernelKind kind) {
+    const ChecksumKernelKind resolved = (kind == ChecksumKernelKind::Auto) ? BestSupported() : kind;
+    SumFn fn = RequireFn(resolved);
+    g_activeKind.store(static_cast<int>(resolved), std::memory_order_relaxed);
+    g_activeFn.store(fn, std::memory_order_release);
+}
+
+ChecksumKernelKind ChecksumKernels::Active() {
+    if (g_activeFn.load(std::memory_order_acquire) == nullptr) {
+        Select(ChecksumKernelKind::Auto);
+    }
+    return static_cast<ChecksumKernelKind>(g_activeKind.load(std::memory_order_relaxed));
+}
+
+const char* ChecksumKernels::Name(ChecksumKernelKind kind) {
+    switch (kind) {
+        case ChecksumKernelKind::Auto:   return "auto";
+        case ChecksumKernelKind::Scalar: return "scalar";
+        case ChecksumKernelKind::SSE2:   return "sse2";
+        case ChecksumKernelKind::AVX2:   return "avx2";
+        case ChecksumKernelKind::NEON:   return "neon";
+    }
+    return "unknown";
+}
+
+std::optional<ChecksumKernelKind> ChecksumKernels::Parse(std::string_view name) {
+    for (ChecksumKernelKind k : {ChecksumKernelKind::Auto, ChecksumKernelKind::Scalar, ChecksumKernelKind::SSE2,
+                                 ChecksumKernelKind::AVX2, ChecksumKernelKind::NEON}) {
+        if (name == Name(k)) return k;
+    }
+    return std::nullopt;
+}
+
+} // namespace savegenie
@@ -0,0 +1,716 @@
+//
+//  ColumnarExport.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of the columnar exporter: schema table, row building,
+//     row-group / footer writing, and the mapped reader.
+//
+
+#include "ColumnarExport.hpp"
+#include "BatchScanner.hpp"
+#include "ReadOnlyData.hpp"
+#include "SummarySink.hpp"
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace savegenie {
+
+// =========================================================
+// ExportSchema
+// =========================================================
+
+namespace {
+
+using Col = ExportSchema::Col;
+using T = ColumnType;
+using D = ExportDictionary;
+
+constexpr std::int16_t ParentOf(Col c) { return static_cast<std::int16_t>(c); }
+
+constexpr ColumnSpec Fixed(std::string_view name, T type, std::uint16_t count = 1, std::int16_t parent = -1,
+                           D dict = D::None) {
+    const std::uint16_t width = type == T::UInt8 ? 1 : type == T::UInt16 ? 2 : type == T::UInt32 ? 4 : 8;
+    return ColumnSpec{name, type, width, count, parent, dict};
+}
+
+constexpr ColumnSpec Bits(std::string_view name, std::size_t bytes) {
+    return ColumnSpec{name, T::Bytes, static_cast<std::uint16_t>(bytes), 1, -1, D::None};
+}
+
+constexpr ColumnSpec Variable(std::string_view name, T type, std::int16_t parent = -1) {
+    return ColumnSpec{name, type, 0, 1, parent, D::None};
+}
+
+// Order must match ExportSchema::Col. Child columns are named "<list>.<field>".
+constexpr std::array<ColumnSpec, ExportSchema::ColumnCount> kColumns = {{
+    Variable("path", T::Utf8),
+    Fixed("ok", T::UInt8),
+    Variable("error", T::Utf8),
+    Fixed("size", T::UInt32),
+    Fixed("trainer_id", T::UInt16),
+    Variable("trainer_name", T::Utf8),
+    Variable("rival_name", T::Utf8),
+    Fixed("money", T::UInt32),
+    Fixed("coins", T::UInt16),
+    Fixed("badges", T::UInt8),
+    Fixed("map", T::UInt8, 1, -1, D::Map),
+    Fixed("x", T::UInt8),
+    Fixed("y", T::UInt8),
+    Fixed("play_hours", T::UInt8),
+    Fixed("play_minutes", T::UInt8),
+    Fixed("play_seconds", T::UInt8),
+    Bits("dex_owned", Gen1Layout::PokedexBitsLen),
+    Bits("dex_seen", Gen1Layout::PokedexBitsLen),
+    Bits("event_flags", Gen1Layout::EventFlagsLen),
+    Fixed("main_checksum_stored", T::UInt8),
+    Fixed("main_checksum_computed", T::UInt8),
+    Fixed("bank_checksum_stored", T::UInt8, 2),
+    Fixed("bank_checksum_computed", T::UInt8, 2),
+    Fixed("box_checksum_stored", T::UInt8, 12),
+    Fixed("box_checksum_computed", T::UInt8, 12),
+    Fixed("box_count", T::UInt8, 12),
+    Fixed("box_average_level", T::Float64, 12),
+    Variable("bag", T::List),
+    Fixed("bag.item", T::UInt8, 1, ParentOf(Col::Bag), D::Item),
+    Fixed("bag.quantity", T::UInt8, 1, ParentOf(Col::Bag)),
+    Variable("pc_items", T::List),
+    Fixed("pc_items.item", T::UInt8, 1, ParentOf(Col::PcItems), D::Item),
+    Fixed("pc_items.quantity", T::UInt8, 1, ParentOf(Col::PcItems)),
+    Variable("hall_of_fame", T::List),
+    Fixed("hall_of_fame.entry", T::UInt8, 1, ParentOf(Col::HallOfFame)),
+    Variable("hall_of_fame.team", T::List, ParentOf(Col::HallOfFame)),
+    Fixed("hall_of_fame.team.species", T::UInt8, 1, ParentOf(Col::HallOfFameMons), D::Species),
+    Fixed("hall_of_fame.team.level", T::UInt8, 1, ParentOf(Col::HallOfFameMons)),
+    Variable("hall_of_fame.team.nickname", T::Utf8, ParentOf(Col::HallOfFameMons)),
+}};
+
+constexpr bool SchemaValid() {
+    for (std::size_t c = 0; c < kColumns.size(); ++c) {
+        const ColumnSpec& s = kColumns[c];
+        if (s.parent >= static_cast<std::int16_t>(c)) return false;
+        if (s.parent >= 0 && kColumns[static_cast<std::size_t>(s.parent)].type != T::List) return false;
+        if ((s.type == T::Utf8 || s.type == T::List) && (s.width != 0 || s.count != 1)) return false;
+    }
+    return true;
+}
+static_assert(SchemaValid(), "parents must be earlier List columns");
+
+bool IsFixed(ColumnType t) { return t != T::Utf8 && t != T::List; }
+
+void AppendLE(std::vector<std::uint8_t>& out, std::uint64_t v, std::size_t width) {
+    for (std::size_t i = 0; i < width; ++i) out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+}
+
+std::uint64_t LoadLE(const std::uint8_t* p, std::size_t width) {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < width; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    return v;
+}
+
+void AppendName(std::vector<std::uint8_t>& out, std::string_view s) {
+    AppendLE(out, s.size(), 2);
+    out.insert(out.end(), s.begin(), s.end());
+}
+
+} // namespace
+
+const std::array<ColumnSpec, ExportSchema::ColumnCount> ExportSchema::Columns = kColumns;
+
+std::string_view ExportSchema::DictionaryName(ExportDictionary d) {
+    switch (d) {
+    case ExportDictionary::Species: return "species";
+    case ExportDictionary::Item: return "item";
+    case ExportDictionary::Map: return "map";
+    case ExportDictionary::None: break;
+    }
+    return "";
+}
+
+// =========================================================
+// ExportRows
+// =========================================================
+
+ExportRows::ExportRows() {
+    Clear();
+}
+
+void ExportRows::Clear() {
+    for (std::size_t c = 0; c < ExportSchema::ColumnCount; ++c) {
+        columns_[c].data.clear();
+        columns_[c].offsets.clear();
+        if (!IsFixed(kColumns[c].type)) columns_[c].offsets.push_back(0);
+    }
+    rows_ = 0;
+    failed_ = 0;
+}
+
+std::size_t ExportRows::Values(std::size_t c) const {
+    const ColumnSpec& s = kColumns[c];
+    if (!IsFixed(s.type)) return columns_[c].offsets.size() - 1;
+    return columns_[c].data.size() / (static_cast<std::size_t>(s.width) * s.count);
+}
+
+void ExportRows::Put(Col c, std::uint64_t v) {
+    AppendLE(At(c).data, v, ExportSchema::Get(c).width);
+}
+
+void ExportRows::PutDouble(Col c, double v) {
+    AppendLE(At(c).data, std::bit_cast<std::uint64_t>(v), 8);
+}
+
+void ExportRows::PutBytes(Col c, std::span<const std::uint8_t> bytes) {
+    std::vector<std::uint8_t>& data = At(c).data;
+    const std::size_t width = ExportSchema::Get(c).width;
+    const std::size_t n = std::min(width, bytes.size());
+    data.insert(data.end(), bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(n));
+    data.resize(data.size() + (width - n), 0);
+}
+
+void ExportRows::PutText(Col c, std::string_view s) {
+    Buffer& b = At(c);
+    b.data.insert(b.data.end(), s.begin(), s.end());
+    b.offsets.push_back(static_cast<std::uint32_t>(b.data.size()));
+}
+
+void ExportRows::EndList(Col c, std::size_t elements) {
+    Buffer& b = At(c);
+    b.offsets.push_back(b.offsets.back() + static_cast<std::uint32_t>(elements));
+}
+
+void ExportRows::Append(std::string_view path, SaveView sv, const SaveSnapshot& snap) {
+    PutText(Col::Path, path);
+    Put(Col::Ok, 1);
+    PutText(Col::Error, {});
+    Put(Col::Size, sv.Size());
+
+    const TrainerSummary& t = snap.trainer;
+    Put(Col::TrainerId, t.trainerId);
+    PutText(Col::TrainerName, t.trainerName);
+    PutText(Col::RivalName, t.rivalName);
+    Put(Col::Money, t.money);
+    Put(Col::Coins, t.coins);
+    Put(Col::Badges, t.badges);
+    Put(Col::MapId, t.mapId);
+    Put(Col::X, t.x);
+    Put(Col::Y, t.y);
+    Put(Col::PlayHours, t.playHours);
+    Put(Col::PlayMinutes, t.playMinutes);
+    Put(Col::PlaySeconds, t.playSeconds);
+
+    // Raw bitfields: one column cell instead of index lists.
+    PutBytes(Col::DexOwned, sv.Subspan(Gen1Layout::PokedexOwnedOff, Gen1Layout::PokedexBitsLen));
+    PutBytes(Col::DexSeen, sv.Subspan(Gen1Layout::PokedexSeenOff, Gen1Layout::PokedexBitsLen));
+    PutBytes(Col::EventFlags, sv.Subspan(Gen1Layout::EventFlagsOff, Gen1Layout::EventFlagsLen));
+
+    const IntegrityReport& ir = snap.integrity;
+    Put(Col::MainChecksumStored, ir.mainStored);
+    Put(Col::MainChecksumComputed, ir.mainComputed);
+    for (std::size_t b = 0; b < 2; ++b) {
+        Put(Col::BankChecksumStored, ir.bankAllStored[b]);
+        Put(Col::BankChecksumComputed, ir.bankAllComputed[b]);
+    }
+    for (std::size_t b = 0; b < 12; ++b) {
+        Put(Col::BoxChecksumStored, ir.boxStored[b]);
+        Put(Col::BoxChecksumComputed, ir.boxComputed[b]);
+    }
+
+    for (const BoxStats& box : snap.boxes) {
+        Put(Col::BoxCount, static_cast<std::uint64_t>(box.pokemonCount));
+        PutDouble(Col::BoxAverageLevel, box.averageLevel);
+    }
+
+    for (const BagItem& item : snap.bag.items) {
+        Put(Col::BagItem, item.itemId);
+        Put(Col::BagQuantity, item.quantity);
+    }
+    EndList(Col::Bag, snap.bag.items.size());
+
+    for (const BagItem& item : snap.pcItemBox.items) {
+        Put(Col::PcItem, item.itemId);
+        Put(Col::PcQuantity, item.quantity);
+    }
+    EndList(Col::PcItems, snap.pcItemBox.items.size());
+
+    for (const HallOfFameEntry& entry : snap.hallOfFame) {
+        Put(Col::HallOfFameEntry, static_cast<std::uint64_t>(entry.entryIndex));
+        for (const HallOfFamePokemon& mon : entry.team) {
+            Put(Col::HallOfFameSpecies, mon.speciesId);
+            Put(Col::HallOfFameLevel, mon.level);
+            PutText(Col::HallOfFameNickname, mon.name.View());
+        }
+        EndList(Col::HallOfFameMons, entry.team.size());
+    }
+    EndList(Col::HallOfFame, snap.hallOfFame.size());
+
+    ++rows_;
+}
+
+void ExportRows::AppendFailed(std::string_view path, std::size_t size, std::string_view error) {
+    PutText(Col::Path, path);
+    Put(Col::Ok, 0);
+    PutText(Col::Error, error);
+    Put(Col::Size, size);
+
+    // Every other row-level column gets a zero / empty cell.
+    for (std::size_t c = static_cast<std::size_t>(Col::Size) + 1; c < ExportSchema::ColumnCount; ++c) {
+        const ColumnSpec& s = kColumns[c];
+        if (s.parent >= 0) continue;
+        Buffer& b = columns_[c];
+        if (s.type == T::Utf8) {
+            b.offsets.push_back(b.offsets.back());
+        } else if (s.type == T::List) {
+            b.offsets.push_back(b.offsets.back());
+        } else {
+            b.data.resize(b.data.size() + static_cast<std::size_t>(s.width) * s.count, 0);
+        }
+    }
+
+    ++rows_;
+    ++failed_;
+}
+
+void ExportRows::Extend(const ExportRows& other) {
+    for (std::size_t c = 0; c < ExportSchema::ColumnCount; ++c) {
+        Buffer& dst = columns_[c];
+        const Buffer& src = other.columns_[c];
+        if (kColumns[c].type == T::List) {
+            const std::uint32_t base = dst.offsets.back();
+            for (std::size_t i = 1; i < src.offsets.size(); ++i) dst.offsets.push_back(base + src.offsets[i]);
+            continue;
+        }
+        const std::uint32_t base = static_cast<std::uint32_t>(dst.data.size());
+        dst.data.insert(dst.data.end(), src.data.begin(), src.data.end());
+        if (kColumns[c].type == T::Utf8) {
+            for (std::size_t i = 1; i < src.offsets.size(); ++i) dst.offsets.push_back(base + src.offsets[i]);
+        }
+    }
+    rows_ += other.rows_;
+    failed_ += other.failed_;
+}
+
+void ExportRows::WriteColumn(std::size_t c, std::vector<std::uint8_t>& out) const {
+    const Buffer& b = columns_[c];
+    for (std::uint32_t off : b.offsets) AppendLE(out, off, 4);
+    out.insert(out.end(), b.data.begin(), b.data.end());
+}
+
+// =========================================================
+// ColumnarWriter
+// =========================================================
+
+ColumnarWriter::ColumnarWriter(std::string path)
+    : out_(std::move(path), "ColumnarWriter") {
+    std::vector<std::uint8_t> header = {'S', 'G', 'C', 'F'};
+    AppendLE(header, FormatVersion, 4);
+    Write(header);
+}
+
+void ColumnarWriter::Write(std::span<const std::uint8_t> bytes) {
+    out_.Write(bytes);
+    offset_ += bytes.size();
+}
+
+void ColumnarWriter::WriteRowGroup(std::span<const ExportRows> parts) {
+    const ExportRows* rows = nullptr;
+    if (parts.size() == 1) {
+        rows = &parts[0];
+    } else {
+        merged_.Clear();
+        for (const ExportRows& p : parts) merged_.Extend(p);
+        rows = &merged_;
+    }
+    if (rows->Rows() == 0) return;
+
+    groups_.push_back(GroupRef{offset_, static_cast<std::uint32_t>(rows->Rows())});
+    scratch_ = {'S', 'G', 'R', 'G'};
+    AppendLE(scratch_, rows->Rows(), 4);
+    Write(scratch_);
+
+    for (std::size_t c = 0; c < ExportSchema::ColumnCount; ++c) {
+        scratch_.clear();
+        AppendLE(scratch_, rows->Values(c), 8);
+        AppendLE(scratch_, 0, 8); // byte length, patched below
+        rows->WriteColumn(c, scratch_);
+        const std::uint64_t len = scratch_.size() - 16;
+        for (std::size_t i = 0; i < 8; ++i) scratch_[8 + i] = static_cast<std::uint8_t>(len >> (8 * i));
+        scratch_.resize(scratch_.size() + ((8 - (offset_ + scratch_.size()) % 8) % 8), 0);
+        Write(scratch_);
+    }
+}
+
+void ColumnarWriter::Finish() {
+    const std::uint64_t footerOffset = offset_;
+
+    std::vector<std::uint8_t> f;
+    AppendLE(f, ExportSchema::ColumnCount, 4);
+    for (const ColumnSpec& s : ExportSchema::Columns) {
+        AppendName(f, s.name);
+        AppendLE(f, static_cast<std::uint8_t>(s.type), 1);
+        AppendLE(f, s.width, 2);
+        AppendLE(f, s.count, 2);
+        AppendLE(f, static_cast<std::uint16_t>(s.parent), 2);
+        AppendLE(f, static_cast<std::uint8_t>(s.dictionary), 1);
+    }
+
+    AppendLE(f, ExportDictionaryCount, 4);
+    for (std::size_t d = 0; d < ExportDictionaryCount; ++d) {
+        const auto dict = static_cast<ExportDictionary>(d);
+        AppendName(f, ExportSchema::DictionaryName(dict));
+        AppendLE(f, 256, 4);
+        for (std::size_t id = 0; id < 256; ++id) {
+            const u8 key = static_cast<u8>(id);
+            const std::string_view name = dict == ExportDictionary::Species ? Gen1SpeciesLookup::NameViewFromId(key)
+                                          : dict == ExportDictionary::Item  ? Gen1ItemLookup::NameViewFromId(key)
+                                                                            : Gen1MapLookup::NameViewFromId(key);
+            AppendName(f, name);
+        }
+    }
+
+    AppendLE(f, groups_.size(), 4);
+    for (const GroupRef& g : groups_) {
+        AppendLE(f, g.offset, 8);
+        AppendLE(f, g.rows, 4);
+    }
+
+    AppendLE(f, footerOffset, 8);
+    f.insert(f.end(), {'S', 'G', 'C', 'F'});
+    Write(f);
+
+    out_.Commit();
+}
+
+// =========================================================
+// ColumnarReader
+// =========================================================
+
+namespace {
+
+// Bounds-checked little-endian cursor over the mapped file.
+class Cursor {
+public:
+    Cursor(std::span<const std::uint8_t> bytes, std::size_t at, const std::string& path)
+        : bytes_(bytes), at_(at), path_(path) {}
+
+    std::uint64_t Read(std::size_t width) {
+        Need(width);
+        const std::uint64_t v = LoadLE(bytes_.data() + at_, width);
+        at_ += width;
+        return v;
+    }
+
+    std::span<const std::uint8_t> Take(std::uint64_t n) {
+        Need(n);
+        const auto s = bytes_.subspan(at_, static_cast<std::size_t>(n));
+        at_ += static_cast<std::size_t>(n);
+        return s;
+    }
+
+    std::string_view Name() {
+        const auto s = Take(Read(2));
+        return std::string_view(reinterpret_cast<const char*>(s.data()), s.size());
+    }
+
+    void Align8() { at_ = std::min(bytes_.size(), (at_ + 7) & ~static_cast<std::size_t>(7)); }
+
+    [[noreturn]] void Fail(const std::string& what) const {
+        throw std::runtime_error("ColumnarReader failed: " + what + ": " + path_);
+    }
+
+private:
+    std::span<const std::uint8_t> bytes_;
+    std::size_t at_;
+    const std::string& path_;
+
+    void Need(std::uint64_t n) const {
+        if (n > bytes_.size() - at_) Fail("truncated file");
+    }
+};
+
+std::size_t FixedStride(const ColumnSpec& s) { return static_cast<std::size_t>(s.width) * s.count; }
+
+// The only width a fixed-width value of type t may have (Bytes: any but 0).
+std::uint16_t ValueWidth(ColumnType t, std::uint16_t stored) {
+    switch (t) {
+        case T::UInt8: return 1;
+        case T::UInt16: return 2;
+        case T::UInt32: return 4;
+        case T::Float64: return 8;
+        default: return stored == 0 ? 1 : stored;
+    }
+}
+
+} // namespace
+
+std::uint64_t ColumnarReader::Chunk::UInt(const ColumnSpec& spec, std::size_t i, std::size_t j) const {
+    return LoadLE(bytes.data() + i * FixedStride(spec) + j * spec.width, spec.width);
+}
+
+double ColumnarReader::Chunk::Float(const ColumnSpec& spec, std::size_t i, std::size_t j) const {
+    return std::bit_cast<double>(UInt(spec, i, j));
+}
+
+std::span<const std::uint8_t> ColumnarReader::Chunk::Raw(const ColumnSpec& spec, std::size_t i) const {
+    return bytes.subspan(i * FixedStride(spec), FixedStride(spec));
+}
+
+std::uint32_t ColumnarReader::Chunk::Offset(std::size_t i) const {
+    return static_cast<std::uint32_t>(LoadLE(bytes.data() + 4 * i, 4));
+}
+
+std::string_view ColumnarReader::Chunk::Text(std::size_t i) const {
+    const std::size_t base = 4 * (values + 1);
+    const std::uint32_t begin = Offset(i);
+    const std::uint32_t end = Offset(i + 1);
+    return std::string_view(reinterpret_cast<const char*>(bytes.data() + base + begin), end - begin);
+}
+
+ColumnarReader ColumnarReader::Open(const std::string& path) {
+    ColumnarReader r;
+    r.file_ = MappedFile::Open(path);
+    const std::span<const std::uint8_t> bytes = r.file_.Bytes();
+
+    Cursor head(bytes, 0, path);
+    if (bytes.size() < 20 || std::memcmp(bytes.data(), "SGCF", 4) != 0 ||
+        std::memcmp(bytes.data() + bytes.size() - 4, "SGCF", 4) != 0) {
+        head.Fail("not a columnar export");
+    }
+    head.Take(4);
+    if (head.Read(4) != ColumnarWriter::FormatVersion) head.Fail("unsupported format version");
+
+    const std::uint64_t footerOffset = LoadLE(bytes.data() + bytes.size() - 12, 8);
+    if (footerOffset > bytes.size() - 12) head.Fail("bad footer offset");
+    Cursor f(bytes.first(bytes.size() - 12), static_cast<std::size_t>(footerOffset), path);
+
+    const std::uint64_t columnCount = f.Read(4);
+    for (std::uint64_t c = 0; c < columnCount; ++c) {
+        ColumnSpec s;
+        s.name = f.Name();
+        const std::uint64_t type = f.Read(1);
+        s.width = static_cast<std::uint16_t>(f.Read(2));
+        s.count = static_cast<std::uint16_t>(f.Read(2));
+        s.parent = static_cast<std::int16_t>(f.Read(2));
+        s.dictionary = static_cast<ExportDictionary>(static_cast<std::int8_t>(f.Read(1)));
+        if (type > static_cast<std::uint64_t>(ColumnType::List)) f.Fail("unknown column type");
+        s.type = static_cast<ColumnType>(type);
+        if (s.parent >= static_cast<std::int64_t>(c) ||
+            (s.parent >= 0 && r.columns_[static_cast<std::size_t>(s.parent)].type != ColumnType::List)) {
+            f.Fail("bad column parent");
+        }
+        if (IsFixed(s.type) && (s.count == 0 || s.width != ValueWidth(s.type, s.width))) f.Fail("bad column width");
+        const int dict = static_cast<int>(s.dictionary);
+        if (dict < static_cast<int>(ExportDictionary::None) || dict >= static_cast<int>(ExportDictionaryCount)) {
+            f.Fail("bad dictionary");
+        }
+        r.columns_.push_back(s);
+    }
+
+    const std::uint64_t dictCount = f.Read(4);
+    for (std::uint64_t d = 0; d < dictCount; ++d) {
+        const std::string_view name = f.Name();
+        const std::uint64_t entries = f.Read(4);
+        std::vector<std::string_view>* target = nullptr;
+        for (std::size_t k = 0; k < ExportDictionaryCount; ++k) {
+            if (ExportSchema::DictionaryName(static_cast<ExportDictionary>(k)) == name) target = &r.dictionaries_[k];
+        }
+        for (std::uint64_t e = 0; e < entries; ++e) {
+            const std::string_view entry = f.Name();
+            if (target) target->push_back(entry); // unknown dictionaries are skipped
+        }
+    }
+
+    const std::uint64_t groupCount = f.Read(4);
+    for (std::uint64_t g = 0; g < groupCount; ++g) {
+        const std::uint64_t offset = f.Read(8);
+        const std::uint64_t rows = f.Read(4);
+        if (offset > footerOffset) f.Fail("bad row group offset");
+
+        Cursor c(bytes.first(static_cast<std::size_t>(footerOffset)), static_cast<std::size_t>(offset), path);
+        const auto magic = c.Take(4);
+        if (std::memcmp(magic.data(), "SGRG", 4) != 0 || c.Read(4) != rows) c.Fail("bad row group header");
+
+        Group group;
+        group.rows = static_cast<std::size_t>(rows);
+        for (const ColumnSpec& s : r.columns_) {
+            Chunk chunk;
+            chunk.values = static_cast<std::size_t>(c.Read(8));
+            chunk.bytes = c.Take(c.Read(8));
+            c.Align8();
+
+            // Lengths must agree with the parent, offsets must stay in range.
+            const std::size_t expected = s.parent < 0 ? group.rows : [&] {
+                const Chunk& p = group.chunks[static_cast<std::size_t>(s.parent)];
+                return static_cast<std::size_t>(p.Offset(p.values));
+            }();
+            if (chunk.values != expected) c.Fail("column '" + std::string(s.name) + "' has the wrong length");
+            if (IsFixed(s.type)) {
+                if (chunk.bytes.size() != chunk.values * FixedStride(s)) c.Fail("bad column size");
+            } else {
+                const std::size_t offsetBytes = 4 * (chunk.values + 1);
+                if (chunk.bytes.size() < offsetBytes || chunk.Offset(0) != 0) c.Fail("bad offsets");
+                for (std::size_t i = 0; i < chunk.values; ++i) {
+                    if (chunk.Offset(i + 1) < chunk.Offset(i)) c.Fail("bad offsets");
+                }
+                const std::size_t limit = s.type == ColumnType::Utf8 ? chunk.bytes.size() - offsetBytes : SIZE_MAX;
+                if (chunk.Offset(chunk.values) > limit) c.Fail("bad offsets");
+            }
+            group.chunks.push_back(chunk);
+        }
+        r.groups_.push_back(std::move(group));
+    }
+    return r;
+}
+
+std::size_t ColumnarReader::Rows() const {
+    std::size_t n = 0;
+    for (const Group& g : groups_) n += g.rows;
+    return n;
+}
+
+std::string_view ColumnarReader::DictionaryEntry(ExportDictionary d, std::size_t id) const {
+    if (d == ExportDictionary::None) return {};
+    const auto& dict = dictionaries_[static_cast<std::size_t>(d)];
+    return id < dict.size() ? dict[id] : std::string_view();
+}
+
+void ColumnarReader::WriteElement(SummarySink& sink, std::size_t g, int parent, std::size_t i) const {
+    static constexpr char kHex[] = "0123456789abcdef";
+
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const ColumnSpec& s = columns_[c];
+        if (s.parent != parent) continue;
+        const Chunk& chunk = groups_[g].chunks[c];
+        const std::size_t dot = s.name.rfind('.');
+        const std::string_view key = dot == std::string_view::npos ? s.name : s.name.substr(dot + 1);
+
+        switch (s.type) {
+        case ColumnType::Utf8:
+            sink.String(key, chunk.Text(i));
+            break;
+        case ColumnType::List:
+            sink.BeginArray(key);
+            for (std::uint32_t e = chunk.Offset(i); e < chunk.Offset(i + 1); ++e) {
+                sink.BeginObject({});
+                WriteElement(sink, g, static_cast<int>(c), e);
+                sink.EndObject();
+            }
+            sink.EndArray();
+            break;
+        case ColumnType::Bytes: {
+            std::string hex;
+            for (std::uint8_t b : chunk.Raw(s, i)) {
+                hex.push_back(kHex[b >> 4]);
+                hex.push_back(kHex[b & 0xF]);
+            }
+            sink.String(key, hex);
+            break;
+        }
+        default:
+            if (s.count == 1) {
+                if (s.type == ColumnType::Float64) {
+                    sink.Double(key, chunk.Float(s, i));
+                } else {
+                    sink.Uint(key, chunk.UInt(s, i));
+                }
+                if (s.dictionary != ExportDictionary::None) {
+                    sink.String(std::string(key) + "_name", DictionaryEntry(s.dictionary, chunk.UInt(s, i)));
+                }
+            } else {
+                sink.BeginArray(key);
+                for (std::size_t j = 0; j < s.count; ++j) {
+                    if (s.type == ColumnType::Float64) {
+                        sink.Double({}, chunk.Float(s, i, j));
+                    } else {
+                        sink.Uint({}, chunk.UInt(s, i, j));
+                    }
+                }
+                sink.EndArray();
+            }
+            break;
+        }
+    }
+}
+
+void ColumnarReader::WriteRecords(SummarySink& sink, OutputBuffer* out) const {
+    for (std::size_t g = 0; g < groups_.size(); ++g) {
+        for (std::size_t i = 0; i < groups_[g].rows; ++i) {
+            sink.BeginRecord();
+            WriteElement(sink, g, -1, i);
+            sink.EndRecord();
+            if (out) out->RecordBoundary();
+        }
+    }
+}
+
+// =========================================================
+// ColumnarExport
+// =========================================================
+
+std::string ExportStats::ToString() const {
+    std::ostringstream oss;
+    oss << "Exported " << rows << " save(s) (" << failed << " failed) in " << rowGroups << " row group(s), "
+        << bytesWritten << " bytes, on " << threads << " thread(s) in " << std::fixed << std::setprecision(3)
+        << seconds << "s -> " << std::setprecision(1) << (seconds > 0.0 ? static_cast<double>(rows) / seconds : 0.0)
+        << " saves/sec";
+    return oss.str();
+}
+
+ExportStats ColumnarExport::Run(const ExportOptions& opts) {
+    using Clock = std::chrono::steady_clock;
+    const auto t0 = Clock::now();
+
+    ExportStats stats;
+    stats.threads = WorkStealingPool::ResolveThreadCount(opts.threads);
+
+    const std::vector<std::string> files = BatchScanner::CollectInputs(opts.inputs, opts.recursive);
+    ColumnarWriter writer(opts.outPath);
+
+    // One slice (contiguous rows) and one scratch snapshot per worker.
+    std::vector<ExportRows> parts(stats.threads);
+    std::vector<SaveSnapshot> snapshots(stats.threads);
+    const std::size_t groupRows = std::max<std::size_t>(1, opts.rowGroupRows);
+
+    for (std::size_t start = 0; start < files.size(); start += groupRows) {
+        const std::size_t n = std::min(groupRows, files.size() - start);
+        const std::size_t slice = (n + stats.threads - 1) / stats.threads;
+        for (ExportRows& p : parts) p.Clear();
+
+        WorkStealingPool::ParallelFor(stats.threads, stats.threads, [&](unsigned w, std::size_t s) {
+            const std::size_t begin = start + std::min(n, s * slice);
+            const std::size_t end = start + std::min(n, (s + 1) * slice);
+            for (std::size_t i = begin; i < end; ++i) {
+                std::size_t size = 0;
+                try {
+                    const MappedFile mapped = MappedFile::Open(files[i]);
+                    const SaveView view(mapped.Bytes());
+                    size = view.Size();
+                    ReadOnlyData(view).DecodeAll(snapshots[w]);
+                    parts[s].Append(files[i], view, snapshots[w]);
+                } catch (const std::exception& e) {
+                    parts[s].AppendFailed(files[i], size, e.what());
+                }
+            }
+        });
+
+        writer.WriteRowGroup(parts);
+        stats.rowGroups++;
+        for (const ExportRows& p : parts) {
+            stats.rows += p.Rows();
+            stats.failed += p.Failed();
+        }
+    }
+
+    writer.Finish();
+    stats.bytesWritten = writer.BytesWritten();
+    stats.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    return stats;
+}
+
+} // namespace savegenie
@@ -0,0 +1,153 @@
+//
+//  ContentHash.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - XXH64 (four 64-bit lanes over 32-byte stripes, then tail + avalanche)
+//     and SaveDigest.
+//
+
+#include "ContentHash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace savegenie {
+
+// =========================================================
+// ContentHash (XXH64)
+// =========================================================
+
+namespace {
+
+constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t P3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+std::uint64_t Load64(const std::uint8_t* p) {
+    std::uint64_t v = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&v, p, 8);
+    } else {
+        for (int i = 0; i < 8; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    }
+    return v;
+}
+
+std::uint32_t Load32(const std::uint8_t* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t Round(std::uint64_t acc, std::uint64_t input) {
+    acc += input * P2;
+    acc = std::rotl(acc, 31);
+    return acc * P1;
+}
+
+std::uint64_t MergeRound(std::uint64_t acc, std::uint64_t lane) {
+    acc ^= Round(0, lane);
+    return acc * P1 + P4;
+}
+
+} // namespace
+
+std::uint64_t ContentHash::Hash64(std::span<const std::uint8_t> bytes, std::uint64_t seed) {
+    const std::uint8_t* p = bytes.data();
+    const std::uint8_t* const end = p + bytes.size();
+    std::uint64_t h = 0;
+
+    if (bytes.size() >= 32) {
+        std::uint64_t v1 = seed + P1 + P2;
+        std::uint64_t v2 = seed + P2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - P1;
+
+        const std::uint8_t* const limit = end - 32;
+        do {
+            v1 = Round(v1, Load64(p));
+            v2 = Round(v2, Load64(p + 8));
+            v3 = Round(v3, Load64(p + 16));
+            v4 = Round(v4, Load64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+        h = MergeRound(h, v1);
+        h = MergeRound(h, v2);
+        h = MergeRound(h, v3);
+        h = MergeRound(h, v4);
+    } else {
+        h = seed + P5;
+    }
+
+    h += static_cast<std::uint64_t>(bytes.size());
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= Round(0, Load64(p));
+        h = std::rotl(h, 27) * P1 + P4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<std::uint64_t>(Load32(p)) * P1;
+        h = std::rotl(h, 23) * P2 + P3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<std::uint64_t>(*p) * P5;
+        h = std::rotl(h, 11) * P1;
+    }
+
+    // Avalanche
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+// =========================================================
+// SaveDigest
+// =========================================================
+
+SaveDigest SaveDigest::Of(SaveView sv) {
+    const std::span<const u8> bytes = sv.Span();
+
+    SaveDigest d;
+    d.size = bytes.size();
+
+    for (std::size_t b = 0; b < BankCount; ++b) {
+        const std::size_t off = std::min(bytes.size(), b * Gen1Layout::BankSize);
+        const std::size_t len = std::min(bytes.size() - off, Gen1Layout::BankSize);
+        d.banks[b] = ContentHash::Hash64(bytes.subspan(off, len), b);
+    }
+
+    // Whole = hash of (bank hashes, size, any bytes past the last bank), so
+    // the 32 KiB are only read once.
+    std::array<u8, (BankCount + 1) * 8> mix{};
+    for (std::size_t b = 0; b <= BankCount; ++b) {
+        const std::uint64_t v = (b < BankCount) ? d.banks[b] : static_cast<std::uint64_t>(d.size);
+        for (int i = 0; i < 8; ++i) mix[b * 8 + static_cast<std::size_t>(i)] = static_cast<u8>(v >> (8 * i));
+    }
+    d.whole = ContentHash::Hash64(mix);
+
+    const std::size_t covered = BankCount * Gen1Layout::BankSize;
+    if (bytes.size() > covered) {
+        d.whole = ContentHash::Hash64(bytes.subspan(covered), d.whole);
+    }
+    return d;
+}
+
+std::string SaveDigest::WholeHex() const {
+    static const char* kHex = "0123456789abcdef";
+    std::string out(16, '0');
+    for (int i = 0; i < 16; ++i) {
+        out[static_cast<std::size_t>(15 - i)] = kHex[(whole >> (4 * i)) & 0xF];
+    }
+    return out;
+}
+
+} // namespace savegenie
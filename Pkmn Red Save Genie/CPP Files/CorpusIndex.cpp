@@ -0,0 +1,501 @@
+//
+//  CorpusIndex.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of CorpusIndex: column layout, incremental update and
+//     lookups over the mapped file.
+//
+//  Notes:
+//   - Cells are read with memcpy-style little-endian loads, so the mapping
+//     needs no alignment and the file is portable across hosts.
+//
+
+#include "CorpusIndex.hpp"
+#include "BatchScanner.hpp"
+#include "ContentHash.hpp"
+#include "Gen1Fields.hpp"
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace savegenie {
+
+// =========================================================
+// Layout
+// =========================================================
+
+namespace {
+
+using Column = CorpusIndex::Column;
+
+constexpr char kMagic[4] = {'S', 'G', 'I', 'X'};
+constexpr std::size_t kDexBytes = Gen1Layout::PokedexBitsLen;
+constexpr std::size_t kHeaderSize = 4 + 4 + 8 + 8 + 8 + 8 * CorpusIndex::ColumnCount;
+
+constexpr std::array<std::size_t, CorpusIndex::ColumnCount> kWidth = {
+    8,         // Path
+    8,         // FileSize
+    8,         // Mtime
+    8,         // Hash
+    1,         // Ok
+    2,         // TrainerId
+    1,         // Badges
+    4,         // Money
+    8,         // TrainerName
+    8,         // RivalName
+    kDexBytes, // Owned
+    kDexBytes, // Seen
+    4,         // ById
+};
+
+constexpr std::size_t Width(Column c) { return kWidth[static_cast<std::size_t>(c)]; }
+
+constexpr std::size_t Align8(std::size_t n) { return (n + 7) & ~static_cast<std::size_t>(7); }
+
+std::uint64_t LoadLE(const std::uint8_t* p, std::size_t width) {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < width; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    return v;
+}
+
+void StoreLE(std::uint8_t* p, std::uint64_t v, std::size_t width) {
+    for (std::size_t i = 0; i < width; ++i) p[i] = static_cast<std::uint8_t>(v >> (8 * i));
+}
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(a[i])) != std::toupper(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A row being built (owns its strings until the file is written).
+struct Entry {
+    std::string path;
+    std::uint64_t fileSize = 0;
+    std::int64_t mtime = 0;
+    std::uint64_t hash = 0;
+    bool ok = false;
+    std::uint16_t trainerId = 0;
+    std::uint8_t badges = 0;
+    std::uint32_t money = 0;
+    std::string trainerName;
+    std::string rivalName;
+    std::array<std::uint8_t, kDexBytes> owned{};
+    std::array<std::uint8_t, kDexBytes> seen{};
+};
+
+enum class Outcome : std::uint8_t { Unchanged, Rehashed, Parsed, Failed };
+
+// Copies everything but the path / stat fields from a previous row.
+void CopyFields(const IndexRow& r, std::span<const std::uint8_t> ownedBytes, std::span<const std::uint8_t> seenBytes,
+                Entry& e) {
+    e.hash = r.hash;
+    e.ok = r.ok;
+    e.trainerId = r.trainerId;
+    e.badges = r.badges;
+    e.money = r.money;
+    e.trainerName.assign(r.trainerName);
+    e.rivalName.assign(r.rivalName);
+    std::copy(ownedBytes.begin(), ownedBytes.end(), e.owned.begin());
+    std::copy(seenBytes.begin(), seenBytes.end(), e.seen.begin());
+}
+
+// Reads the indexed fields straight from the save (no summary is built).
+void Parse(SaveView sv, Entry& e) {
+    try {
+        e.trainerId = TrainerIdField::Read(sv);
+        e.badges = FieldCodec<Gen1Field::Badges>::Read(sv);
+        e.money = MoneyField::Read(sv);
+        e.trainerName.assign(TrainerNameField::Read(sv).View());
+        e.rivalName.assign(RivalNameField::Read(sv).View());
+        using Owned = FieldCodec<Gen1Field::PokedexOwned>;
+        using Seen = FieldCodec<Gen1Field::PokedexSeen>;
+        const auto owned = sv.Subspan(Owned::Off, Owned::Len);
+        const auto seen = sv.Subspan(Seen::Off, Seen::Len);
+        std::copy(owned.begin(), owned.end(), e.owned.begin());
+        std::copy(seen.begin(), seen.end(), e.seen.begin());
+        e.ok = true;
+    } catch (const std::exception&) {
+        // Too short / not a save: keep the row (so it is not re-read until it
+        // changes) with zeroed fields.
+        e.ok = false;
+        e.trainerId = 0;
+        e.badges = 0;
+        e.money = 0;
+        e.trainerName.clear();
+        e.rivalName.clear();
+        e.owned.fill(0);
+        e.seen.fill(0);
+    }
+}
+
+std::vector<std::uint8_t> Serialize(const std::vector<Entry>& entries) {
+    const std::size_t rows = entries.size();
+
+    std::array<std::size_t, CorpusIndex::ColumnCount> offset{};
+    std::size_t at = Align8(kHeaderSize);
+    for (std::size_t c = 0; c < CorpusIndex::ColumnCount; ++c) {
+        offset[c] = at;
+        at = Align8(at + rows * kWidth[c]);
+    }
+    const std::size_t heapOffset = at;
+    std::size_t heapBytes = 0;
+    for (const Entry& e : entries) heapBytes += e.path.size() + e.trainerName.size() + e.rivalName.size();
+    if (heapBytes > UINT32_MAX || rows > UINT32_MAX) {
+        throw std::runtime_error("CorpusIndex failed: index too large");
+    }
+
+    std::vector<std::uint8_t> out(heapOffset + heapBytes, 0);
+    std::uint8_t* base = out.data();
+
+    std::memcpy(base, kMagic, 4);
+    StoreLE(base + 4, CorpusIndex::Version, 4);
+    StoreLE(base + 8, rows, 8);
+    StoreLE(base + 16, heapOffset, 8);
+    StoreLE(base + 24, heapBytes, 8);
+    for (std::size_t c = 0; c < CorpusIndex::ColumnCount; ++c) StoreLE(base + 32 + 8 * c, offset[c], 8);
+
+    auto cell = [&](Column c, std::size_t row) {
+        return base + offset[static_cast<std::size_t>(c)] + row * Width(c);
+    };
+
+    std::size_t heapAt = 0;
+    auto putText = [&](Column c, std::size_t row, std::string_view s) {
+        std::memcpy(base + heapOffset + heapAt, s.data(), s.size());
+        StoreLE(cell(c, row), heapAt, 4);
+        StoreLE(cell(c, row) + 4, s.size(), 4);
+        heapAt += s.size();
+    };
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        const Entry& e = entries[r];
+        putText(Column::Path, r, e.path);
+        StoreLE(cell(Column::FileSize, r), e.fileSize, 8);
+        StoreLE(cell(Column::Mtime, r), static_cast<std::uint64_t>(e.mtime), 8);
+        StoreLE(cell(Column::Hash, r), e.hash, 8);
+        StoreLE(cell(Column::Ok, r), e.ok ? 1 : 0, 1);
+        StoreLE(cell(Column::TrainerId, r), e.trainerId, 2);
+        StoreLE(cell(Column::Badges, r), e.badges, 1);
+        StoreLE(cell(Column::Money, r), e.money, 4);
+        putText(Column::TrainerName, r, e.trainerName);
+        putText(Column::RivalName, r, e.rivalName);
+        std::memcpy(cell(Column::Owned, r), e.owned.data(), kDexBytes);
+        std::memcpy(cell(Column::Seen, r), e.seen.data(), kDexBytes);
+    }
+
+    // Rows are already in path order, so a stable sort keeps ties in path order.
+    std::vector<std::uint32_t> byId(rows);
+    std::iota(byId.begin(), byId.end(), 0u);
+    std::stable_sort(byId.begin(), byId.end(),
+                     [&](std::uint32_t a, std::uint32_t b) { return entries[a].trainerId < entries[b].trainerId; });
+    for (std::size_t k = 0; k < rows; ++k) StoreLE(cell(Column::ById, k), byId[k], 4);
+
+    return out;
+}
+
+// Stat fields of a row whose file could not be read: never equal to a real
+// file's, so the next update reads it again.
+constexpr std::int64_t kUnreadMtime = INT64_MIN;
+
+std::int64_t MtimeTicks(const std::filesystem::file_time_type& t) {
+    return static_cast<std::int64_t>(t.time_since_epoch().count());
+}
+
+} // namespace
+
+// =========================================================
+// IndexUpdateStats
+// =========================================================
+
+std::string IndexUpdateStats::ToString() const {
+    std::ostringstream oss;
+    oss << "Indexed " << rows << " save(s): " << unchanged << " unchanged, " << rehashed << " rehashed, " << parsed
+        << " parsed (" << failed << " failed), " << kept << " kept, " << removed << " removed in " << std::fixed << std::setprecision(3)
+        << seconds << "s";
+    if (rebuilt) oss << " (new index)";
+    return oss.str();
+}
+
+// =========================================================
+// CorpusIndex (reading)
+// =========================================================
+
+CorpusIndex CorpusIndex::Open(const std::string& path) {
+    CorpusIndex idx;
+    idx.file_ = MappedFile::Open(path);
+    const std::span<const std::uint8_t> bytes = idx.file_.Bytes();
+
+    auto fail = [&](const std::string& what) -> void {
+        throw std::runtime_error("CorpusIndex failed: " + what + ": " + path);
+    };
+
+    if (bytes.size() < kHeaderSize || std::memcmp(bytes.data(), kMagic, 4) != 0) fail("not an index file");
+    if (LoadLE(bytes.data() + 4, 4) != Version) fail("unsupported index version");
+
+    const std::uint64_t rows = LoadLE(bytes.data() + 8, 8);
+    const std::uint64_t heapOffset = LoadLE(bytes.data() + 16, 8);
+    const std::uint64_t heapBytes = LoadLE(bytes.data() + 24, 8);
+    if (rows > UINT32_MAX || heapOffset > bytes.size() || heapBytes > bytes.size() - heapOffset) fail("corrupt header");
+
+    idx.rows_ = static_cast<std::size_t>(rows);
+    idx.heap_ = bytes.subspan(static_cast<std::size_t>(heapOffset), static_cast<std::size_t>(heapBytes));
+    for (std::size_t c = 0; c < ColumnCount; ++c) {
+        const std::uint64_t off = LoadLE(bytes.data() + 32 + 8 * c, 8);
+        const std::uint64_t len = rows * kWidth[c];
+        if (off < kHeaderSize || off > bytes.size() || len > bytes.size() - off) fail("corrupt column table");
+        idx.columns_[c] = bytes.subspan(static_cast<std::size_t>(off), static_cast<std::size_t>(len));
+    }
+    return idx;
+}
+
+const std::uint8_t* CorpusIndex::Cell(Column c, std::size_t row, std::size_t width) const {
+    return columns_[static_cast<std::size_t>(c)].data() + row * width;
+}
+
+std::string_view CorpusIndex::Text(Column c, std::size_t row) const {
+    const std::uint8_t* p = Cell(c, row, 8);
+    const std::uint64_t off = LoadLE(p, 4);
+    const std::uint64_t len = LoadLE(p + 4, 4);
+    if (off > heap_.size() || len > heap_.size() - off) return {}; // corrupt ref: read as empty
+    return std::string_view(reinterpret_cast<const char*>(heap_.data() + off), static_cast<std::size_t>(len));
+}
+
+std::uint16_t CorpusIndex::TrainerIdAt(std::size_t row) const {
+    return static_cast<std::uint16_t>(LoadLE(Cell(Column::TrainerId, row, 2), 2));
+}
+
+IndexRow CorpusIndex::Row(std::size_t i) const {
+    if (i >= rows_) throw std::out_of_range("CorpusIndex::Row: row out of range");
+    IndexRow r;
+    r.path = Text(Column::Path, i);
+    r.fileSize = LoadLE(Cell(Column::FileSize, i, 8), 8);
+    r.mtime = static_cast<std::int64_t>(LoadLE(Cell(Column::Mtime, i, 8), 8));
+    r.hash = LoadLE(Cell(Column::Hash, i, 8), 8);
+    r.ok = *Cell(Column::Ok, i, 1) != 0;
+    r.trainerId = TrainerIdAt(i);
+    r.badges = *Cell(Column::Badges, i, 1);
+    r.money = static_cast<std::uint32_t>(LoadLE(Cell(Column::Money, i, 4), 4));
+    r.trainerName = Text(Column::TrainerName, i);
+    r.rivalName = Text(Column::RivalName, i);
+    r.owned = Gen1Bitset(std::span<const std::uint8_t>(Cell(Column::Owned, i, kDexBytes), kDexBytes),
+                         Gen1Layout::PokedexSpeciesCount);
+    r.seen = Gen1Bitset(std::span<const std::uint8_t>(Cell(Column::Seen, i, kDexBytes), kDexBytes),
+                        Gen1Layout::PokedexSpeciesCount);
+    return r;
+}
+
+std::optional<std::size_t> CorpusIndex::FindPath(std::string_view path) const {
+    std::size_t lo = 0, hi = rows_;
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (Text(Column::Path, mid) < path) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < rows_ && Text(Column::Path, lo) == path) return lo;
+    return std::nullopt;
+}
+
+std::vector<std::size_t> CorpusIndex::WithTrainerId(std::uint16_t id) const {
+    auto rowAt = [&](std::size_t k) { return static_cast<std::size_t>(LoadLE(Cell(Column::ById, k, 4), 4)); };
+
+    std::size_t lo = 0, hi = rows_;
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        const std::size_t row = rowAt(mid);
+        if (row < rows_ && TrainerIdAt(row) < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    std::vector<std::size_t> out;
+    for (std::size_t k = lo; k < rows_; ++k) {
+        const std::size_t row = rowAt(k);
+        if (row >= rows_ || TrainerIdAt(row) != id) break;
+        out.push_back(row);
+    }
+    return out;
+}
+
+bool CorpusIndex::Matches(std::size_t row, const IndexFilter& f) const {
+    // Cheapest columns first.
+    if (f.okOnly && *Cell(Column::Ok, row, 1) == 0) return false;
+    if (f.trainerId && TrainerIdAt(row) != *f.trainerId) return false;
+    if (f.minBadges && static_cast<std::size_t>(std::popcount(*Cell(Column::Badges, row, 1))) < f.minBadges) {
+        return false;
+    }
+    if (f.ownsDex || f.minOwned) {
+        const Gen1Bitset owned(std::span<const std::uint8_t>(Cell(Column::Owned, row, kDexBytes), kDexBytes),
+                               Gen1Layout::PokedexSpeciesCount);
+        if (f.ownsDex && (*f.ownsDex == 0 || !owned.Test(*f.ownsDex - 1))) return false;
+        if (f.minOwned && owned.Count() < f.minOwned) return false;
+    }
+    if (f.minSeen) {
+        const Gen1Bitset seen(std::span<const std::uint8_t>(Cell(Column::Seen, row, kDexBytes), kDexBytes),
+                              Gen1Layout::PokedexSpeciesCount);
+        if (seen.Count() < f.minSeen) return false;
+    }
+    if (!f.trainerName.empty() && !EqualsIgnoreCase(Text(Column::TrainerName, row), f.trainerName)) return false;
+    if (!f.rivalName.empty() && !EqualsIgnoreCase(Text(Column::RivalName, row), f.rivalName)) return false;
+    return true;
+}
+
+std::vector<std::size_t> CorpusIndex::Find(const IndexFilter& filter) const {
+    std::vector<std::size_t> out;
+    if (filter.trainerId) {
+        for (std::size_t row : WithTrainerId(*filter.trainerId)) {
+            if (Matches(row, filter)) out.push_back(row);
+        }
+        return out;
+    }
+    for (std::size_t row = 0; row < rows_; ++row) {
+        if (Matches(row, filter)) out.push_back(row);
+    }
+    return out;
+}
+
+// =========================================================
+// CorpusIndex (updating)
+// =========================================================
+
+IndexUpdateStats CorpusIndex::Update(const std::string& indexPath, const std::vector<std::string>& inputs,
+                                     const IndexUpdateOptions& opts) {
+    namespace fs = std::filesystem;
+    using Clock = std::chrono::steady_clock;
+
+    const auto t0 = Clock::now();
+    IndexUpdateStats stats;
+
+    // An unreadable or outdated index only costs a full rebuild.
+    std::optional<CorpusIndex> previous;
+    std::error_code ec;
+    if (fs::exists(indexPath, ec)) {
+        try {
+            previous = Open(indexPath);
+        } catch (const std::runtime_error&) {
+            previous.reset();
+        }
+    }
+    stats.rebuilt = !previous;
+
+    const std::vector<std::string> files = BatchScanner::CollectInputs(inputs, opts.recursive);
+    std::vector<Entry> entries(files.size());
+    std::vector<Outcome> outcomes(files.size(), Outcome::Parsed);
+    std::atomic<std::size_t> carried{0}; // previous rows still present
+
+    WorkStealingPool::ParallelFor(files.size(), WorkStealingPool::ResolveThreadCount(opts.threads),
+                                  [&](unsigned, std::size_t i) {
+        Entry& e = entries[i];
+        e.path = files[i];
+
+        std::error_code statError;
+        e.fileSize = static_cast<std::uint64_t>(fs::file_size(files[i], statError));
+        if (!statError) e.mtime = MtimeTicks(fs::last_write_time(files[i], statError));
+
+        constexpr std::size_t kNoRow = static_cast<std::size_t>(-1);
+        const std::size_t prev = previous ? previous->FindPath(files[i]).value_or(kNoRow) : kNoRow;
+        if (prev != kNoRow) carried.fetch_add(1, std::memory_order_relaxed);
+
+        auto reuse = [&](std::size_t row) {
+            const IndexRow r = previous->Row(row);
+            CopyFields(r, std::span(previous->Cell(Column::Owned, row, kDexBytes), kDexBytes),
+                       std::span(previous->Cell(Column::Seen, row, kDexBytes), kDexBytes), e);
+        };
+
+        if (prev != kNoRow && !statError) {
+            const IndexRow r = previous->Row(prev);
+            if (r.fileSize == e.fileSize && r.mtime == e.mtime) {
+                reuse(prev);
+                outcomes[i] = Outcome::Unchanged;
+                return;
+            }
+        }
+
+        MappedFile mapped;
+        try {
+            mapped = MappedFile::Open(files[i]);
+        } catch (const std::runtime_error&) {
+            e.fileSize = 0;
+            e.mtime = kUnreadMtime;
+            outcomes[i] = Outcome::Failed;
+            return;
+        }
+        const SaveView sv(mapped.Bytes());
+        e.fileSize = sv.Size();
+        e.hash = SaveDigest::Of(sv).whole;
+
+        if (prev != kNoRow) {
+            const IndexRow r = previous->Row(prev);
+            if (r.hash == e.hash && r.fileSize == e.fileSize) {
+                reuse(prev);
+                outcomes[i] = Outcome::Rehashed;
+                return;
+            }
+        }
+
+        Parse(sv, e);
+        outcomes[i] = e.ok ? Outcome::Parsed : Outcome::Failed;
+    });
+
+    for (Outcome o : outcomes) {
+        switch (o) {
+        case Outcome::Unchanged: stats.unchanged++; break;
+        case Outcome::Rehashed: stats.rehashed++; break;
+        case Outcome::Parsed: stats.parsed++; break;
+        case Outcome::Failed: stats.parsed++; stats.failed++; break;
+        }
+    }
+
+    // Rows for paths outside this update's inputs are carried over untouched
+    // while their file exists, so indexing a second directory keeps the first.
+    if (previous) {
+        for (std::size_t row = 0; row < previous->Size(); ++row) {
+            const IndexRow r = previous->Row(row);
+            if (std::binary_search(files.begin(), files.end(), r.path)) continue;
+            std::error_code existsError;
+            if (!fs::is_regular_file(fs::path(r.path), existsError)) continue;
+            Entry e;
+            e.path.assign(r.path);
+            e.fileSize = r.fileSize;
+            e.mtime = r.mtime;
+            CopyFields(r, std::span(previous->Cell(Column::Owned, row, kDexBytes), kDexBytes),
+                       std::span(previous->Cell(Column::Seen, row, kDexBytes), kDexBytes), e);
+            entries.push_back(std::move(e));
+            stats.kept++;
+        }
+        if (stats.kept != 0) {
+            std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.path < b.path; });
+        }
+    }
+    stats.rows = entries.size();
+    stats.removed = previous ? previous->Size() - carried.load() - stats.kept : 0;
+
+    const std::vector<std::uint8_t> bytes = Serialize(entries);
+    previous.reset();
+    FileManipulation::WriteFile(indexPath, bytes, Durability::Synced);
+
+    stats.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    return stats;
+}
+
+} // namespace savegenie
@@ -10,17 +10,260 @@
 //  Notes:
 //   - This module intentionally contains NO Pokémon-specific logic.
 //   - All errors are reported via std::runtime_error.
+//   - Files are fsync'd and then published with rename(2) (the directory is
+//     also fsync'd for Durability::Synced);
+//     backups use link(2) so an existing backup is never replaced, even by a
+//     concurrent writer.
 //
 
 #include "FileManipulation.hpp"
+#include "Instrumentation.hpp"
 
+#include <atomic>
+#include <cerrno>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SAVEGENIE_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define SAVEGENIE_HAVE_MMAP 0
+#endif
 
 namespace savegenie {
 
+namespace {
+
+// Unique sibling of `path` (same directory, so rename stays on one filesystem).
+std::string MakeTempPath(const std::string& path) {
+    namespace fs = std::filesystem;
+    static std::atomic<unsigned long> counter{0};
+    const fs::path p(path);
+#if SAVEGENIE_HAVE_MMAP
+    const long pid = static_cast<long>(::getpid());
+#else
+    const long pid = 0;
+#endif
+    const std::string name = "." + p.filename().string() + ".tmp-" + std::to_string(pid) + "-" +
+                             std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+    return (p.parent_path() / name).string();
+}
+
+std::string ErrnoText() {
+    return std::strerror(errno);
+}
+
+#if SAVEGENIE_HAVE_MMAP
+// Flush a directory entry (rename/link) to disk. Best effort: some
+// filesystems refuse fsync on directories, and the data itself is already safe.
+void SyncParentDir(const std::string& path) {
+    std::string dir = std::filesystem::path(path).parent_path().string();
+    if (dir.empty()) dir = ".";
+    const int fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+#endif
+
+void RemoveQuietly(const std::string& path) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+} // namespace
+
+// =========================================================
+// AtomicFileWriter
+// =========================================================
+
+AtomicFileWriter::AtomicFileWriter(std::string path, std::string op)
+    : path_(std::move(path)), tmp_(MakeTempPath(path_)), op_(std::move(op)) {
+#if SAVEGENIE_HAVE_MMAP
+    fd_ = ::open(tmp_.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error(op_ + " failed: could not create temp file for: " + path_ + " (" + ErrnoText() + ")");
+    }
+#else
+    out_.open(tmp_, std::ios::binary | std::ios::trunc);
+    if (!out_) throw std::runtime_error(op_ + " failed: could not create temp file for: " + path_);
+#endif
+    open_ = true;
+}
+
+AtomicFileWriter::~AtomicFileWriter() {
+    if (!open_) return;
+#if SAVEGENIE_HAVE_MMAP
+    ::close(fd_);
+#else
+    out_.close();
+#endif
+    RemoveQuietly(tmp_);
+}
+
+void AtomicFileWriter::Fail(const char* what, const std::string& reason) {
+#if SAVEGENIE_HAVE_MMAP
+    ::close(fd_);
+#else
+    out_.close();
+#endif
+    open_ = false;
+    RemoveQuietly(tmp_);
+    throw std::runtime_error(op_ + " failed: " + what + " for file: " + path_ +
+                             (reason.empty() ? std::string() : " (" + reason + ")"));
+}
+
+void AtomicFileWriter::Write(std::span<const std::uint8_t> bytes) {
+    if (!open_) throw std::logic_error("AtomicFileWriter: already committed");
+#if SAVEGENIE_HAVE_MMAP
+    std::size_t done = 0;
+    while (done < bytes.size()) {
+        const ssize_t n = ::write(fd_, bytes.data() + done, bytes.size() - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            Fail("write error", ErrnoText());
+        }
+        done += static_cast<std::size_t>(n);
+    }
+#else
+    if (!bytes.empty()) {
+        out_.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    if (!out_) Fail("write error", std::string());
+#endif
+}
+
+std::string AtomicFileWriter::Seal() {
+    if (!open_) throw std::logic_error("AtomicFileWriter: already committed");
+#if SAVEGENIE_HAVE_MMAP
+    if (::fsync(fd_) != 0) Fail("fsync error", ErrnoText());
+    if (::close(fd_) != 0) {
+        const std::string reason = ErrnoText();
+        open_ = false;
+        RemoveQuietly(tmp_);
+        throw std::runtime_error(op_ + " failed: close error for file: " + path_ + " (" + reason + ")");
+    }
+#else
+    out_.flush();
+    if (!out_) Fail("write error", std::string());
+    out_.close();
+#endif
+    open_ = false;
+    return tmp_;
+}
+
+void AtomicFileWriter::Commit(Durability durability) {
+    const std::string tmp = Seal();
+    std::error_code ec;
+    std::filesystem::rename(tmp, path_, ec);
+    if (ec) {
+        RemoveQuietly(tmp);
+        throw std::runtime_error(op_ + " failed: could not rename temp file onto: " + path_ + " (" + ec.message() +
+                                 ")");
+    }
+#if SAVEGENIE_HAVE_MMAP
+    if (durability == Durability::Synced) SyncParentDir(path_);
+#else
+    (void)durability;
+#endif
+}
+
+// =========================================================
+// MappedFile
+// =========================================================
+
+MappedFile::~MappedFile() { Reset(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+: data_(std::exchange(other.data_, nullptr)),
+  size_(std::exchange(other.size_, 0)),
+  mapped_(std::exchange(other.mapped_, false)),
+  fallback_(std::move(other.fallback_)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Reset();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, false);
+        fallback_ = std::move(other.fallback_);
+    }
+    return *this;
+}
+
+void MappedFile::Reset() {
+#if SAVEGENIE_HAVE_MMAP
+    if (mapped_ && data_ != nullptr) {
+        ::munmap(const_cast<std::uint8_t*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    fallback_.clear();
+}
+
+MappedFile MappedFile::Open(const std::string& path) {
+    SAVEGENIE_STAGE(Load);
+    MappedFile mf;
+
+#if SAVEGENIE_HAVE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("MappedFile failed: could not open input file: " + path);
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < 0) {
+        ::close(fd);
+        throw std::runtime_error("MappedFile failed: could not determine file size: " + path);
+    }
+
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return mf;
+    }
+
+    void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps its own reference
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("MappedFile failed: mmap error for file: " + path);
+    }
+
+    mf.data_ = static_cast<const std::uint8_t*>(p);
+    mf.size_ = size;
+    mf.mapped_ = true;
+    SAVEGENIE_COUNT(BytesRead, size);
+#else
+    mf.fallback_ = FileManipulation::LoadFile(path);
+    mf.data_ = mf.fallback_.data();
+    mf.size_ = mf.fallback_.size();
+#endif
+
+    return mf;
+}
+
+// =========================================================
+// FileManipulation
+// =========================================================
+
 FileManipulation::Bytes FileManipulation::LoadFile(const std::string& path) {
+    Bytes bytes;
+    LoadFileInto(path, bytes);
+    return bytes;
+}
+
+void FileManipulation::LoadFileInto(const std::string& path, Bytes& out) {
+    SAVEGENIE_STAGE(Load);
     std::ifstream in(path, std::ios::binary | std::ios::ate);
     if (!in) {
         throw std::runtime_error("LoadFile failed: could not open input file: " + path);
@@ -31,37 +274,40 @@ FileManipulation::Bytes FileManipulation::LoadFile(const std::string& path) {
         throw std::runtime_error("LoadFile failed: could not determine file size: " + path);
     }
 
-    Bytes bytes(static_cast<std::size_t>(size));
+    out.resize(static_cast<std::size_t>(size));
     in.seekg(0, std::ios::beg);
 
-    if (!bytes.empty()) {
-        in.read(reinterpret_cast<char*>(bytes.data()), size);
+    if (!out.empty()) {
+        in.read(reinterpret_cast<char*>(out.data()), size);
         if (!in) {
             throw std::runtime_error("LoadFile failed: read error for file: " + path);
         }
     }
-
-    return bytes;
+    SAVEGENIE_COUNT(BytesRead, out.size());
 }
 
-void FileManipulation::WriteFile(const std::string& path, const Bytes& bytes) {
-    std::ofstream out(path, std::ios::binary | std::ios::trunc);
-    if (!out) {
-        throw std::runtime_error("WriteFile failed: could not open output file: " + path);
-    }
-
-    if (!bytes.empty()) {
-        out.write(reinterpret_cast<const char*>(bytes.data()),
-                  static_cast<std::streamsize>(bytes.size()));
-        if (!out) {
-            throw std::runtime_error("WriteFile failed: write error for file: " + path);
-        }
-    }
+void FileManipulation::WriteFile(const std::string& path, std::span<const Byte> bytes, Durability durability) {
+    AtomicFileWriter out(path, "WriteFile");
+    out.Write(bytes);
+    out.Commit(durability);
+}
 
-    out.flush();
-    if (!out) {
-        throw std::runtime_error("WriteFile failed: flush error for file: " + path);
+void FileManipulation::SyncFileSystem(const std::string& path) {
+#if SAVEGENIE_HAVE_MMAP
+#if defined(__linux__)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        const int rc = ::syncfs(fd);
+        ::close(fd);
+        if (rc == 0) return;
     }
+#else
+    (void)path;
+#endif
+    ::sync();
+#else
+    (void)path;
+#endif
 }
 
 std::string FileManipulation::MakeBackupPath(const std::string& path) {
@@ -82,8 +328,18 @@ std::string FileManipulation::MakeEditedPath(const std::string& path) {
     return out.string();
 }
 
+std::string FileManipulation::MakePatchPath(const std::string& path) {
+    namespace fs = std::filesystem;
+    fs::path p(path);
+    fs::path dir = p.parent_path();
+    std::string stem = p.stem().string();
+    fs::path out = dir / ("(PATCH) " + stem + ".sgpatch");
+    return out.string();
+}
+
 std::string FileManipulation::BackupFile(const std::string& path) {
     namespace fs = std::filesystem;
+    SAVEGENIE_STAGE(Backup);
 
     const std::string backupPath = MakeBackupPath(path);
 
@@ -104,4 +360,50 @@ std::string FileManipulation::BackupFile(const std::string& path) {
     return backupPath;
 }
 
+std::string FileManipulation::BackupFromBytes(const std::string& path, std::span<const Byte> bytes,
+                                              Durability durability) {
+    namespace fs = std::filesystem;
+    SAVEGENIE_STAGE(Backup);
+
+    const std::string backupPath = MakeBackupPath(path);
+
+    std::error_code ec;
+    // If backup already exists, keep it (don't overwrite the user's old backup).
+    if (fs::exists(backupPath, ec) && !ec) {
+        return backupPath;
+    }
+
+    const bool sync = durability == Durability::Synced;
+    AtomicFileWriter out(backupPath, "BackupFile");
+    out.Write(bytes);
+    const std::string tmp = out.Seal();
+
+#if SAVEGENIE_HAVE_MMAP
+    // link() publishes the complete file and fails instead of replacing a backup
+    // that appeared since the exists() check. Filesystems without hard links
+    // fall back to rename().
+    if (::link(tmp.c_str(), backupPath.c_str()) == 0 || errno == EEXIST) {
+        ::unlink(tmp.c_str());
+        if (sync) SyncParentDir(backupPath);
+        return backupPath;
+    }
+#endif
+
+    fs::rename(tmp, backupPath, ec);
+    if (ec) {
+        RemoveQuietly(tmp);
+        throw std::runtime_error("BackupFile failed: could not create backup '" + backupPath + "' from '" + path +
+                                 "' (" + ec.message() + ")");
+    }
+#if SAVEGENIE_HAVE_MMAP
+    if (sync) SyncParentDir(backupPath);
+#endif
+    return backupPath;
+}
+
+std::string FileManipulation::LoadFileWithBackup(const std::string& path, Bytes& out) {
+    LoadFileInto(path, out);
+    return BackupFromBytes(path, out);
+}
+
 } // namespace savegenie
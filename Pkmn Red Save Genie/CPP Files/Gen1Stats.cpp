@@ -0,0 +1,322 @@
+//
+//  Gen1Stats.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Species / move tables and the stat and experience math behind Gen1Stats.
+//
+
+#include "Gen1Stats.hpp"
+
+#include <algorithm>
+
+namespace savegenie {
+
+namespace {
+
+using G = Gen1GrowthRate;
+using T = Gen1Type;
+
+constexpr Gen1BaseStats Mon(u8 dex, u8 hp, u8 atk, u8 def, u8 spd, u8 spc, T t1, T t2, G growth) {
+    return Gen1BaseStats{dex, {hp, atk, def, spd, spc}, t1, t2, growth};
+}
+
+// Pokédex order, [0] unused. Values are the Red / Blue base data.
+constexpr std::array<Gen1BaseStats, 152> kBaseStats = {{
+    {},
+    Mon(1, 45, 49, 49, 45, 65, T::Grass, T::Poison, G::MediumSlow),          // BULBASAUR
+    Mon(2, 60, 62, 63, 60, 80, T::Grass, T::Poison, G::MediumSlow),          // IVYSAUR
+    Mon(3, 80, 82, 83, 80, 100, T::Grass, T::Poison, G::MediumSlow),         // VENUSAUR
+    Mon(4, 39, 52, 43, 65, 50, T::Fire, T::Fire, G::MediumSlow),             // CHARMANDER
+    Mon(5, 58, 64, 58, 80, 65, T::Fire, T::Fire, G::MediumSlow),             // CHARMELEON
+    Mon(6, 78, 84, 78, 100, 85, T::Fire, T::Flying, G::MediumSlow),          // CHARIZARD
+    Mon(7, 44, 48, 65, 43, 50, T::Water, T::Water, G::MediumSlow),           // SQUIRTLE
+    Mon(8, 59, 63, 80, 58, 65, T::Water, T::Water, G::MediumSlow),           // WARTORTLE
+    Mon(9, 79, 83, 100, 78, 85, T::Water, T::Water, G::MediumSlow),          // BLASTOISE
+    Mon(10, 45, 30, 35, 45, 20, T::Bug, T::Bug, G::MediumFast),              // CATERPIE
+    Mon(11, 50, 20, 55, 30, 25, T::Bug, T::Bug, G::MediumFast),              // METAPOD
+    Mon(12, 60, 45, 50, 70, 80, T::Bug, T::Flying, G::MediumFast),           // BUTTERFREE
+    Mon(13, 40, 35, 30, 50, 20, T::Bug, T::Poison, G::MediumFast),           // WEEDLE
+    Mon(14, 45, 25, 50, 35, 25, T::Bug, T::Poison, G::MediumFast),           // KAKUNA
+    Mon(15, 65, 80, 40, 75, 45, T::Bug, T::Poison, G::MediumFast),           // BEEDRILL
+    Mon(16, 40, 45, 40, 56, 35, T::Normal, T::Flying, G::MediumSlow),        // PIDGEY
+    Mon(17, 63, 60, 55, 71, 50, T::Normal, T::Flying, G::MediumSlow),        // PIDGEOTTO
+    Mon(18, 83, 80, 75, 91, 70, T::Normal, T::Flying, G::MediumSlow),        // PIDGEOT
+    Mon(19, 30, 56, 35, 72, 25, T::Normal, T::Normal, G::MediumFast),        // RATTATA
+    Mon(20, 55, 81, 60, 97, 50, T::Normal, T::Normal, G::MediumFast),        // RATICATE
+    Mon(21, 40, 60, 30, 70, 31, T::Normal, T::Flying, G::MediumFast),        // SPEAROW
+    Mon(22, 65, 90, 65, 100, 61, T::Normal, T::Flying, G::MediumFast),       // FEAROW
+    Mon(23, 35, 60, 44, 55, 40, T::Poison, T::Poison, G::MediumFast),        // EKANS
+    Mon(24, 60, 85, 69, 80, 65, T::Poison, T::Poison, G::MediumFast),        // ARBOK
+    Mon(25, 35, 55, 30, 90, 50, T::Electric, T::Electric, G::MediumFast),    // PIKACHU
+    Mon(26, 60, 90, 55, 100, 90, T::Electric, T::Electric, G::MediumFast),   // RAICHU
+    Mon(27, 50, 75, 85, 40, 30, T::Ground, T::Ground, G::MediumFast),        // SANDSHREW
+    Mon(28, 75, 100, 110, 65, 55, T::Ground, T::Ground, G::MediumFast),      // SANDSLASH
+    Mon(29, 55, 47, 52, 41, 40, T::Poison, T::Poison, G::MediumSlow),        // NIDORAN_F
+    Mon(30, 70, 62, 67, 56, 55, T::Poison, T::Poison, G::MediumSlow),        // NIDORINA
+    Mon(31, 90, 82, 87, 76, 75, T::Poison, T::Ground, G::MediumSlow),        // NIDOQUEEN
+    Mon(32, 46, 57, 40, 50, 40, T::Poison, T::Poison, G::MediumSlow),        // NIDORAN_M
+    Mon(33, 61, 72, 57, 65, 55, T::Poison, T::Poison, G::MediumSlow),        // NIDORINO
+    Mon(34, 81, 92, 77, 85, 75, T::Poison, T::Ground, G::MediumSlow),        // NIDOKING
+    Mon(35, 70, 45, 48, 35, 60, T::Normal, T::Normal, G::Fast),              // CLEFAIRY
+    Mon(36, 95, 70, 73, 60, 85, T::Normal, T::Normal, G::Fast),              // CLEFABLE
+    Mon(37, 38, 41, 40, 65, 65, T::Fire, T::Fire, G::MediumFast),            // VULPIX
+    Mon(38, 73, 76, 75, 100, 100, T::Fire, T::Fire, G::MediumFast),          // NINETALES
+    Mon(39, 115, 45, 20, 20, 25, T::Normal, T::Normal, G::Fast),             // JIGGLYPUFF
+    Mon(40, 140, 70, 45, 45, 50, T::Normal, T::Normal, G::Fast),             // WIGGLYTUFF
+    Mon(41, 40, 45, 35, 55, 40, T::Poison, T::Flying, G::MediumFast),        // ZUBAT
+    Mon(42, 75, 80, 70, 90, 75, T::Poison, T::Flying, G::MediumFast),        // GOLBAT
+    Mon(43, 45, 50, 55, 30, 75, T::Grass, T::Poison, G::MediumSlow),         // ODDISH
+    Mon(44, 60, 65, 70, 40, 85, T::Grass, T::Poison, G::MediumSlow),         // GLOOM
+    Mon(45, 75, 80, 85, 50, 100, T::Grass, T::Poison, G::MediumSlow),        // VILEPLUME
+    Mon(46, 35, 70, 55, 25, 55, T::Bug, T::Grass, G::MediumFast),            // PARAS
+    Mon(47, 60, 95, 80, 30, 80, T::Bug, T::Grass, G::MediumFast),            // PARASECT
+    Mon(48, 60, 55, 50, 45, 40, T::Bug, T::Poison, G::MediumFast),           // VENONAT
+    Mon(49, 70, 65, 60, 90, 90, T::Bug, T::Poison, G::MediumFast),           // VENOMOTH
+    Mon(50, 10, 55, 25, 95, 45, T::Ground, T::Ground, G::MediumFast),        // DIGLETT
+    Mon(51, 35, 80, 50, 120, 70, T::Ground, T::Ground, G::MediumFast),       // DUGTRIO
+    Mon(52, 40, 45, 35, 90, 40, T::Normal, T::Normal, G::MediumFast),        // MEOWTH
+    Mon(53, 65, 70, 60, 115, 65, T::Normal, T::Normal, G::MediumFast),       // PERSIAN
+    Mon(54, 50, 52, 48, 55, 50, T::Water, T::Water, G::MediumFast),          // PSYDUCK
+    Mon(55, 80, 82, 78, 85, 80, T::Water, T::Water, G::MediumFast),          // GOLDUCK
+    Mon(56, 40, 80, 35, 70, 35, T::Fighting, T::Fighting, G::MediumFast),    // MANKEY
+    Mon(57, 65, 105, 60, 95, 60, T::Fighting, T::Fighting, G::MediumFast),   // PRIMEAPE
+    Mon(58, 55, 70, 45, 60, 50, T::Fire, T::Fire, G::Slow),                  // GROWLITHE
+    Mon(59, 90, 110, 80, 95, 80, T::Fire, T::Fire, G::Slow),                 // ARCANINE
+    Mon(60, 40, 50, 40, 90, 40, T::Water, T::Water, G::MediumSlow),          // POLIWAG
+    Mon(61, 65, 65, 65, 90, 50, T::Water, T::Water, G::MediumSlow),          // POLIWHIRL
+    Mon(62, 90, 85, 95, 70, 70, T::Water, T::Fighting, G::MediumSlow),       // POLIWRATH
+    Mon(63, 25, 20, 15, 90, 105, T::Psychic, T::Psychic, G::MediumSlow),     // ABRA
+    Mon(64, 40, 35, 30, 105, 120, T::Psychic, T::Psychic, G::MediumSlow),    // KADABRA
+    Mon(65, 55, 50, 45, 120, 135, T::Psychic, T::Psychic, G::MediumSlow),    // ALAKAZAM
+    Mon(66, 70, 80, 50, 35, 35, T::Fighting, T::Fighting, G::MediumSlow),    // MACHOP
+    Mon(67, 80, 100, 70, 45, 50, T::Fighting, T::Fighting, G::MediumSlow),   // MACHOKE
+    Mon(68, 90, 130, 80, 55, 65, T::Fighting, T::Fighting, G::MediumSlow),   // MACHAMP
+    Mon(69, 50, 75, 35, 40, 70, T::Grass, T::Poison, G::MediumSlow),         // BELLSPROUT
+    Mon(70, 65, 90, 50, 55, 85, T::Grass, T::Poison, G::MediumSlow),         // WEEPINBELL
+    Mon(71, 80, 105, 65, 70, 100, T::Grass, T::Poison, G::MediumSlow),       // VICTREEBEL
+    Mon(72, 40, 40, 35, 70, 100, T::Water, T::Poison, G::Slow),              // TENTACOOL
+    Mon(73, 80, 70, 65, 100, 120, T::Water, T::Poison, G::Slow),             // TENTACRUEL
+    Mon(74, 40, 80, 100, 20, 30, T::Rock, T::Ground, G::MediumSlow),         // GEODUDE
+    Mon(75, 55, 95, 115, 35, 45, T::Rock, T::Ground, G::MediumSlow),         // GRAVELER
+    Mon(76, 80, 110, 130, 45, 55, T::Rock, T::Ground, G::MediumSlow),        // GOLEM
+    Mon(77, 50, 85, 55, 90, 65, T::Fire, T::Fire, G::MediumFast),            // PONYTA
+    Mon(78, 65, 100, 70, 105, 80, T::Fire, T::Fire, G::MediumFast),          // RAPIDASH
+    Mon(79, 90, 65, 65, 15, 40, T::Water, T::Psychic, G::MediumFast),        // SLOWPOKE
+    Mon(80, 95, 75, 110, 30, 80, T::Water, T::Psychic, G::MediumFast),       // SLOWBRO
+    Mon(81, 25, 35, 70, 45, 95, T::Electric, T::Electric, G::MediumFast),    // MAGNEMITE
+    Mon(82, 50, 60, 95, 70, 120, T::Electric, T::Electric, G::MediumFast),   // MAGNETON
+    Mon(83, 52, 65, 55, 60, 58, T::Normal, T::Flying, G::MediumFast),        // FARFETCHD
+    Mon(84, 35, 85, 45, 75, 35, T::Normal, T::Flying, G::MediumFast),        // DODUO
+    Mon(85, 60, 110, 70, 100, 60, T::Normal, T::Flying, G::MediumFast),      // DODRIO
+    Mon(86, 65, 45, 55, 45, 70, T::Water, T::Water, G::MediumFast),          // SEEL
+    Mon(87, 90, 70, 80, 70, 95, T::Water, T::Ice, G::MediumFast),            // DEWGONG
+    Mon(88, 80, 80, 50, 25, 40, T::Poison, T::Poison, G::MediumFast),        // GRIMER
+    Mon(89, 105, 105, 75, 50, 65, T::Poison, T::Poison, G::MediumFast),      // MUK
+    Mon(90, 30, 65, 100, 40, 45, T::Water, T::Water, G::Slow),               // SHELLDER
+    Mon(91, 50, 95, 180, 70, 85, T::Water, T::Ice, G::Slow),                 // CLOYSTER
+    Mon(92, 30, 35, 30, 80, 100, T::Ghost, T::Poison, G::MediumSlow),        // GASTLY
+    Mon(93, 45, 50, 45, 95, 115, T::Ghost, T::Poison, G::MediumSlow),        // HAUNTER
+    Mon(94, 60, 65, 60, 110, 130, T::Ghost, T::Poison, G::MediumSlow),       // GENGAR
+    Mon(95, 35, 45, 160, 70, 30, T::Rock, T::Ground, G::MediumFast),         // ONIX
+    Mon(96, 60, 48, 45, 42, 90, T::Psychic, T::Psychic, G::MediumFast),      // DROWZEE
+    Mon(97, 85, 73, 70, 67, 115, T::Psychic, T::Psychic, G::MediumFast),     // HYPNO
+    Mon(98, 30, 105, 90, 50, 25, T::Water, T::Water, G::MediumFast),         // KRABBY
+    Mon(99, 55, 130, 115, 75, 50, T::Water, T::Water, G::MediumFast),        // KINGLER
+    Mon(100, 40, 30, 50, 100, 55, T::Electric, T::Electric, G::MediumFast),  // VOLTORB
+    Mon(101, 60, 50, 70, 140, 80, T::Electric, T::Electric, G::MediumFast),  // ELECTRODE
+    Mon(102, 60, 40, 80, 40, 60, T::Grass, T::Psychic, G::Slow),             // EXEGGCUTE
+    Mon(103, 95, 95, 85, 55, 125, T::Grass, T::Psychic, G::Slow),            // EXEGGUTOR
+    Mon(104, 50, 50, 95, 35, 40, T::Ground, T::Ground, G::MediumFast),       // CUBONE
+    Mon(105, 60, 80, 110, 45, 50, T::Ground, T::Ground, G::MediumFast),      // MAROWAK
+    Mon(106, 50, 120, 53, 87, 35, T::Fighting, T::Fighting, G::MediumFast),  // HITMONLEE
+    Mon(107, 50, 105, 79, 76, 35, T::Fighting, T::Fighting, G::MediumFast),  // HITMONCHAN
+    Mon(108, 90, 55, 75, 30, 60, T::Normal, T::Normal, G::MediumFast),       // LICKITUNG
+    Mon(109, 40, 65, 95, 35, 60, T::Poison, T::Poison, G::MediumFast),       // KOFFING
+    Mon(110, 65, 90, 120, 60, 85, T::Poison, T::Poison, G::MediumFast),      // WEEZING
+    Mon(111, 80, 85, 95, 25, 30, T::Ground, T::Rock, G::Slow),               // RHYHORN
+    Mon(112, 105, 130, 120, 40, 45, T::Ground, T::Rock, G::Slow),            // RHYDON
+    Mon(113, 250, 5, 5, 50, 105, T::Normal, T::Normal, G::Fast),             // CHANSEY
+    Mon(114, 65, 55, 115, 60, 100, T::Grass, T::Grass, G::MediumFast),       // TANGELA
+    Mon(115, 105, 95, 80, 90, 40, T::Normal, T::Normal, G::MediumFast),      // KANGASKHAN
+    Mon(116, 30, 40, 70, 60, 70, T::Water, T::Water, G::MediumFast),         // HORSEA
+    Mon(117, 55, 65, 95, 85, 95, T::Water, T::Water, G::MediumFast),         // SEADRA
+    Mon(118, 45, 67, 60, 63, 50, T::Water, T::Water, G::MediumFast),         // GOLDEEN
+    Mon(119, 80, 92, 65, 68, 80, T::Water, T::Water, G::MediumFast),         // SEAKING
+    Mon(120, 30, 45, 55, 85, 70, T::Water, T::Water, G::Slow),               // STARYU
+    Mon(121, 60, 75, 85, 115, 100, T::Water, T::Psychic, G::Slow),           // STARMIE
+    Mon(122, 40, 45, 65, 90, 100, T::Psychic, T::Psychic, G::MediumFast),    // MR_MIME
+    Mon(123, 70, 110, 80, 105, 55, T::Bug, T::Flying, G::MediumFast),        // SCYTHER
+    Mon(124, 65, 50, 35, 95, 95, T::Ice, T::Psychic, G::MediumFast),         // JYNX
+    Mon(125, 65, 83, 57, 105, 85, T::Electric, T::Electric, G::MediumFast),  // ELECTABUZZ
+    Mon(126, 65, 95, 57, 93, 85, T::Fire, T::Fire, G::MediumFast),           // MAGMAR
+    Mon(127, 65, 125, 100, 85, 55, T::Bug, T::Bug, G::Slow),                 // PINSIR
+    Mon(128, 75, 100, 95, 110, 70, T::Normal, T::Normal, G::Slow),           // TAUROS
+    Mon(129, 20, 10, 55, 80, 20, T::Water, T::Water, G::Slow),               // MAGIKARP
+    Mon(130, 95, 125, 79, 81, 100, T::Water, T::Flying, G::Slow),            // GYARADOS
+    Mon(131, 130, 85, 80, 60, 95, T::Water, T::Ice, G::Slow),                // LAPRAS
+    Mon(132, 48, 48, 48, 48, 48, T::Normal, T::Normal, G::MediumFast),       // DITTO
+    Mon(133, 55, 55, 50, 55, 65, T::Normal, T::Normal, G::MediumFast),       // EEVEE
+    Mon(134, 130, 65, 60, 65, 110, T::Water, T::Water, G::MediumFast),       // VAPOREON
+    Mon(135, 65, 65, 60, 130, 110, T::Electric, T::Electric, G::MediumFast), // JOLTEON
+    Mon(136, 65, 130, 60, 65, 110, T::Fire, T::Fire, G::MediumFast),         // FLAREON
+    Mon(137, 65, 60, 70, 40, 75, T::Normal, T::Normal, G::MediumFast),       // PORYGON
+    Mon(138, 35, 40, 100, 35, 90, T::Rock, T::Water, G::MediumFast),         // OMANYTE
+    Mon(139, 70, 60, 125, 55, 115, T::Rock, T::Water, G::MediumFast),        // OMASTAR
+    Mon(140, 30, 80, 90, 55, 45, T::Rock, T::Water, G::MediumFast),          // KABUTO
+    Mon(141, 60, 115, 105, 80, 70, T::Rock, T::Water, G::MediumFast),        // KABUTOPS
+    Mon(142, 80, 105, 65, 130, 60, T::Rock, T::Flying, G::Slow),             // AERODACTYL
+    Mon(143, 160, 110, 65, 30, 65, T::Normal, T::Normal, G::Slow),           // SNORLAX
+    Mon(144, 90, 85, 100, 85, 125, T::Ice, T::Flying, G::Slow),              // ARTICUNO
+    Mon(145, 90, 90, 85, 100, 125, T::Electric, T::Flying, G::Slow),         // ZAPDOS
+    Mon(146, 90, 100, 90, 90, 125, T::Fire, T::Flying, G::Slow),             // MOLTRES
+    Mon(147, 41, 64, 45, 50, 50, T::Dragon, T::Dragon, G::Slow),             // DRATINI
+    Mon(148, 61, 84, 65, 70, 70, T::Dragon, T::Dragon, G::Slow),             // DRAGONAIR
+    Mon(149, 91, 134, 95, 80, 100, T::Dragon, T::Flying, G::Slow),           // DRAGONITE
+    Mon(150, 106, 110, 90, 130, 154, T::Psychic, T::Psychic, G::Slow),       // MEWTWO
+    Mon(151, 100, 100, 100, 100, 100, T::Psychic, T::Psychic, G::MediumSlow), // MEW
+}};
+
+constexpr bool BaseStatsInDexOrder() {
+    for (std::size_t i = 1; i < kBaseStats.size(); ++i) {
+        if (kBaseStats[i].dexNo != i) return false;
+        for (u8 b : kBaseStats[i].base) {
+            if (b == 0) return false;
+        }
+    }
+    return true;
+}
+static_assert(BaseStatsInDexOrder(), "kBaseStats must list dex 1..151 in order");
+
+// Base PP by move ID, [0] = no move. Red / Blue values.
+constexpr std::array<u8, Gen1Stats::MaxMoveId + 1> kBasePp = {
+    0,
+    35, 25, 10, 15, 20, 20, 15, 15, 15, 35, //   1 POUND ..  10 SCRATCH
+    30, 5, 10, 30, 30, 35, 35, 20, 15, 20,  //  11 VICEGRIP ..  20 BIND
+    20, 10, 20, 30, 5, 25, 15, 15, 15, 25,  //  21 SLAM ..  30 HORN ATTACK
+    20, 5, 35, 15, 20, 20, 20, 15, 30, 35,  //  31 FURY ATTACK ..  40 POISON STING
+    20, 20, 30, 25, 40, 20, 15, 20, 20, 20, //  41 TWINEEDLE ..  50 DISABLE
+    30, 25, 15, 30, 25, 5, 15, 10, 5, 20,   //  51 ACID ..  60 PSYBEAM
+    20, 20, 5, 35, 20, 25, 20, 20, 20, 15,  //  61 BUBBLEBEAM ..  70 STRENGTH
+    20, 10, 10, 40, 25, 10, 35, 30, 15, 20, //  71 ABSORB ..  80 PETAL DANCE
+    40, 10, 15, 30, 15, 20, 10, 15, 10, 5,  //  81 STRING SHOT ..  90 FISSURE
+    10, 10, 25, 10, 20, 40, 30, 30, 20, 20, //  91 DIG .. 100 TELEPORT
+    15, 10, 40, 15, 20, 30, 20, 20, 10, 40, // 101 NIGHT SHADE .. 110 WITHDRAW
+    40, 30, 30, 30, 20, 30, 10, 10, 20, 5,  // 111 DEFENSE CURL .. 120 SELFDESTRUCT
+    10, 30, 20, 20, 20, 5, 15, 10, 20, 15,  // 121 EGG BOMB .. 130 SKULL BASH
+    15, 35, 20, 15, 10, 20, 30, 15, 40, 20, // 131 SPIKE CANNON .. 140 BARRAGE
+    15, 10, 5, 10, 30, 10, 15, 20, 15, 40,  // 141 LEECH LIFE .. 150 SPLASH
+    40, 10, 5, 15, 10, 10, 10, 15, 30, 30,  // 151 ACID ARMOR .. 160 CONVERSION
+    10, 10, 20, 10, 10,                     // 161 TRI ATTACK .. 165 STRUGGLE
+};
+
+// Experience for each level, per growth rate: (a/b)n^3 + c n^2 + d n - e,
+// evaluated once here instead of per edit. Negative results (Medium Slow at
+// level 1) are 0.
+constexpr u32 CurveAt(G growth, u32 n) {
+    const long long n2 = static_cast<long long>(n) * n;
+    const long long n3 = n2 * n;
+    long long v = 0;
+    switch (growth) {
+    case G::MediumFast: v = n3; break;
+    case G::SlightlyFast: v = 3 * n3 / 4 + 10 * n2 - 30; break;
+    case G::SlightlySlow: v = 3 * n3 / 4 + 20 * n2 - 70; break;
+    case G::MediumSlow: v = 6 * n3 / 5 - 15 * n2 + 100 * static_cast<long long>(n) - 140; break;
+    case G::Fast: v = 4 * n3 / 5; break;
+    case G::Slow: v = 5 * n3 / 4; break;
+    }
+    return v < 0 ? 0 : static_cast<u32>(v);
+}
+
+using ExpCurve = std::array<u32, Gen1Stats::MaxLevel + 1>; // [level], [0] unused
+
+constexpr std::array<ExpCurve, Gen1GrowthRateCount> BuildExpTable() {
+    std::array<ExpCurve, Gen1GrowthRateCount> t{};
+    for (std::size_t g = 0; g < Gen1GrowthRateCount; ++g) {
+        for (u32 level = 1; level <= Gen1Stats::MaxLevel; ++level) {
+            t[g][level] = CurveAt(static_cast<G>(g), level);
+        }
+    }
+    return t;
+}
+constexpr std::array<ExpCurve, Gen1GrowthRateCount> kExpTable = BuildExpTable();
+
+static_assert(kExpTable[static_cast<std::size_t>(G::MediumFast)][100] == 1000000);
+static_assert(kExpTable[static_cast<std::size_t>(G::MediumSlow)][100] == 1059860);
+static_assert(kExpTable[static_cast<std::size_t>(G::Fast)][100] == 800000);
+static_assert(kExpTable[static_cast<std::size_t>(G::Slow)][100] == 1250000);
+
+// Stat-exp bonus k needs ceil(sqrt(x)) >= 4k, i.e. x > (4k - 1)^2. The game
+// stops its root search at 255, so k tops out at 63.
+constexpr std::size_t kMaxStatExpBonus = 63;
+
+constexpr std::array<u32, kMaxStatExpBonus> BuildStatExpSteps() {
+    std::array<u32, kMaxStatExpBonus> steps{};
+    for (u32 k = 1; k <= kMaxStatExpBonus; ++k) steps[k - 1] = (4 * k - 1) * (4 * k - 1);
+    return steps;
+}
+constexpr std::array<u32, kMaxStatExpBonus> kStatExpSteps = BuildStatExpSteps();
+
+// Internal species ID -> index into kBaseStats (0 = none), from the dex map.
+const std::array<u8, 256>& SpeciesToDex() {
+    static const std::array<u8, 256> table = [] {
+        std::array<u8, 256> t{};
+        for (std::size_t dex = 1; dex < kBaseStats.size(); ++dex) {
+            const int id = Gen1SpeciesLookup::PokeDex[dex];
+            if (id > 0 && id < 256) t[static_cast<std::size_t>(id)] = static_cast<u8>(dex);
+        }
+        return t;
+    }();
+    return table;
+}
+
+} // namespace
+
+const Gen1BaseStats* Gen1Stats::ForSpecies(u8 speciesId) {
+    const u8 dex = SpeciesToDex()[speciesId];
+    return dex == 0 ? nullptr : &kBaseStats[dex];
+}
+
+u32 Gen1Stats::ExpForLevel(Gen1GrowthRate growth, u8 level) {
+    return kExpTable[static_cast<std::size_t>(growth) % Gen1GrowthRateCount][std::clamp<u8>(level, 1, MaxLevel)];
+}
+
+u8 Gen1Stats::LevelForExp(Gen1GrowthRate growth, u32 exp) {
+    const ExpCurve& curve = kExpTable[static_cast<std::size_t>(growth) % Gen1GrowthRateCount];
+    const auto it = std::upper_bound(curve.begin() + 1, curve.end(), exp);
+    return static_cast<u8>(std::max<std::ptrdiff_t>(1, (it - curve.begin()) - 1));
+}
+
+u8 Gen1Stats::StatExpBonus(u16 statExp) {
+    return static_cast<u8>(std::lower_bound(kStatExpSteps.begin(), kStatExpSteps.end(), u32{statExp}) -
+                           kStatExpSteps.begin());
+}
+
+Gen1StatBlock Gen1Stats::Compute(const Gen1BaseStats& species, u16 dvs,
+                                 const std::array<u16, Gen1StatCount>& statExp, u8 level) {
+    const u8 atk = static_cast<u8>((dvs >> 12) & 0xF);
+    const u8 def = static_cast<u8>((dvs >> 8) & 0xF);
+    const u8 spd = static_cast<u8>((dvs >> 4) & 0xF);
+    const u8 spc = static_cast<u8>(dvs & 0xF);
+    const u8 hp = static_cast<u8>(((atk & 1) << 3) | ((def & 1) << 2) | ((spd & 1) << 1) | (spc & 1));
+    const std::array<u8, Gen1StatCount> dv = {hp, atk, def, spd, spc};
+
+    Gen1StatBlock out;
+    for (std::size_t s = 0; s < Gen1StatCount; ++s) {
+        const u32 raw = (static_cast<u32>(species.base[s] + dv[s]) * 2 + StatExpBonus(statExp[s])) * level / 100;
+        out.values[s] = static_cast<u16>(raw + (s == 0 ? level + 10u : 5u));
+    }
+    return out;
+}
+
+u8 Gen1Stats::BasePp(u8 moveId) {
+    return moveId <= MaxMoveId ? kBasePp[moveId] : 0;
+}
+
+u8 Gen1Stats::MaxPp(u8 moveId, u8 ppUps) {
+    // 40-PP moves stop at 61 with three PP Ups, as in the game.
+    const u8 base = BasePp(moveId);
+    return static_cast<u8>(std::min(61, base + (base / 5) * std::min<u8>(ppUps, MaxPpUps)));
+}
+
+} // namespace savegenie
@@ -0,0 +1,245 @@
+//
+//  Instrumentation.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of Instrumentation / ScopedStage / InstrumentationSnapshot.
+//   - Each thread owns one block of relaxed atomics. Only the owner writes it
+//     (plain load + store, no locked RMW); Snapshot() reads every block under
+//     the registry mutex. Exiting threads fold their totals into `retired`.
+//
+
+#include "Instrumentation.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace savegenie {
+
+namespace {
+
+struct ThreadTotals {
+    std::array<std::atomic<std::uint64_t>, kStageCount> stageNs{};
+    std::array<std::atomic<std::uint64_t>, kStageCount> stageCalls{};
+    std::array<std::atomic<std::uint64_t>, kCounterCount> counters{};
+};
+
+// Owner-thread increment: no other thread writes this value (Reset aside).
+void Bump(std::atomic<std::uint64_t>& v, std::uint64_t n) {
+    v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+void AddInto(InstrumentationSnapshot& out, const ThreadTotals& t) {
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        out.stageNs[i] += t.stageNs[i].load(std::memory_order_relaxed);
+        out.stageCalls[i] += t.stageCalls[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < kCounterCount; ++i) {
+        out.counters[i] += t.counters[i].load(std::memory_order_relaxed);
+    }
+}
+
+void Zero(ThreadTotals& t) {
+    for (auto& v : t.stageNs) v.store(0, std::memory_order_relaxed);
+    for (auto& v : t.stageCalls) v.store(0, std::memory_order_relaxed);
+    for (auto& v : t.counters) v.store(0, std::memory_order_relaxed);
+}
+
+class Registry {
+public:
+    void Attach(ThreadTotals* t) {
+        std::lock_guard<std::mutex> lock(mu_);
+        live_.push_back(t);
+    }
+
+    void Detach(ThreadTotals* t) {
+        std::lock_guard<std::mutex> lock(mu_);
+        AddInto(retired_, *t);
+        ++retired_.threads;
+        std::erase(live_, t);
+    }
+
+    InstrumentationSnapshot Snapshot() {
+        std::lock_guard<std::mutex> lock(mu_);
+        InstrumentationSnapshot out = retired_;
+        for (const ThreadTotals* t : live_) AddInto(out, *t);
+        out.threads += live_.size();
+        return out;
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mu_);
+        retired_ = InstrumentationSnapshot();
+        for (ThreadTotals* t : live_) Zero(*t);
+    }
+
+private:
+    std::mutex mu_;
+    std::vector<ThreadTotals*> live_;
+    InstrumentationSnapshot retired_;
+};
+
+// Function-local static: constructed before the first thread registers, so it
+// outlives every thread_local LocalSlot (including the main thread's).
+Registry& GlobalRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+struct LocalSlot {
+    ThreadTotals totals;
+    LocalSlot() { GlobalRegistry().Attach(&totals); }
+    ~LocalSlot() { GlobalRegistry().Detach(&totals); }
+};
+
+ThreadTotals& Local() {
+    thread_local LocalSlot slot;
+    return slot.totals;
+}
+
+thread_local ScopedStage* t_currentStage = nullptr;
+
+std::uint64_t NowNs() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+const char* CounterHelp(Counter c) {
+    switch (c) {
+        case Counter::BytesRead:          return "Bytes loaded or memory-mapped from save files.";
+        case Counter::ChecksumBytes:      return "Bytes summed by the checksum kernels.";
+        case Counter::StringsBuilt:       return "Strings built by name decoding and ToString().";
+        case Counter::ResultCacheHits:    return "On-disk result cache hits.";
+        case Counter::ResultCacheMisses:  return "On-disk result cache misses.";
+        case Counter::SectionCacheHits:   return "ReadOnlyData section cache hits.";
+        case Counter::SectionCacheMisses: return "ReadOnlyData section cache misses.";
+    }
+    return "";
+}
+
+} // namespace
+
+// =========================================================
+// Instrumentation
+// =========================================================
+
+void Instrumentation::Add(Counter c, std::uint64_t n) {
+    Bump(Local().counters[static_cast<std::size_t>(c)], n);
+}
+
+InstrumentationSnapshot Instrumentation::Snapshot() {
+    return GlobalRegistry().Snapshot();
+}
+
+void Instrumentation::Reset() {
+    GlobalRegistry().Reset();
+}
+
+const char* Instrumentation::StageName(Stage s) {
+    switch (s) {
+        case Stage::Load:     return "load";
+        case Stage::Backup:   return "backup";
+        case Stage::Validate: return "validate";
+        case Stage::Checksum: return "checksum";
+        case Stage::Decode:   return "decode";
+        case Stage::Format:   return "format";
+    }
+    return "unknown";
+}
+
+const char* Instrumentation::CounterName(Counter c) {
+    switch (c) {
+        case Counter::BytesRead:          return "bytes_read";
+        case Counter::ChecksumBytes:      return "checksum_bytes";
+        case Counter::StringsBuilt:       return "strings_built";
+        case Counter::ResultCacheHits:    return "result_cache_hits";
+        case Counter::ResultCacheMisses:  return "result_cache_misses";
+        case Counter::SectionCacheHits:   return "section_cache_hits";
+        case Counter::SectionCacheMisses: return "section_cache_misses";
+    }
+    return "unknown";
+}
+
+// =========================================================
+// ScopedStage
+// =========================================================
+
+ScopedStage::ScopedStage(Stage stage)
+    : stage_(stage), startNs_(NowNs()), parent_(t_currentStage) {
+    t_currentStage = this;
+}
+
+ScopedStage::~ScopedStage() {
+    const std::uint64_t elapsed = NowNs() - startNs_;
+    t_currentStage = parent_;
+    if (parent_) parent_->childNs_ += elapsed;
+
+    ThreadTotals& t = Local();
+    const std::size_t i = static_cast<std::size_t>(stage_);
+    Bump(t.stageNs[i], elapsed > childNs_ ? elapsed - childNs_ : 0);
+    Bump(t.stageCalls[i], 1);
+}
+
+// =========================================================
+// InstrumentationSnapshot
+// =========================================================
+
+std::string InstrumentationSnapshot::ToString() const {
+    std::ostringstream oss;
+    oss << "Instrumentation (" << threads << " thread(s)"
+        << (Instrumentation::Enabled ? "" : ", compiled out") << ")\n";
+    oss << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        oss << "  " << std::left << std::setw(22) << Instrumentation::StageName(static_cast<Stage>(i))
+            << std::right << std::setw(12) << static_cast<double>(stageNs[i]) / 1e6 << " ms  "
+            << stageCalls[i] << " call(s)\n";
+    }
+    for (std::size_t i = 0; i < kCounterCount; ++i) {
+        oss << "  " << std::left << std::setw(22) << Instrumentation::CounterName(static_cast<Counter>(i))
+            << std::right << std::setw(12) << counters[i] << "\n";
+    }
+    return oss.str();
+}
+
+std::string InstrumentationSnapshot::ToPrometheus() const {
+    std::ostringstream oss;
+
+    oss << "# HELP savegenie_instrumentation_enabled 1 if built with SAVEGENIE_INSTRUMENTATION.\n"
+        << "# TYPE savegenie_instrumentation_enabled gauge\n"
+        << "savegenie_instrumentation_enabled " << (Instrumentation::Enabled ? 1 : 0) << "\n";
+
+    oss << "# HELP savegenie_instrumented_threads Threads that recorded instrumentation data.\n"
+        << "# TYPE savegenie_instrumented_threads gauge\n"
+        << "savegenie_instrumented_threads " << threads << "\n";
+
+    oss << "# HELP savegenie_stage_seconds_total Wall time per stage, excluding nested stages.\n"
+        << "# TYPE savegenie_stage_seconds_total counter\n";
+    oss << std::fixed << std::setprecision(9);
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        oss << "savegenie_stage_seconds_total{stage=\"" << Instrumentation::StageName(static_cast<Stage>(i))
+            << "\"} " << static_cast<double>(stageNs[i]) / 1e9 << "\n";
+    }
+
+    oss << "# HELP savegenie_stage_calls_total Entries into each stage.\n"
+        << "# TYPE savegenie_stage_calls_total counter\n";
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        oss << "savegenie_stage_calls_total{stage=\"" << Instrumentation::StageName(static_cast<Stage>(i))
+            << "\"} " << stageCalls[i] << "\n";
+    }
+
+    for (std::size_t i = 0; i < kCounterCount; ++i) {
+        const Counter c = static_cast<Counter>(i);
+        const std::string name = std::string("savegenie_") + Instrumentation::CounterName(c) + "_total";
+        oss << "# HELP " << name << ' ' << CounterHelp(c) << "\n"
+            << "# TYPE " << name << " counter\n"
+            << name << ' ' << counters[i] << "\n";
+    }
+
+    return oss.str();
+}
+
+} // namespace savegenie
@@ -9,6 +9,9 @@
 //
 
 #include "ReadOnlyData.hpp"
+#include "ChecksumKernels.hpp"
+#include "Instrumentation.hpp"
+#include "SummarySink.hpp"
 #include <algorithm>
 #include <iomanip>
 #include <numeric>
@@ -22,6 +25,8 @@ namespace savegenie {
 // =========================================================
 
 std::string TrainerSummary::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
     oss << "Trainer Name: " << trainerName << "\n";
     oss << "Rival Name:   " << rivalName << "\n";
@@ -69,11 +74,35 @@ std::string TrainerSummary::ToString() const {
     return oss.str();
 }
 
+void TrainerSummary::WriteTo(SummarySink& sink) const {
+    sink.String("name", trainerName);
+    sink.String("rival", rivalName);
+    sink.Uint("trainerId", trainerId);
+    sink.Uint("money", money);
+    sink.Uint("coins", coins);
+    sink.Uint("badges", badges); // bit i = badge i+1 (Boulder .. Earth)
+
+    sink.BeginObject("location");
+    sink.Uint("mapId", mapId);
+    sink.String("mapName", Gen1MapLookup::NameViewFromId(mapId));
+    sink.Uint("x", x);
+    sink.Uint("y", y);
+    sink.EndObject();
+
+    sink.BeginObject("playtime");
+    sink.Uint("hours", playHours);
+    sink.Uint("minutes", playMinutes);
+    sink.Uint("seconds", playSeconds);
+    sink.EndObject();
+}
+
 // =========================================================
 // BoxStats
 // =========================================================
 
 std::string BoxStats::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
     oss << "Box " << boxIndex << ": "
         << pokemonCount << " Pokémon";
@@ -85,11 +114,160 @@ std::string BoxStats::ToString() const {
     return oss.str();
 }
 
+void BoxStats::WriteTo(SummarySink& sink) const {
+    sink.Uint("box", static_cast<std::uint64_t>(boxIndex));
+    sink.Uint("count", static_cast<std::uint64_t>(pokemonCount));
+    sink.Double("avgLevel", averageLevel);
+}
+
+// =========================================================
+// BoxMonTable
+// =========================================================
+
+std::size_t BoxMonTable::TotalCount() const {
+    std::size_t n = 0;
+    for (u8 c : count) n += c;
+    return n;
+}
+
+std::array<u32, 256> BoxMonTable::SpeciesCounts() const {
+    // Empty slots hold species 0, which is not a real species: count everything, then drop [0].
+    std::array<u32, 256> out{};
+    for (std::size_t i = 0; i < Capacity; ++i) out[species[i]]++;
+    out[0] = 0;
+    return out;
+}
+
+std::array<u32, 256> BoxMonTable::LevelHistogram() const {
+    std::array<u32, 256> out{};
+    for (std::size_t i = 0; i < Capacity; ++i) out[level[i]]++;
+    // Remove the empty slots (level 0) so only occupied ones remain.
+    out[0] -= static_cast<u32>(Capacity - TotalCount());
+    return out;
+}
+
+u8 BoxMonTable::HpDV(u16 dv) {
+    return static_cast<u8>(((AttackDV(dv) & 1) << 3) | ((DefenseDV(dv) & 1) << 2) |
+                           ((SpeedDV(dv) & 1) << 1) | (SpecialDV(dv) & 1));
+}
+
+// =========================================================
+// PokemonSummary / PartySummary
+// =========================================================
+
+namespace {
+
+constexpr std::array<std::string_view, Gen1StatCount> kStatKeys = {"hp", "attack", "defense", "speed", "special"};
+
+} // namespace
+
+std::string PokemonSummary::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
+    std::ostringstream oss;
+    oss << "Species ID=" << static_cast<int>(speciesId)
+        << " Species Name: " << speciesName
+        << " Lv " << static_cast<int>(level);
+    if (!nickname.Empty()) oss << " \"" << nickname.View() << "\"";
+    oss << " OT " << otName.View() << " (ID " << otId << ")\n";
+
+    oss << "     HP " << currentHp << "/" << stats.MaxHp()
+        << "  Atk " << stats.values[1] << "  Def " << stats.values[2]
+        << "  Spd " << stats.values[3] << "  Spc " << stats.values[4]
+        << (inParty ? "" : " (computed)") << "\n";
+
+    oss << "     DVs A" << static_cast<int>(BoxMonTable::AttackDV(dvs))
+        << " D" << static_cast<int>(BoxMonTable::DefenseDV(dvs))
+        << " S" << static_cast<int>(BoxMonTable::SpeedDV(dvs))
+        << " C" << static_cast<int>(BoxMonTable::SpecialDV(dvs))
+        << " (HP " << static_cast<int>(BoxMonTable::HpDV(dvs)) << ")  Exp " << exp << "\n";
+
+    oss << "     Moves:";
+    bool any = false;
+    for (std::size_t k = 0; k < moves.size(); ++k) {
+        if (moves[k] == 0) continue;
+        oss << (any ? ", " : " ") << static_cast<int>(moves[k]) << " (PP " << static_cast<int>(pp[k]) << "/"
+            << static_cast<int>(Gen1Stats::MaxPp(moves[k], ppUps[k])) << ")";
+        any = true;
+    }
+    if (!any) oss << " (none)";
+    return oss.str();
+}
+
+void PokemonSummary::WriteTo(SummarySink& sink) const {
+    sink.Uint("slot", static_cast<std::uint64_t>(slot));
+    sink.Uint("speciesId", speciesId);
+    sink.String("species", speciesName);
+    sink.Uint("level", level);
+    sink.String("nickname", nickname.View());
+    sink.String("ot", otName.View());
+    sink.Uint("otId", otId);
+    sink.Uint("hp", currentHp);
+    sink.Uint("status", status);
+    sink.Uint("type1", type1);
+    sink.Uint("type2", type2);
+    sink.Uint("catchRate", catchRate);
+    sink.Uint("exp", exp);
+
+    sink.BeginObject("stats");
+    for (std::size_t s = 0; s < Gen1StatCount; ++s) sink.Uint(kStatKeys[s], stats.values[s]);
+    sink.Bool("computed", !inParty);
+    sink.EndObject();
+
+    sink.BeginObject("dvs");
+    sink.Uint("hp", BoxMonTable::HpDV(dvs));
+    sink.Uint("attack", BoxMonTable::AttackDV(dvs));
+    sink.Uint("defense", BoxMonTable::DefenseDV(dvs));
+    sink.Uint("speed", BoxMonTable::SpeedDV(dvs));
+    sink.Uint("special", BoxMonTable::SpecialDV(dvs));
+    sink.EndObject();
+
+    sink.BeginObject("statExp");
+    for (std::size_t s = 0; s < Gen1StatCount; ++s) sink.Uint(kStatKeys[s], statExp[s]);
+    sink.EndObject();
+
+    sink.BeginArray("moves");
+    for (std::size_t k = 0; k < moves.size(); ++k) {
+        if (moves[k] == 0) continue;
+        sink.BeginObject({});
+        sink.Uint("id", moves[k]);
+        sink.Uint("pp", pp[k]);
+        sink.Uint("ppUps", ppUps[k]);
+        sink.Uint("maxPp", Gen1Stats::MaxPp(moves[k], ppUps[k]));
+        sink.EndObject();
+    }
+    sink.EndArray();
+}
+
+std::string PartySummary::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
+    std::ostringstream oss;
+    oss << "--- Party (" << count << " Pokémon) ---\n";
+    for (const PokemonSummary& mon : mons) {
+        oss << "  " << (mon.slot + 1) << ") " << mon.ToString() << "\n";
+    }
+    return oss.str();
+}
+
+void PartySummary::WriteTo(SummarySink& sink) const {
+    sink.Uint("count", static_cast<std::uint64_t>(count));
+    sink.BeginArray("mons");
+    for (const PokemonSummary& mon : mons) {
+        sink.BeginObject({});
+        mon.WriteTo(sink);
+        sink.EndObject();
+    }
+    sink.EndArray();
+}
+
 // =========================================================
 // FlagSummary
 // =========================================================
 
 std::string FlagSummary::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
     oss << "Flags Checked: " << totalFlagsChecked << "\n";
     oss << "Flags Set:     " << totalFlagsSet << "\n";
@@ -108,11 +286,21 @@ std::string FlagSummary::ToString() const {
     return oss.str();
 }
 
+void FlagSummary::WriteTo(SummarySink& sink) const {
+    sink.Uint("checked", static_cast<std::uint64_t>(totalFlagsChecked));
+    sink.Uint("set", static_cast<std::uint64_t>(totalFlagsSet));
+    sink.BeginArray("setIndices");
+    for (int idx : setFlagIndices) sink.Uint({}, static_cast<std::uint64_t>(idx));
+    sink.EndArray();
+}
+
 // =========================================================
 // PokedexSummary
 // =========================================================
 
 std::string PokedexSummary::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
     oss << "Owned: " << ownedCount << " / 151\n";
     oss << "Seen:  " << seenCount << " / 151\n";
@@ -146,6 +334,19 @@ std::string PokedexSummary::ToString() const {
     return oss.str();
 }
 
+void PokedexSummary::WriteTo(SummarySink& sink) const {
+    sink.Uint("owned", static_cast<std::uint64_t>(ownedCount));
+    sink.Uint("seen", static_cast<std::uint64_t>(seenCount));
+
+    sink.BeginArray("ownedDex");
+    for (int dexNo : ownedDexNos) sink.Uint({}, static_cast<std::uint64_t>(dexNo));
+    sink.EndArray();
+
+    sink.BeginArray("seenDex");
+    for (int dexNo : seenDexNos) sink.Uint({}, static_cast<std::uint64_t>(dexNo));
+    sink.EndArray();
+}
+
 // =========================================================
 // HallOfFamePokemon / HallOfFameEntry
 // =========================================================
@@ -156,7 +357,7 @@ static bool IsLikelyValidGen1SpeciesId(savegenie::u8 speciesId) {
     return speciesId >= 1 && speciesId <= 151;
 }
 
-static bool NameLooksReasonable(const std::string& s) {
+static bool NameLooksReasonable(std::string_view s) {
     // Minimal heuristic: not empty, not mostly '?'
     if (s.empty()) return false;
     int q = 0;
@@ -171,18 +372,29 @@ static bool NameLooksReasonable(const std::string& s) {
 }
 
 std::string HallOfFamePokemon::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
     oss << "Species ID=" << static_cast<int>(speciesId)
         << " Species Name: " << speciesName
         << " Lv " << static_cast<int>(level);
 
-    if (!name.empty()) {
-        oss << " \"" << name << "\"";
+    if (!name.Empty()) {
+        oss << " \"" << name.View() << "\"";
     }
     return oss.str();
 }
 
+void HallOfFamePokemon::WriteTo(SummarySink& sink) const {
+    sink.Uint("speciesId", speciesId);
+    sink.String("species", speciesName);
+    sink.Uint("level", level);
+    sink.String("nickname", name.View());
+}
+
 std::string HallOfFameEntry::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
     oss << "Entry #" << entryIndex << ":\n";
     for (std::size_t i = 0; i < team.size(); ++i) {
@@ -191,11 +403,130 @@ std::string HallOfFameEntry::ToString() const {
     return oss.str();
 }
 
+void HallOfFameEntry::WriteTo(SummarySink& sink) const {
+    sink.Uint("entry", static_cast<std::uint64_t>(entryIndex));
+    sink.BeginArray("team");
+    for (const auto& mon : team) {
+        sink.BeginObject({});
+        mon.WriteTo(sink);
+        sink.EndObject();
+    }
+    sink.EndArray();
+}
+
+// =========================================================
+// Hall of Fame views
+// =========================================================
+
+Gen1Name HallOfFameMonView::DecodeName() const {
+    return Gen1TextCodec::DecodeNameInline(SaveView(entry_), Gen1Layout::HallOfFameMonNameRel,
+                                           Gen1Layout::HallOfFameMonNameLen);
+}
+
+HallOfFamePokemon HallOfFameMonView::ToModel() const {
+    HallOfFamePokemon mon;
+    mon.speciesId = SpeciesId();
+    mon.speciesName = SpeciesName();
+    mon.level = Level();
+    mon.name = DecodeName();
+    return mon;
+}
+
+void HallOfFameMonView::WriteTo(SummarySink& sink) const {
+    sink.Uint("speciesId", SpeciesId());
+    sink.String("species", SpeciesName());
+    sink.Uint("level", Level());
+    sink.String("nickname", DecodeName().View());
+}
+
+HallOfFameMonView HallOfFameRecordView::Iterator::operator*() const {
+    return rec_->Slot(std::countr_zero(remaining_));
+}
+
+HallOfFameEntry HallOfFameRecordView::ToModel() const {
+    HallOfFameEntry entry;
+    entry.entryIndex = entryIndex_;
+    for (const HallOfFameMonView mon : *this) {
+        entry.team.push_back(mon.ToModel());
+    }
+    return entry;
+}
+
+void HallOfFameRecordView::WriteTo(SummarySink& sink) const {
+    sink.Uint("entry", static_cast<std::uint64_t>(entryIndex_));
+    sink.BeginArray("team");
+    for (const HallOfFameMonView mon : *this) {
+        sink.BeginObject({});
+        mon.WriteTo(sink);
+        sink.EndObject();
+    }
+    sink.EndArray();
+}
+
+HallOfFameRange::HallOfFameRange(SaveView data) {
+    // Hint count lives in Bank 1.
+    const int rawCountHint = static_cast<int>(data.ReadU8(Gen1Layout::HallOfFameRecordCountOff));
+    const int countHint = std::clamp(rawCountHint, 0, Gen1Layout::HallOfFameMaxRecords);
+
+    // Ensure the HoF block exists; every record/slot below lies inside it.
+    block_ = data.Subspan(Gen1Layout::HallOfFameOff, Gen1Layout::HallOfFameLen);
+
+    // If the game says 0, show nothing.
+    // Otherwise keep the newest `countHint` valid records (or all, if fewer).
+    int found = 0;
+    for (int i = Gen1Layout::HallOfFameMaxRecords - 1; i >= 0 && found < countHint; --i) {
+        const u8 slots = ValidateRecord(i);
+        if (slots == 0) continue;
+        slotMasks_[static_cast<std::size_t>(i)] = slots;
+        records_ |= u64{1} << i;
+        ++found;
+    }
+}
+
+HallOfFameRecordView HallOfFameRange::Iterator::operator*() const {
+    return range_->Record(std::countr_zero(remaining_), ordinal_);
+}
+
+HallOfFameRecordView HallOfFameRange::Record(int i, int entryIndex) const {
+    return HallOfFameRecordView(block_.subspan(static_cast<std::size_t>(i) * Gen1Layout::HallOfFameRecordSize,
+                                               Gen1Layout::HallOfFameRecordSize),
+                                slotMasks_[static_cast<std::size_t>(i)], entryIndex);
+}
+
+u8 HallOfFameRange::ValidateRecord(int i) const {
+    // Bank 0 is not checksum-protected, so every slot is sanity-checked.
+    // A bad first slot rejects the record; later bad slots are skipped.
+    const HallOfFameRecordView all = Record(i, 0);
+    u8 valid = 0;
+
+    for (int j = 0; j < Gen1Layout::HallOfFameMonsPerRecord; ++j) {
+        const HallOfFameMonView mon = all.Slot(j);
+        const u8 species = mon.SpeciesId();
+        const u8 level = mon.Level();
+
+        // Empty slot heuristics
+        if (species == 0x00 || species == 0xFF) break;
+
+        const bool ok = IsLikelyValidGen1SpeciesId(species)
+            && level >= 1 && level <= 100
+            && NameLooksReasonable(mon.DecodeName().View()); // helps reject junk
+        if (!ok) {
+            if (j == 0) return 0;
+            continue;
+        }
+
+        valid = static_cast<u8>(valid | (1u << j));
+    }
+    return valid;
+}
+
 // =========================================================
 // BagItem / BagSummary
 // =========================================================
 
 std::string BagItem::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
 
     // Example output:
@@ -217,7 +548,15 @@ std::string BagItem::ToString() const {
     return oss.str();
 }
 
+void BagItem::WriteTo(SummarySink& sink) const {
+    sink.Uint("id", itemId);
+    sink.String("name", itemName.empty() ? Gen1ItemLookup::NameViewFromId(itemId) : itemName);
+    sink.Uint("qty", quantity);
+}
+
 std::string BagSummary::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     std::ostringstream oss;
 
     oss << "Item Count: " << itemCount << "\n"; // Types of items
@@ -227,84 +566,158 @@ std::string BagSummary::ToString() const {
     return oss.str();
 }
 
+void BagSummary::WriteTo(SummarySink& sink) const {
+    sink.Uint("count", static_cast<std::uint64_t>(itemCount));
+    sink.BeginArray("items");
+    for (const auto& item : items) {
+        sink.BeginObject({});
+        item.WriteTo(sink);
+        sink.EndObject();
+    }
+    sink.EndArray();
+}
+
 // =========================================================
-// ReadOnlyData::GetBagSummary
+// SaveSnapshot
 // =========================================================
 
-BagSummary ReadOnlyData::GetBagSummary(bool includeNamesAndHex) const {
-    BagSummary out;
-
-    // Bag list lives in Bank 1 main data
-    buffer_.RequireRange(Gen1Layout::BagItemsOff, Gen1Layout::BagItemsLen);
-
-    const u8 rawCount = buffer_.ReadU8(Gen1Layout::BagItemsCountOff);
-    // Defensive clamp: Gen I bag typically supports up to 20 items
-    out.itemCount = std::clamp<int>(static_cast<int>(rawCount), 0, Gen1Layout::BagItemsMaxPairs);
-
-    std::size_t off = Gen1Layout::BagItemsPairsOff;
+std::string SaveSnapshot::ToString() const {
+    SAVEGENIE_STAGE(Format);
+    std::ostringstream oss;
 
-    for (int i = 0; i < out.itemCount; ++i) {
-        // Each entry is (itemId, qty)
-        buffer_.RequireRange(off, 2);
+    oss << "=== Save Genie Summary ===\n\n";
 
-        const u8 itemId = buffer_.ReadU8(off + 0);
-        const u8 qty    = buffer_.ReadU8(off + 1);
+    oss << trainer.ToString() << "\n";
 
-        // Defensive stop: many Gen I lists terminate with 0xFF
-        if (itemId == 0xFF) break;
+    // Checksums (one pass over all checksummed regions)
+    oss << "Main Checksum: " << (integrity.MainValid() ? "VALID" : "INVALID") << "\n";
+    oss << "Bank2 All Checksum: " << (integrity.BankAllValid(2) ? "VALID" : "INVALID") << "\n";
+    oss << "Bank3 All Checksum: " << (integrity.BankAllValid(3) ? "VALID" : "INVALID") << "\n";
+    oss << "Box Checksums: " << integrity.ValidBoxCount() << " / 12 VALID\n";
 
-        BagItem bi;
-        bi.itemId = itemId;
-        bi.quantity = qty;
+    // Pokédex
+    oss << "--- Pokédex ---\n";
+    oss << pokedex.ToString() << "\n";
 
-        if (includeNamesAndHex) {
-            bi.itemName = Gen1ItemLookup::NameFromId(itemId);
-            bi.itemHex  = Gen1ItemLookup::ItemHex[static_cast<std::size_t>(itemId)];
+    // Hall of Fame (only if present and record-count hint > 0)
+    if (!hallOfFame.empty()) {
+        oss << "--- Hall of Fame ---\n";
+        for (const auto& entry : hallOfFame) {
+            oss << entry.ToString();
         }
+        oss << "\n";
+    }
 
-        out.items.push_back(std::move(bi));
-        off += 2;
+    // Boxes (quick stats)
+    oss << "--- PC Boxes (Stats) ---\n";
+    for (const BoxStats& bs : boxes) {
+        oss << bs.ToString() << "\n";
     }
+    oss << "\n";
+    
+    
+    oss << "--- Bag ---\n";
+    oss << bag.ToString() << "\n";
 
-    return out;
-}
+    oss << "--- PC Item Box ---\n";
+    oss << pcItemBox.ToString() << "\n";
+    
+    
+    // Event flags
+    oss << "--- Event Flags (Summary) ---\n";
+    oss << eventFlags.ToString() << "\n";
 
+    return oss.str();
+}
 
-// =========================================================
-// PC Item Box Summary
-// =========================================================
-BagSummary ReadOnlyData::GetPCItemBoxSummary(bool includeNamesAndHex) const {
-    BagSummary out;
+void SaveSnapshot::WriteTo(SummarySink& sink) const {
+    SAVEGENIE_STAGE(Format);
+    sink.BeginObject("trainer");
+    trainer.WriteTo(sink);
+    sink.EndObject();
+
+    sink.BeginObject("checksums");
+    sink.Bool("main", integrity.MainValid());
+    sink.Bool("bank2", integrity.BankAllValid(2));
+    sink.Bool("bank3", integrity.BankAllValid(3));
+    sink.Uint("boxesValid", static_cast<std::uint64_t>(integrity.ValidBoxCount()));
+    sink.EndObject();
+
+    // Dex numbers only (PokedexSummary::WriteTo skips names); names are a lookup away for consumers.
+    sink.BeginObject("pokedex");
+    pokedex.WriteTo(sink);
+    sink.EndObject();
+
+    sink.BeginArray("hallOfFame");
+    for (const HallOfFameEntry& entry : hallOfFame) {
+        sink.BeginObject({});
+        entry.WriteTo(sink);
+        sink.EndObject();
+    }
+    sink.EndArray();
 
-    buffer_.RequireRange(Gen1Layout::PCItemBoxOff, Gen1Layout::PCItemBoxLen);
+    sink.BeginArray("boxes");
+    for (const BoxStats& bs : boxes) {
+        sink.BeginObject({});
+        bs.WriteTo(sink);
+        sink.EndObject();
+    }
+    sink.EndArray();
 
-    const u8 rawCount = buffer_.ReadU8(Gen1Layout::PCItemBoxCountOff);
-    out.itemCount = std::clamp<int>(static_cast<int>(rawCount), 0, Gen1Layout::PCItemBoxMaxPairs);
+    sink.BeginObject("bag");
+    bag.WriteTo(sink);
+    sink.EndObject();
 
-    std::size_t off = Gen1Layout::PCItemBoxPairsOff;
+    sink.BeginObject("pcItems");
+    pcItemBox.WriteTo(sink);
+    sink.EndObject();
 
-    for (int i = 0; i < out.itemCount; ++i) {
-        buffer_.RequireRange(off, 2);
+    sink.BeginObject("eventFlags");
+    eventFlags.WriteTo(sink);
+    sink.EndObject();
+}
 
-        const u8 itemId = buffer_.ReadU8(off + 0);
-        const u8 qty    = buffer_.ReadU8(off + 1);
+// =========================================================
+// ReadOnlyData::GetBagSummary
+// =========================================================
 
-        // Defensive stop: list terminator
-        if (itemId == 0xFF) break;
+namespace {
 
+// Bag and PC item box share the list format; only the field differs.
+void SummarizeItemList(const Gen1ItemList& list, bool includeNamesAndHex, BagSummary& out) {
+    out.items.clear();
+    out.itemCount = list.DeclaredCount();
+    list.ForEach([&](u8 itemId, u8 qty) {
         BagItem bi;
         bi.itemId = itemId;
         bi.quantity = qty;
 
         if (includeNamesAndHex) {
-            bi.itemName = Gen1ItemLookup::NameFromId(itemId);
+            bi.itemName = Gen1ItemLookup::NameViewFromId(itemId);
             bi.itemHex  = Gen1ItemLookup::ItemHex[static_cast<std::size_t>(itemId)];
         }
 
         out.items.push_back(std::move(bi));
-        off += 2;
-    }
+    });
+}
 
+} // namespace
+
+BagSummary ReadOnlyData::ParseBagSummary(bool includeNamesAndHex) const {
+    SAVEGENIE_STAGE(Decode);
+    BagSummary out;
+    SummarizeItemList(BagItemsField::Read(Data()), includeNamesAndHex, out);
+    return out;
+}
+
+
+// =========================================================
+// PC Item Box Summary
+// =========================================================
+BagSummary ReadOnlyData::ParsePCItemBoxSummary(bool includeNamesAndHex) const {
+    SAVEGENIE_STAGE(Decode);
+    BagSummary out;
+    SummarizeItemList(PCItemBoxField::Read(Data()), includeNamesAndHex, out);
     return out;
 }
 // =========================================================
@@ -312,335 +725,503 @@ BagSummary ReadOnlyData::GetPCItemBoxSummary(bool includeNamesAndHex) const {
 // =========================================================
 
 ReadOnlyData::ReadOnlyData(const SaveBuffer& buffer)
-: buffer_(buffer) {}
-
-TrainerSummary ReadOnlyData::GetTrainerSummary() const {
-    TrainerSummary out;
-
-    // Names
-    out.trainerName = Gen1TextCodec::DecodeName(buffer_, Gen1Layout::TrainerNameOff, Gen1Layout::TrainerNameLen);
-    out.rivalName   = Gen1TextCodec::DecodeName(buffer_, Gen1Layout::RivalNameOff,   Gen1Layout::RivalNameLen);
+: source_(&buffer) {}
 
-    // Trainer ID
-    const u8 hi = buffer_.ReadU8(Gen1Layout::TrainerIdOff);
-    const u8 lo = buffer_.ReadU8(Gen1Layout::TrainerIdOff + 1);
-    out.trainerId = static_cast<u16>((hi << 8) | lo);
-    
-    // Money / Coins
-    out.money = BcdCodec::ReadBcd3(buffer_, Gen1Layout::MoneyOff);
-    out.coins = BcdCodec::ReadBcd2(buffer_, Gen1Layout::CoinsOff);
+ReadOnlyData::ReadOnlyData(SaveView view)
+: view_(view) {}
 
-    // Badges
-    out.badges = buffer_.ReadU8(Gen1Layout::BadgesOff);
+SaveView ReadOnlyData::Data() const {
+    // Re-derive the view from the owning buffer on every call so a reader bound
+    // to a SaveBuffer stays valid even if that buffer is reloaded/resized.
+    return source_ ? source_->View() : view_;
+}
 
-    // Location
-    out.mapId = buffer_.ReadU8(Gen1Layout::MapIdOff);
-    out.x     = buffer_.ReadU8(Gen1Layout::XCoordOff);
-    out.y     = buffer_.ReadU8(Gen1Layout::YCoordOff);
+// ---- Section cache ----
 
-    // Playtime
-    out.playHours   = buffer_.ReadU8(Gen1Layout::PlayTimeHoursOff);
-    out.playMinutes = buffer_.ReadU8(Gen1Layout::PlayTimeMinutesOff);
-    out.playSeconds = buffer_.ReadU8(Gen1Layout::PlayTimeSecondsOff);
+void ReadOnlyData::EnableCache(bool enabled) {
+    if (!enabled) {
+        cache_.reset();
+    } else if (!cache_) {
+        cache_ = std::make_unique<SectionCache>();
+        cache_->generation = source_ ? source_->Generation() : 0;
+    }
+}
 
-    return out;
+void ReadOnlyData::InvalidateCache() {
+    if (cache_) {
+        *cache_ = SectionCache();
+        cache_->generation = source_ ? source_->Generation() : 0;
+    }
 }
 
-// Gen I full box layout refresher:
-// Each box block is 0x462 bytes.
-// - Count: 1 byte
-// - Species list: 20 bytes (+ 0xFF terminator in practice)
-// - Padding: 1 byte
-// - Box Pokémon data: 20 entries * 0x21 bytes
-// Level is stored inside the 0x21-byte "box Pokémon" struct.
-// For MVP stats, we only compute count and average of the level byte.
-BoxStats ReadOnlyData::GetBoxStats(int boxIndex1to12) const {
-    if (boxIndex1to12 < 1 || boxIndex1to12 > 12) {
-        throw std::out_of_range("GetBoxStats: box index must be 1..12");
+ReadOnlyData::SectionCache* ReadOnlyData::FreshCache() const {
+    if (!cache_) return nullptr;
+    const std::uint64_t gen = source_ ? source_->Generation() : 0;
+    if (cache_->generation != gen) {
+        *cache_ = SectionCache();
+        cache_->generation = gen;
     }
+    return cache_.get();
+}
 
-    BoxStats stats;
-    stats.boxIndex = boxIndex1to12;
+// Cached value in `slot` (parsed on first use), or a fresh parse if caching is off.
+template <class T, class ParseFn>
+static T Memo(std::optional<T>* slot, ParseFn&& parse) {
+    if (!slot) return parse();
+    if (!*slot) {
+        SAVEGENIE_COUNT(SectionCacheMisses, 1);
+        *slot = parse();
+    } else {
+        SAVEGENIE_COUNT(SectionCacheHits, 1);
+    }
+    return **slot;
+}
 
-    const std::size_t base = Gen1Layout::BoxBaseOffsetByIndex1to12(boxIndex1to12);
+// A section served from a cached SaveSnapshot (full decode already done).
+template <class T>
+static T FromSnapshot(const T& section) {
+    SAVEGENIE_COUNT(SectionCacheHits, 1);
+    return section;
+}
 
-    // Byte 0: count
-    const int count = static_cast<int>(buffer_.ReadU8(base));
-    stats.pokemonCount = std::clamp(count, 0, 20);
+// The snapshot always carries names; the name-less Get* variants drop them.
+static PokedexSummary WithoutNames(PokedexSummary s) {
+    s.ownedNames.clear();
+    s.seenNames.clear();
+    return s;
+}
 
-    if (stats.pokemonCount == 0) {
-        stats.averageLevel = 0.0;
-        return stats;
+static BagSummary WithoutNames(BagSummary s) {
+    for (BagItem& item : s.items) {
+        item.itemName = {};
+        item.itemHex = {};
     }
+    return s;
+}
 
-    // Levels inside box Pokémon structs:
-    // The 20 * 0x21 structs start after:
-    // 1 (count) + 20 (species list) + 1 (padding) = 22 bytes = 0x16
-    const std::size_t structsBase = base + 0x16;
+TrainerSummary ReadOnlyData::GetTrainerSummary() const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) return FromSnapshot(c->snapshot->trainer);
+    return Memo(c ? &c->trainer : nullptr, [&] { return ParseTrainerSummary(); });
+}
 
-    // We will assume the level is at offset 0x03 within each 0x21 struct.
-    // NOTE: If later research shows a different offset, update this constant.
-    constexpr std::size_t kBoxMonStructSize = 0x21;
-    constexpr std::size_t kLevelOffsetInStruct = 0x03;
+IntegrityReport ReadOnlyData::GetIntegrityReport() const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) return FromSnapshot(c->snapshot->integrity);
+    return Memo(c ? &c->integrity : nullptr, [&] { return Gen1Checksum::ScanAll(Data()); });
+}
 
-    int levelSum = 0;
-    int levelCount = 0;
+BoxStats ReadOnlyData::GetBoxStats(int boxIndex1to12) const {
+    if (boxIndex1to12 < 1 || boxIndex1to12 > 12) {
+        throw std::out_of_range("GetBoxStats: box index must be 1..12");
+    }
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) return FromSnapshot(c->snapshot->boxes[static_cast<std::size_t>(boxIndex1to12 - 1)]);
+    auto* slot = c ? &c->boxes[static_cast<std::size_t>(boxIndex1to12 - 1)] : nullptr;
+    return Memo(slot, [&] { return ParseBoxStats(boxIndex1to12); });
+}
 
-    for (int i = 0; i < stats.pokemonCount; ++i) {
-        const std::size_t monBase = structsBase + static_cast<std::size_t>(i) * kBoxMonStructSize;
-        const int level = static_cast<int>(buffer_.ReadU8(monBase + kLevelOffsetInStruct));
-        // Sanity: level should be 1..100 typically
-        if (level >= 1 && level <= 100) {
-            levelSum += level;
-            levelCount++;
-        }
+FlagSummary ReadOnlyData::GetEventFlagSummary() const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) return FromSnapshot(c->snapshot->eventFlags);
+    return Memo(c ? &c->eventFlags : nullptr, [&] { return ParseEventFlagSummary(); });
+}
+
+PokedexSummary ReadOnlyData::GetPokedexSummary(bool includeNames) const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) {
+        return includeNames ? FromSnapshot(c->snapshot->pokedex) : WithoutNames(FromSnapshot(c->snapshot->pokedex));
     }
+    return Memo(c ? &c->pokedex[includeNames ? 1 : 0] : nullptr, [&] { return ParsePokedexSummary(includeNames); });
+}
 
-    stats.averageLevel = (levelCount > 0) ? (static_cast<double>(levelSum) / static_cast<double>(levelCount)) : 0.0;
-    return stats;
+BagSummary ReadOnlyData::GetBagSummary(bool includeNamesAndHex) const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) {
+        return includeNamesAndHex ? FromSnapshot(c->snapshot->bag) : WithoutNames(FromSnapshot(c->snapshot->bag));
+    }
+    return Memo(c ? &c->bag[includeNamesAndHex ? 1 : 0] : nullptr, [&] { return ParseBagSummary(includeNamesAndHex); });
 }
 
-// Event flag summary:
-// Bulbapedia lists a large completed-game-events bitfield (0x29F3, length 0x140).
-// For MVP, we count set bits and list indices.
-FlagSummary ReadOnlyData::GetEventFlagSummary() const {
-    FlagSummary out;
+BagSummary ReadOnlyData::GetPCItemBoxSummary(bool includeNamesAndHex) const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) {
+        return includeNamesAndHex ? FromSnapshot(c->snapshot->pcItemBox)
+                                  : WithoutNames(FromSnapshot(c->snapshot->pcItemBox));
+    }
+    return Memo(c ? &c->pcItemBox[includeNamesAndHex ? 1 : 0] : nullptr,
+                [&] { return ParsePCItemBoxSummary(includeNamesAndHex); });
+}
 
-    constexpr std::size_t kEventFlagsOff = 0x29F3;
-    constexpr std::size_t kEventFlagsLen = 0x140;
+HallOfFameList ReadOnlyData::GetHallOfFame() const {
+    SectionCache* c = FreshCache();
+    if (c && c->snapshot) return FromSnapshot(c->snapshot->hallOfFame);
+    return Memo(c ? &c->hallOfFame : nullptr, [&] { return ParseHallOfFame(); });
+}
 
-    buffer_.RequireRange(kEventFlagsOff, kEventFlagsLen);
+BoxMonTable ReadOnlyData::GetBoxMons() const {
+    SectionCache* c = FreshCache();
+    return Memo(c ? &c->boxMons : nullptr, [&] {
+        BoxMonTable t;
+        DecodeBoxMons(t);
+        return t;
+    });
+}
 
-    int totalChecked = static_cast<int>(kEventFlagsLen) * 8;
-    int totalSet = 0;
+PartySummary ReadOnlyData::GetParty() const {
+    SectionCache* c = FreshCache();
+    return Memo(c ? &c->party : nullptr, [&] { return ParseParty(); });
+}
 
-    for (std::size_t i = 0; i < kEventFlagsLen; ++i) {
-        const u8 b = buffer_.ReadU8(kEventFlagsOff + i);
-        totalSet += CountBits(b);
+namespace {
+
+u16 LoadBE16(const u8* p) { return static_cast<u16>((p[0] << 8) | p[1]); }
+
+// One mon of the party / box block at `blockOff` (count byte first).
+PokemonSummary DecodeMon(SaveView data, std::size_t blockOff, int slot, bool party) {
+    const std::size_t structSize = party ? Gen1Layout::PartyMonStructSize : Gen1Layout::BoxMonStructSize;
+    const std::size_t dataRel = party ? Gen1Layout::PartyMonDataRel : Gen1Layout::BoxMonDataRel;
+    const std::size_t s = static_cast<std::size_t>(slot);
+    const u8* m = data.Subspan(blockOff + dataRel + s * structSize, structSize).data();
+
+    PokemonSummary mon;
+    mon.slot = slot;
+    mon.inParty = party;
+    mon.speciesId = m[Gen1Layout::MonSpeciesRel];
+    mon.speciesName = Gen1SpeciesLookup::NameViewFromId(mon.speciesId);
+    mon.currentHp = LoadBE16(m + Gen1Layout::MonCurrentHpRel);
+    mon.level = m[party ? Gen1Layout::MonPartyLevelRel : Gen1Layout::MonBoxLevelRel];
+    mon.status = m[Gen1Layout::MonStatusRel];
+    mon.type1 = m[Gen1Layout::MonType1Rel];
+    mon.type2 = m[Gen1Layout::MonType2Rel];
+    mon.catchRate = m[Gen1Layout::MonCatchRateRel];
+    mon.otId = LoadBE16(m + Gen1Layout::MonOTIdRel);
+    mon.exp = (static_cast<u32>(m[Gen1Layout::MonExpRel]) << 16)
+            | (static_cast<u32>(m[Gen1Layout::MonExpRel + 1]) << 8)
+            | static_cast<u32>(m[Gen1Layout::MonExpRel + 2]);
+    mon.dvs = LoadBE16(m + Gen1Layout::MonDVsRel);
+    for (std::size_t k = 0; k < Gen1StatCount; ++k) mon.statExp[k] = LoadBE16(m + Gen1Layout::MonStatExpRel + 2 * k);
+    for (std::size_t k = 0; k < 4; ++k) {
+        const u8 ppByte = m[Gen1Layout::MonPPRel + k];
+        mon.moves[k] = m[Gen1Layout::MonMovesRel + k];
+        mon.pp[k] = static_cast<u8>(ppByte & 0x3F);
+        mon.ppUps[k] = static_cast<u8>(ppByte >> 6);
+    }
 
-        if (b != 0) {
-            for (int bit = 0; bit < 8; ++bit) {
-                if (b & static_cast<u8>(1u << bit)) {
-                    out.setFlagIndices.push_back(static_cast<int>(i * 8 + bit));
-                }
-            }
+    if (party) {
+        for (std::size_t k = 0; k < Gen1StatCount; ++k) {
+            mon.stats.values[k] = LoadBE16(m + Gen1Layout::MonMaxHpRel + 2 * k);
         }
+    } else if (const Gen1BaseStats* base = Gen1Stats::ForSpecies(mon.speciesId)) {
+        mon.stats = Gen1Stats::Compute(*base, mon.dvs, mon.statExp, mon.level);
     }
 
-    out.totalFlagsChecked = totalChecked;
-    out.totalFlagsSet = totalSet;
-
-    return out;
+    const std::size_t nameRel = s * Gen1Layout::NameFieldLen;
+    mon.otName = Gen1TextCodec::DecodeNameInline(
+        data, blockOff + (party ? Gen1Layout::PartyOTNamesRel : Gen1Layout::BoxOTNamesRel) + nameRel,
+        Gen1Layout::NameFieldLen);
+    mon.nickname = Gen1TextCodec::DecodeNameInline(
+        data, blockOff + (party ? Gen1Layout::PartyNicknamesRel : Gen1Layout::BoxNicknamesRel) + nameRel,
+        Gen1Layout::NameFieldLen);
+    return mon;
 }
 
-PokedexSummary ReadOnlyData::GetPokedexSummary(bool includeNames) const {
-    PokedexSummary out;
-
-    // Read bitsets
-    buffer_.RequireRange(Gen1Layout::PokedexOwnedOff, Gen1Layout::PokedexBitsLen);
-    buffer_.RequireRange(Gen1Layout::PokedexSeenOff,  Gen1Layout::PokedexBitsLen);
+void DecodeTrainer(SaveView data, TrainerSummary& out) {
+    // Names
+    out.trainerName = Gen1TextCodec::DecodeName(data, TrainerNameField::Off, TrainerNameField::Len);
+    out.rivalName   = Gen1TextCodec::DecodeName(data, RivalNameField::Off, RivalNameField::Len);
 
-    const auto ownedBytes = buffer_.Slice(Gen1Layout::PokedexOwnedOff, Gen1Layout::PokedexBitsLen);
-    const auto seenBytes  = buffer_.Slice(Gen1Layout::PokedexSeenOff,  Gen1Layout::PokedexBitsLen);
+    out.trainerId = TrainerIdField::Read(data);
+    out.money     = MoneyField::Read(data);
+    out.coins     = CoinsField::Read(data);
+    out.badges    = FieldCodec<Gen1Field::Badges>::Read(data);
 
-    // 0x13 bytes = 152 bits; we use Dex #1..151.
-    for (int dexNo = 1; dexNo <= 151; ++dexNo) {
-        const int bitIndex = dexNo - 1;
-        const int byteIndex = bitIndex / 8;
-        const int bitInByte = bitIndex % 8;
+    // Location
+    out.mapId = FieldCodec<Gen1Field::MapId>::Read(data);
+    out.x     = FieldCodec<Gen1Field::XCoord>::Read(data);
+    out.y     = FieldCodec<Gen1Field::YCoord>::Read(data);
 
-        const u8 ownedB = ownedBytes[static_cast<std::size_t>(byteIndex)];
-        const u8 seenB  = seenBytes[static_cast<std::size_t>(byteIndex)];
+    // Playtime
+    out.playHours   = FieldCodec<Gen1Field::PlayHours>::Read(data);
+    out.playMinutes = FieldCodec<Gen1Field::PlayMinutes>::Read(data);
+    out.playSeconds = FieldCodec<Gen1Field::PlaySeconds>::Read(data);
+}
 
-        const bool owned = (ownedB & static_cast<u8>(1u << bitInByte)) != 0;
-        const bool seen  = (seenB  & static_cast<u8>(1u << bitInByte)) != 0;
 
-        if (owned) {
-            out.ownedCount++;
-            out.ownedDexNos.push_back(dexNo);
-        }
-        if (seen) {
-            out.seenCount++;
-            out.seenDexNos.push_back(dexNo);
-        }
+// Gen I full box layout refresher (see Gen1Layout Box*Rel / Mon*Rel):
+// Each box block is 0x462 bytes.
+// - Count: 1 byte
+// - Species list: 20 bytes (+ 0xFF terminator in practice)
+// - Padding: 1 byte
+// - Box Pokémon data: 20 entries * 0x21 bytes
+// - OT names, then nicknames: 20 entries * 11 bytes each
+// Level is stored inside the 0x21-byte "box Pokémon" struct.
+// For MVP stats, we only compute count and average of the level byte.
+void SummarizeBox(std::span<const u8> block, int boxIndex1to12, BoxStats& stats) {
+    stats.boxIndex = boxIndex1to12;
+    stats.pokemonCount = std::clamp(static_cast<int>(block[0]), 0, Gen1Layout::BoxMaxMons);
 
-        if (includeNames) {
-            // DexNo -> internal SpeciesID -> name
-            const int speciesId = Gen1SpeciesLookup::PokeDex[dexNo];
-            const std::string name = (speciesId >= 0) ? Gen1SpeciesLookup::NameFromId(static_cast<u8>(speciesId)) : "INVALID";
+    int levelSum = 0;
+    int levelCount = 0;
 
-            if (owned) out.ownedNames.push_back(name);
-            if (seen)  out.seenNames.push_back(name);
+    for (int i = 0; i < stats.pokemonCount; ++i) {
+        const std::size_t monRel = Gen1Layout::BoxMonDataRel + static_cast<std::size_t>(i) * Gen1Layout::BoxMonStructSize;
+        const int level = static_cast<int>(block[monRel + Gen1Layout::MonBoxLevelRel]);
+        // Sanity: level should be 1..100 typically
+        if (level >= 1 && level <= 100) {
+            levelSum += level;
+            levelCount++;
         }
     }
 
-    return out;
+    stats.averageLevel = (levelCount > 0) ? (static_cast<double>(levelSum) / static_cast<double>(levelCount)) : 0.0;
 }
 
-std::vector<HallOfFameEntry> ReadOnlyData::GetHallOfFame() const {
-    // Hint count lives in Bank 1.
-    const int rawCountHint = static_cast<int>(buffer_.ReadU8(Gen1Layout::HallOfFameRecordCountOff));
-    const int countHint = std::clamp(rawCountHint, 0, Gen1Layout::HallOfFameMaxRecords);
+} // namespace
 
-    // Ensure the HoF block exists.
-    buffer_.RequireRange(Gen1Layout::HallOfFameOff, Gen1Layout::HallOfFameLen);
+TrainerSummary ReadOnlyData::ParseTrainerSummary() const {
+    SAVEGENIE_STAGE(Decode);
+    TrainerSummary out;
+    DecodeTrainer(Data(), out);
+    return out;
+}
 
-    std::vector<HallOfFameEntry> valid;
-    valid.reserve(Gen1Layout::HallOfFameMaxRecords);
+BoxStats ReadOnlyData::ParseBoxStats(int boxIndex1to12) const {
+    SAVEGENIE_STAGE(Decode);
+    const std::size_t base = Gen1Layout::BoxBaseOffsetByIndex1to12(boxIndex1to12);
+    BoxStats stats;
+    SummarizeBox(Data().Subspan(base, Gen1Layout::BoxBlockSize), boxIndex1to12, stats);
+    return stats;
+}
 
-    // Bank 0 is not checksum-protected; scan all 50 records and validate.
-    for (int i = 0; i < Gen1Layout::HallOfFameMaxRecords; ++i) {
-        const std::size_t recordOff = Gen1Layout::HallOfFameOff
-            + static_cast<std::size_t>(i) * Gen1Layout::HallOfFameRecordSize;
+PartySummary ReadOnlyData::ParseParty() const {
+    SAVEGENIE_STAGE(Decode);
+    const SaveView data = Data();
+    PartySummary out;
+    out.count = std::clamp(static_cast<int>(data.ReadU8(Gen1Layout::PartyOff)), 0, Gen1Layout::PartyMaxMons);
+    for (int slot = 0; slot < out.count; ++slot) {
+        out.mons.push_back(DecodeMon(data, Gen1Layout::PartyOff, slot, true));
+    }
+    return out;
+}
 
-        // Defensive range check.
-        buffer_.RequireRange(recordOff, Gen1Layout::HallOfFameRecordSize);
+PokemonSummary ReadOnlyData::GetBoxMon(int boxIndex1to12, int slot0to19) const {
+    SAVEGENIE_STAGE(Decode);
+    if (boxIndex1to12 < 1 || boxIndex1to12 > 12) {
+        throw std::out_of_range("GetBoxMon: boxIndex1to12 must be 1..12");
+    }
+    const SaveView data = Data();
+    const std::size_t base = Gen1Layout::BoxBaseOffsetByIndex1to12(boxIndex1to12);
+    const int count = std::min(static_cast<int>(data.ReadU8(base)), Gen1Layout::BoxMaxMons);
+    if (slot0to19 < 0 || slot0to19 >= count) {
+        throw std::out_of_range("GetBoxMon: slot is empty");
+    }
+    return DecodeMon(data, base, slot0to19, false);
+}
 
-        HallOfFameEntry entry;
-        entry.entryIndex = i + 1;
+void ReadOnlyData::DecodeBoxMons(BoxMonTable& out) const {
+    SAVEGENIE_STAGE(Decode);
+    const SaveView data = Data();
+    out = BoxMonTable();
+
+    auto be16 = [](const u8* p) { return static_cast<u16>((p[0] << 8) | p[1]); };
+
+    for (int box = 1; box <= BoxMonTable::Boxes; ++box) {
+        const std::size_t base = Gen1Layout::BoxBaseOffsetByIndex1to12(box);
+
+        // One range check per box block; the field reads below are plain loads.
+        const std::span<const u8> block = data.Subspan(base, Gen1Layout::BoxBlockSize);
+        const int count = std::min(static_cast<int>(block[0]), BoxMonTable::SlotsPerBox);
+        out.count[static_cast<std::size_t>(box - 1)] = static_cast<u8>(count);
+
+        for (int slot = 0; slot < count; ++slot) {
+            const std::size_t i = BoxMonTable::Index(box, slot);
+            const u8* m = block.data() + Gen1Layout::BoxMonDataRel
+                        + static_cast<std::size_t>(slot) * Gen1Layout::BoxMonStructSize;
+
+            out.species[i]   = m[Gen1Layout::MonSpeciesRel];
+            out.currentHp[i] = be16(m + Gen1Layout::MonCurrentHpRel);
+            out.level[i]     = m[Gen1Layout::MonBoxLevelRel];
+            out.status[i]    = m[Gen1Layout::MonStatusRel];
+            out.type1[i]     = m[Gen1Layout::MonType1Rel];
+            out.type2[i]     = m[Gen1Layout::MonType2Rel];
+            out.otId[i]      = be16(m + Gen1Layout::MonOTIdRel);
+            out.exp[i]       = (static_cast<u32>(m[Gen1Layout::MonExpRel]) << 16)
+                             | (static_cast<u32>(m[Gen1Layout::MonExpRel + 1]) << 8)
+                             | static_cast<u32>(m[Gen1Layout::MonExpRel + 2]);
+            out.dvs[i]       = be16(m + Gen1Layout::MonDVsRel);
+
+            for (std::size_t k = 0; k < 4; ++k) {
+                out.moves[k][i] = m[Gen1Layout::MonMovesRel + k];
+                out.pp[k][i]    = m[Gen1Layout::MonPPRel + k];
+            }
+            for (std::size_t k = 0; k < 5; ++k) {
+                out.statExp[k][i] = be16(m + Gen1Layout::MonStatExpRel + 2 * k);
+            }
 
-        for (int j = 0; j < Gen1Layout::HallOfFameMonsPerRecord; ++j) {
-            const std::size_t monOff = recordOff + static_cast<std::size_t>(j) * Gen1Layout::HallOfFameMonEntrySize;
-            buffer_.RequireRange(monOff, Gen1Layout::HallOfFameMonEntrySize);
+            const std::size_t nameRel = static_cast<std::size_t>(slot) * Gen1Layout::NameFieldLen;
+            out.otName[i]   = Gen1TextCodec::DecodeNameInline(data, base + Gen1Layout::BoxOTNamesRel + nameRel,
+                                                              Gen1Layout::NameFieldLen);
+            out.nickname[i] = Gen1TextCodec::DecodeNameInline(data, base + Gen1Layout::BoxNicknamesRel + nameRel,
+                                                              Gen1Layout::NameFieldLen);
+        }
+    }
+}
 
-            const u8 species = buffer_.ReadU8(monOff + 0x00);
-            const u8 level   = buffer_.ReadU8(monOff + 0x01);
+namespace {
 
-            // Empty slot heuristics
-            if (species == 0x00 || species == 0xFF) {
-                break;
-            }
+// Event flag summary:
+// Bulbapedia lists a large completed-game-events bitfield (0x29F3, length 0x140).
+// For MVP, we count set bits and list indices.
+void SummarizeEventFlags(const Gen1Bitset& flags, FlagSummary& out) {
+    out.totalFlagsChecked = static_cast<int>(flags.BitCount());
+    out.totalFlagsSet = static_cast<int>(flags.Count());
 
-            // Validate: species + level
-            if (!IsLikelyValidGen1SpeciesId(species)) {
-                // If the first slot is invalid, this is almost certainly junk.
-                // Stop reading further slots in this record.
-                if (j == 0) {
-                    entry.team.clear();
-                    break;
-                }
-                continue;
-            }
+    out.setFlagIndices.clear();
+    flags.ForEachSet([&](std::size_t bit) { out.setFlagIndices.push_back(static_cast<u16>(bit)); });
+}
 
-            if (level < 1 || level > 100) {
-                if (j == 0) {
-                    entry.team.clear();
-                    break;
-                }
-                continue;
-            }
+void SummarizePokedex(const Gen1Bitset& owned, const Gen1Bitset& seen, bool includeNames, PokedexSummary& out) {
+    out.ownedCount = static_cast<int>(owned.Count());
+    out.seenCount  = static_cast<int>(seen.Count());
 
-            HallOfFamePokemon mon;
-            mon.speciesId = species;
-            mon.speciesName = Gen1SpeciesLookup::NameFromId(static_cast<u8>(species));
-            mon.level = level;
-            mon.name = Gen1TextCodec::DecodeName(buffer_, monOff + 0x02, 0x0B);
-
-            // Optional name sanity (helps reject junk)
-            if (!NameLooksReasonable(mon.name)) {
-                if (j == 0) {
-                    entry.team.clear();
-                    break;
-                }
-                continue;
-            }
+    out.ownedDexNos.clear();
+    out.seenDexNos.clear();
+    out.ownedNames.clear();
+    out.seenNames.clear();
 
-            entry.team.push_back(std::move(mon));
-        }
+    owned.ForEachSet([&](std::size_t bit) { out.ownedDexNos.push_back(static_cast<int>(bit) + 1); });
+    seen.ForEachSet([&](std::size_t bit) { out.seenDexNos.push_back(static_cast<int>(bit) + 1); });
 
-        if (!entry.team.empty()) {
-            valid.push_back(std::move(entry));
-        }
-    }
+    if (includeNames) {
+        // DexNo -> internal SpeciesID -> name
+        auto nameOf = [](int dexNo) {
+            const int speciesId = Gen1SpeciesLookup::PokeDex[dexNo];
+            return (speciesId >= 0) ? Gen1SpeciesLookup::NameViewFromId(static_cast<u8>(speciesId)) : std::string_view("INVALID");
+        };
 
-    // If the game says 0, show nothing (your requirement).
-    if (countHint == 0) {
-        return {};
+        for (int dexNo : out.ownedDexNos) out.ownedNames.push_back(nameOf(dexNo));
+        for (int dexNo : out.seenDexNos)  out.seenNames.push_back(nameOf(dexNo));
     }
+}
 
-    // Prefer showing the newest `countHint` valid entries.
-    if (static_cast<int>(valid.size()) <= countHint) {
-        // Renumber entries for display (1..N)
-        for (std::size_t i = 0; i < valid.size(); ++i) {
-            valid[i].entryIndex = static_cast<int>(i + 1);
-        }
-        return valid;
+void SummarizeHallOfFame(const HallOfFameRange& range, HallOfFameList& out) {
+    out.clear();
+    for (const HallOfFameRecordView record : range) {
+        out.push_back(record.ToModel());
     }
+}
 
-    std::vector<HallOfFameEntry> out;
-    out.reserve(static_cast<std::size_t>(countHint));
+} // namespace
 
-    const std::size_t start = valid.size() - static_cast<std::size_t>(countHint);
-    for (std::size_t i = start; i < valid.size(); ++i) {
-        valid[i].entryIndex = static_cast<int>(out.size() + 1);
-        out.push_back(std::move(valid[i]));
-    }
+FlagSummary ReadOnlyData::ParseEventFlagSummary() const {
+    SAVEGENIE_STAGE(Decode);
+    FlagSummary out;
+    SummarizeEventFlags(Gen1Bitset::EventFlags(Data()), out);
+    return out;
+}
 
+PokedexSummary ReadOnlyData::ParsePokedexSummary(bool includeNames) const {
+    SAVEGENIE_STAGE(Decode);
+    const SaveView data = Data();
+    PokedexSummary out;
+    // 0x13 bytes = 152 bits; we use Dex #1..151 (bit i = Dex #i+1).
+    SummarizePokedex(Gen1Bitset::PokedexOwned(data), Gen1Bitset::PokedexSeen(data), includeNames, out);
     return out;
 }
 
-std::string ReadOnlyData::DumpFullSummary() const {
-    std::ostringstream oss;
+HallOfFameList ReadOnlyData::ParseHallOfFame() const {
+    SAVEGENIE_STAGE(Decode);
+    HallOfFameList out;
+    SummarizeHallOfFame(HallOfFameRange(Data()), out);
+    return out;
+}
 
-    oss << "=== Save Genie Summary ===\n\n";
+// =========================================================
+// Full decode
+// =========================================================
 
-    const TrainerSummary t = GetTrainerSummary();
-    oss << t.ToString() << "\n";
+void ReadOnlyData::DecodeAll(SaveSnapshot& out) const {
+    SAVEGENIE_STAGE(Decode);
+    const SaveView data = Data();
+
+    // One range check for everything below (through the Bank 3 per-box checksum
+    // table); from here on the walk reads the raw bytes in address order.
+    data.RequireRange(0, Gen1Layout::Bank3BoxChecksumsOff + 6);
+    const std::span<const u8> bytes = data.Span();
+
+    // Bank 0: Hall of Fame (the record-count hint is a single Bank 1 byte).
+    SummarizeHallOfFame(HallOfFameRange(data), out.hallOfFame);
+
+    // Bank 1: sections by starting offset, then the main checksum over the same
+    // 3.5 KiB while it is still in cache.
+    DecodeTrainer(data, out.trainer);
+    SummarizePokedex(Gen1Bitset::PokedexOwned(data), Gen1Bitset::PokedexSeen(data), true, out.pokedex);
+    SummarizeItemList(BagItemsField::Read(data), true, out.bag);
+    SummarizeItemList(PCItemBoxField::Read(data), true, out.pcItemBox);
+    SummarizeEventFlags(Gen1Bitset::EventFlags(data), out.eventFlags);
+
+    IntegrityReport& r = out.integrity;
+    const u32 mainSum = ChecksumKernels::Sum(bytes.subspan(
+        Gen1Layout::MainChecksumStart, Gen1Layout::MainChecksumEnd - Gen1Layout::MainChecksumStart + 1));
+    r.mainComputed = static_cast<u8>(~static_cast<u8>(mainSum & 0xFF));
+    r.mainStored = bytes[Gen1Layout::MainChecksumOff];
+
+    // Banks 2 and 3: each box block is summarized and summed in one visit; the
+    // six box sums of a bank add up to its bank-all sum (see Gen1Checksum::ScanAll).
+    for (int bank = 0; bank < 2; ++bank) {
+        const std::size_t bankBase = (bank == 0) ? Gen1Layout::Bank2Base : Gen1Layout::Bank3Base;
+        const std::size_t allOff = (bank == 0) ? Gen1Layout::Bank2AllChecksumOff : Gen1Layout::Bank3AllChecksumOff;
+        const std::size_t tableOff = (bank == 0) ? Gen1Layout::Bank2BoxChecksumsOff : Gen1Layout::Bank3BoxChecksumsOff;
+
+        u32 bankSum = 0;
+        for (int k = 0; k < 6; ++k) {
+            const std::size_t idx = static_cast<std::size_t>(bank * 6 + k);
+            const std::span<const u8> block =
+                bytes.subspan(bankBase + static_cast<std::size_t>(k) * Gen1Layout::BoxBlockSize, Gen1Layout::BoxBlockSize);
+
+            SummarizeBox(block, static_cast<int>(idx) + 1, out.boxes[idx]);
+
+            const u32 boxSum = ChecksumKernels::Sum(block);
+            bankSum += boxSum;
+            r.boxComputed[idx] = static_cast<u8>(~static_cast<u8>(boxSum & 0xFF));
+            r.boxStored[idx] = bytes[tableOff + static_cast<std::size_t>(k)];
+        }
 
-    // Checksums
-    oss << "Main Checksum: " << (Gen1Checksum::ValidateMain(buffer_) ? "VALID" : "INVALID") << "\n";
-    oss << "Bank2 All Checksum: " << (Gen1Checksum::ValidateBankAll(buffer_, 2) ? "VALID" : "INVALID") << "\n";
-    oss << "Bank3 All Checksum: " << (Gen1Checksum::ValidateBankAll(buffer_, 3) ? "VALID" : "INVALID") << "\n";
+        r.bankAllComputed[static_cast<std::size_t>(bank)] = static_cast<u8>(~static_cast<u8>(bankSum & 0xFF));
+        r.bankAllStored[static_cast<std::size_t>(bank)] = bytes[allOff];
+    }
+}
 
-    // Pokédex
-    oss << "--- Pokédex ---\n";
-    const PokedexSummary pdx = GetPokedexSummary(true);
-    oss << pdx.ToString() << "\n";
+SaveSnapshot ReadOnlyData::GetSnapshot() const {
+    SaveSnapshot out;
+    DecodeAll(out);
+    return out;
+}
 
-    // Hall of Fame (only if present and record-count hint > 0)
-    const auto hof = GetHallOfFame();
-    if (!hof.empty()) {
-        oss << "--- Hall of Fame ---\n";
-        for (const auto& entry : hof) {
-            oss << entry.ToString();
-        }
-        oss << "\n";
+const SaveSnapshot& ReadOnlyData::Snapshot(SaveSnapshot& scratch) const {
+    SectionCache* c = FreshCache();
+    if (!c) {
+        DecodeAll(scratch);
+        return scratch;
     }
-
-    // Boxes (quick stats)
-    oss << "--- PC Boxes (Stats) ---\n";
-    for (int box = 1; box <= 12; ++box) {
-        const BoxStats bs = GetBoxStats(box);
-        oss << bs.ToString() << "\n";
+    if (!c->snapshot) {
+        SAVEGENIE_COUNT(SectionCacheMisses, 1);
+        DecodeAll(c->snapshot.emplace());
+    } else {
+        SAVEGENIE_COUNT(SectionCacheHits, 1);
     }
-    oss << "\n";
-    
-    
-    oss << "--- Bag ---\n";
-    const BagSummary bag = GetBagSummary(true);
-    oss << bag.ToString() << "\n";
-
-    oss << "--- PC Item Box ---\n";
-    const BagSummary pcBox = GetPCItemBoxSummary(true);
-    oss << pcBox.ToString() << "\n";
-    
-    
-    // Event flags
-    oss << "--- Event Flags (Summary) ---\n";
-    const FlagSummary fs = GetEventFlagSummary();
-    oss << fs.ToString() << "\n";
+    return *c->snapshot;
+}
 
-    return oss.str();
+std::string ReadOnlyData::DumpFullSummary() const {
+    SaveSnapshot scratch;
+    return Snapshot(scratch).ToString();
 }
 
-int ReadOnlyData::CountBits(u8 byte) const {
-    // Simple popcount (portable)
-    int c = 0;
-    for (int i = 0; i < 8; ++i) {
-        if (byte & static_cast<u8>(1u << i)) c++;
-    }
-    return c;
+void ReadOnlyData::WriteSummary(SummarySink& sink) const {
+    SaveSnapshot scratch;
+    Snapshot(scratch).WriteTo(sink);
 }
 
 } // namespace savegenie
-
@@ -0,0 +1,166 @@
+//
+//  ResultCache.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of ResultCache (entry encode / decode, atomic publish).
+//
+
+#include "ResultCache.hpp"
+#include "Instrumentation.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace savegenie {
+
+namespace {
+
+constexpr char kMagic[4] = {'S', 'G', 'R', 'C'};
+
+void PutU32(std::string& out, std::uint32_t v) {
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+}
+
+void PutU64(std::string& out, std::uint64_t v) {
+    for (int i = 0; i < 8; ++i) out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+}
+
+// Sequential little-endian reader over an entry; any overrun sets ok = false.
+class EntryReader {
+public:
+    explicit EntryReader(std::string_view data) : data_(data) {}
+
+    bool ok = true;
+
+    std::uint64_t Uint(int bytes) {
+        if (!Need(static_cast<std::size_t>(bytes))) return 0;
+        std::uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i) {
+            v |= static_cast<std::uint64_t>(static_cast<unsigned char>(data_[pos_ + static_cast<std::size_t>(i)])) << (8 * i);
+        }
+        pos_ += static_cast<std::size_t>(bytes);
+        return v;
+    }
+
+    std::string_view Bytes(std::uint64_t n) {
+        if (!Need(n)) return {};
+        const std::string_view s = data_.substr(pos_, static_cast<std::size_t>(n));
+        pos_ += static_cast<std::size_t>(n);
+        return s;
+    }
+
+    bool AtEnd() const { return pos_ == data_.size(); }
+
+private:
+    std::string_view data_;
+    std::size_t pos_ = 0;
+
+    bool Need(std::uint64_t n) {
+        if (!ok || n > data_.size() - pos_) ok = false;
+        return ok;
+    }
+};
+
+} // namespace
+
+ResultCache::ResultCache(std::string dir) : dir_(std::move(dir)) {}
+
+std::string ResultCache::EntryPath(const SaveDigest& digest, std::string_view kind) const {
+    const std::string hex = digest.WholeHex();
+    std::filesystem::path p(dir_);
+    p /= hex.substr(0, 2);
+    p /= hex + "." + std::string(kind);
+    return p.string();
+}
+
+std::optional<std::string> ResultCache::Lookup(const SaveDigest& digest, std::string_view kind) const {
+    std::string raw;
+    {
+        std::ifstream in(EntryPath(digest, kind), std::ios::binary);
+        if (in) raw.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    EntryReader r(raw);
+    const std::string_view magic = r.Bytes(sizeof(kMagic));
+    bool match = r.ok && magic == std::string_view(kMagic, sizeof(kMagic))
+        && r.Uint(4) == SchemaVersion
+        && r.Uint(8) == digest.size
+        && r.Uint(8) == digest.whole;
+    for (std::uint64_t bank : digest.banks) {
+        match = match && r.Uint(8) == bank;
+    }
+    match = match && r.Bytes(r.Uint(4)) == kind;
+
+    std::string_view payload;
+    if (match) payload = r.Bytes(r.Uint(8));
+
+    if (!match || !r.ok || !r.AtEnd()) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        SAVEGENIE_COUNT(ResultCacheMisses, 1);
+        return std::nullopt;
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    SAVEGENIE_COUNT(ResultCacheHits, 1);
+    return std::string(payload);
+}
+
+bool ResultCache::Store(const SaveDigest& digest, std::string_view kind, std::string_view payload) const {
+    namespace fs = std::filesystem;
+
+    std::string entry;
+    entry.reserve(64 + kind.size() + payload.size());
+    entry.append(kMagic, sizeof(kMagic));
+    PutU32(entry, SchemaVersion);
+    PutU64(entry, digest.size);
+    PutU64(entry, digest.whole);
+    for (std::uint64_t bank : digest.banks) PutU64(entry, bank);
+    PutU32(entry, static_cast<std::uint32_t>(kind.size()));
+    entry.append(kind);
+    PutU64(entry, payload.size());
+    entry.append(payload);
+
+    const fs::path finalPath(EntryPath(digest, kind));
+    std::error_code ec;
+    fs::create_directories(finalPath.parent_path(), ec);
+    if (ec) return false;
+
+    // Unique per process, thread and call, so concurrent stores of one key
+    // never share a temp file.
+    std::string suffix = ".tmp";
+#if defined(__unix__) || defined(__APPLE__)
+    suffix += std::to_string(::getpid()) + "-";
+#endif
+    suffix += std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "-" +
+              std::to_string(tempCounter_.fetch_add(1, std::memory_order_relaxed));
+    fs::path tmp = finalPath;
+    tmp += suffix;
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(entry.data(), static_cast<std::streamsize>(entry.size()));
+        if (!out) {
+            out.close();
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tmp, finalPath, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    stores_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+} // namespace savegenie
@@ -0,0 +1,301 @@
+//
+//  SaveGenerator.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of SaveGenerator.
+//   - Layout is written straight into the bytes (names pre-encoded with
+//     Gen1TextCodec::EncodeName), money / coins through BcdCodec, then
+//     Gen1Checksum::Fix* makes the save valid.
+//
+
+#include "SaveGenerator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace savegenie {
+
+namespace {
+
+// SplitMix64: tiny, deterministic, good enough for filler data.
+class FillRng {
+public:
+    explicit FillRng(std::uint64_t seed) : state_(seed) {}
+
+    std::uint64_t Next() {
+        std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    u8 Byte() { return static_cast<u8>(Next()); }
+
+    int Range(int lo, int hi) {
+        if (hi <= lo) return lo;
+        return lo + static_cast<int>(Next() % static_cast<std::uint64_t>(hi - lo + 1));
+    }
+    int Range(IntRange r) { return Range(r.lo, r.hi); }
+
+    bool Percent(int pct) { return Range(1, 100) <= pct; }
+
+    void Fill(u8* p, std::size_t n) {
+        while (n >= 8) {
+            const std::uint64_t v = Next();
+            std::memcpy(p, &v, 8);
+            p += 8;
+            n -= 8;
+        }
+        if (n > 0) {
+            const std::uint64_t v = Next();
+            std::memcpy(p, &v, n);
+        }
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+constexpr std::array<const char*, 8> kTrainerNames = {"RED", "ASH", "JACK", "Leaf", "GOLD", "Mia", "SATOSHI", "Yellow"};
+constexpr std::array<const char*, 6> kRivalNames = {"BLUE", "GARY", "JOHN", "Green", "SILVER", "Rival"};
+constexpr std::array<const char*, 8> kNicknames = {"SPARKY", "Bubbles", "ZAP", "Nugget", "MEW.2", "Lola", "X", "FANGS"};
+
+// Bulk writes go straight to the bytes; checksums are recomputed at the end.
+void PutItemList(u8* d, std::size_t countOff, int count, FillRng& rng) {
+    d[countOff] = static_cast<u8>(count);
+    std::size_t p = countOff + 1;
+    for (int i = 0; i < count; ++i) {
+        d[p++] = static_cast<u8>(rng.Range(1, 83)); // regular items
+        d[p++] = static_cast<u8>(rng.Range(1, 99));
+    }
+    d[p] = 0xFF;
+}
+
+void PutU16BE(u8* d, std::size_t off, u16 v) {
+    d[off] = static_cast<u8>(v >> 8);
+    d[off + 1] = static_cast<u8>(v & 0xFF);
+}
+
+void InjectCorruption(SaveBuffer& sb, SaveCorruption kind, FillRng& rng) {
+    switch (kind) {
+        case SaveCorruption::None:
+            return;
+        case SaveCorruption::FlipByte: {
+            const std::size_t off = Gen1Layout::MainChecksumStart
+                + rng.Next() % (Gen1Layout::MainChecksumEnd - Gen1Layout::MainChecksumStart + 1);
+            sb.WriteU8(off, static_cast<u8>(sb.ReadU8(off) ^ (1u << rng.Range(0, 7))));
+            return;
+        }
+        case SaveCorruption::MainChecksum:
+            sb.WriteU8(Gen1Layout::MainChecksumOff,
+                       static_cast<u8>(sb.ReadU8(Gen1Layout::MainChecksumOff) + rng.Range(1, 255)));
+            return;
+        case SaveCorruption::BoxChecksum: {
+            const int box = rng.Range(1, 12);
+            const std::size_t off = Gen1Layout::BankPerBoxChecksumsBaseOffsetForBoxIndex1to12(box)
+                + static_cast<std::size_t>((box - 1) % 6);
+            sb.WriteU8(off, static_cast<u8>(sb.ReadU8(off) + rng.Range(1, 255)));
+            return;
+        }
+        case SaveCorruption::Truncate:
+            sb.BytesMutable().resize(static_cast<std::size_t>(rng.Range(0, static_cast<int>(Gen1Layout::ExpectedSize) - 1)));
+            return;
+    }
+}
+
+} // namespace
+
+SaveGenerator::SaveGenerator(GeneratorSpec spec) : spec_(spec) {
+    if (spec_.corruptionRate < 0.0 || spec_.corruptionRate > 1.0) {
+        throw std::invalid_argument("SaveGenerator: corruptionRate must be within 0..1");
+    }
+    // Generate() writes these counts straight into fixed-size blocks.
+    const auto requireRange = [](const IntRange& r, int maxValue, const char* what) {
+        if (r.lo < 0 || r.lo > r.hi || r.hi > maxValue) {
+            throw std::invalid_argument(std::string("SaveGenerator: ") + what + " must be a range within 0.."
+                                        + std::to_string(maxValue));
+        }
+    };
+    requireRange(spec_.partyMons, Gen1Layout::PartyMaxMons, "partyMons");
+    requireRange(spec_.monsPerBox, Gen1Layout::BoxMaxMons, "monsPerBox");
+    requireRange(spec_.hallOfFameRecords, Gen1Layout::HallOfFameMaxRecords, "hallOfFameRecords");
+    requireRange(spec_.bagItems, Gen1Layout::BagItemsMaxPairs, "bagItems");
+    requireRange(spec_.pcItems, Gen1Layout::PCItemBoxMaxPairs, "pcItems");
+    requireRange(spec_.dexPercent, 100, "dexPercent");
+    requireRange(spec_.flagPercent, 100, "flagPercent");
+
+    SaveBuffer scratch(SaveBuffer::Bytes(Gen1Layout::NameFieldLen, 0));
+    auto encodeAll = [&](const auto& names, std::vector<EncodedName>& out) {
+        for (const char* name : names) {
+            Gen1TextCodec::EncodeName(scratch, 0, Gen1Layout::NameFieldLen, name);
+            EncodedName& e = out.emplace_back();
+            std::copy(scratch.BytesView().begin(), scratch.BytesView().end(), e.begin());
+        }
+    };
+    encodeAll(kTrainerNames, trainerNames_);
+    encodeAll(kRivalNames, rivalNames_);
+    encodeAll(kNicknames, nicknames_);
+}
+
+SaveBuffer SaveGenerator::Generate(std::uint64_t index) const {
+    SaveBuffer sb;
+    Generate(index, sb);
+    return sb;
+}
+
+SaveCorruption SaveGenerator::Generate(std::uint64_t index, SaveBuffer& out) const {
+    // Per-save stream: independent of generation order.
+    FillRng seedMix(spec_.seed ^ (index * 0xD1B54A32D192ED03ULL));
+    FillRng rng(seedMix.Next());
+
+    auto pick = [&](const std::vector<EncodedName>& pool) -> const EncodedName& {
+        return pool[rng.Next() % pool.size()];
+    };
+    auto putName = [](u8* dst, const EncodedName& name) { std::copy(name.begin(), name.end(), dst); };
+
+    // Phase 1: layout written directly into the bytes (BytesMutable() drops the
+    // incremental checksum state, so nothing needs tracking until phase 2).
+    SaveBuffer::Bytes& raw = out.BytesMutable();
+    raw.assign(Gen1Layout::ExpectedSize, 0);
+    u8* const d = raw.data();
+
+    // --- Trainer ---
+    const std::size_t trainerName = rng.Next() % trainerNames_.size();
+    putName(d + Gen1Layout::TrainerNameOff, trainerNames_[trainerName]);
+    putName(d + Gen1Layout::RivalNameOff, pick(rivalNames_));
+    const EncodedName& otName = trainerNames_[trainerName];
+    d[Gen1Layout::BadgesOff] = rng.Byte();
+    d[Gen1Layout::TrainerIdOff] = rng.Byte();
+    d[Gen1Layout::TrainerIdOff + 1] = rng.Byte();
+    d[Gen1Layout::MapIdOff] = static_cast<u8>(rng.Range(0, 36));
+    d[Gen1Layout::YCoordOff] = static_cast<u8>(rng.Range(0, 20));
+    d[Gen1Layout::XCoordOff] = static_cast<u8>(rng.Range(0, 20));
+    d[Gen1Layout::PlayTimeHoursOff] = static_cast<u8>(rng.Range(0, 255));
+    d[Gen1Layout::PlayTimeMinutesOff] = static_cast<u8>(rng.Range(0, 59));
+    d[Gen1Layout::PlayTimeSecondsOff] = static_cast<u8>(rng.Range(0, 59));
+
+    // --- Items ---
+    PutItemList(d, Gen1Layout::BagItemsOff, rng.Range(spec_.bagItems), rng);
+    PutItemList(d, Gen1Layout::PCItemBoxOff, rng.Range(spec_.pcItems), rng);
+
+    // --- Pokédex / event flags ---
+    const int dexPercent = rng.Range(spec_.dexPercent);
+    for (std::size_t bit = 0; bit < Gen1Layout::PokedexSpeciesCount; ++bit) {
+        const bool owned = rng.Percent(dexPercent);
+        const bool seen = owned || rng.Percent(dexPercent);
+        const u8 mask = static_cast<u8>(1u << (bit % 8));
+        if (owned) d[Gen1Layout::PokedexOwnedOff + bit / 8] |= mask;
+        if (seen) d[Gen1Layout::PokedexSeenOff + bit / 8] |= mask;
+    }
+
+    const int flagPercent = rng.Range(spec_.flagPercent);
+    for (std::size_t i = 0; i < Gen1Layout::EventFlagsLen; ++i) {
+        if (rng.Percent(flagPercent)) d[Gen1Layout::EventFlagsOff + i] = rng.Byte();
+    }
+
+    // --- Party ---
+    const int partyCount = rng.Range(spec_.partyMons);
+    d[Gen1Layout::PartyOff] = static_cast<u8>(partyCount);
+    for (int i = 0; i < partyCount; ++i) {
+        const u8 species = static_cast<u8>(rng.Range(1, 190));
+        const u8 level = static_cast<u8>(rng.Range(2, 100));
+        const std::size_t mon = Gen1Layout::PartyOff + Gen1Layout::PartyMonDataRel
+            + static_cast<std::size_t>(i) * Gen1Layout::PartyMonStructSize;
+        rng.Fill(d + mon, Gen1Layout::PartyMonStructSize);
+        d[Gen1Layout::PartyOff + 1 + static_cast<std::size_t>(i)] = species;
+        d[mon + Gen1Layout::MonSpeciesRel] = species;
+        d[mon + Gen1Layout::MonBoxLevelRel] = level;
+        d[mon + Gen1Layout::MonPartyLevelRel] = level;
+
+        // Current HP never exceeds max HP.
+        const u16 maxHp = static_cast<u16>(rng.Range(10, 700));
+        PutU16BE(d, mon + Gen1Layout::MonCurrentHpRel, static_cast<u16>(rng.Range(0, maxHp)));
+        PutU16BE(d, mon + Gen1Layout::MonMaxHpRel, maxHp);
+
+        const std::size_t nameRel = static_cast<std::size_t>(i) * Gen1Layout::NameFieldLen;
+        putName(d + Gen1Layout::PartyOff + Gen1Layout::PartyOTNamesRel + nameRel, otName);
+        putName(d + Gen1Layout::PartyOff + Gen1Layout::PartyNicknamesRel + nameRel, pick(nicknames_));
+    }
+    d[Gen1Layout::PartyOff + 1 + static_cast<std::size_t>(partyCount)] = 0xFF;
+
+    // --- Hall of Fame (Bank 0) ---
+    const int hofRecords = rng.Range(spec_.hallOfFameRecords);
+    d[Gen1Layout::HallOfFameRecordCountOff] = static_cast<u8>(hofRecords);
+    for (int r = 0; r < hofRecords; ++r) {
+        const int teamSize = rng.Range(1, Gen1Layout::HallOfFameMonsPerRecord);
+        for (int m = 0; m < teamSize; ++m) {
+            const std::size_t monOff = Gen1Layout::HallOfFameOff
+                + static_cast<std::size_t>(r) * Gen1Layout::HallOfFameRecordSize
+                + static_cast<std::size_t>(m) * Gen1Layout::HallOfFameMonEntrySize;
+            d[monOff] = static_cast<u8>(rng.Range(1, 151));
+            d[monOff + 1] = static_cast<u8>(rng.Range(30, 100));
+            putName(d + monOff + Gen1Layout::HallOfFameMonNameRel, pick(nicknames_));
+        }
+    }
+
+    // --- PC boxes ---
+    for (int box = 1; box <= 12; ++box) {
+        const std::size_t base = Gen1Layout::BoxBaseOffsetByIndex1to12(box);
+        const int count = rng.Range(spec_.monsPerBox);
+        d[base] = static_cast<u8>(count);
+        rng.Fill(d + base + Gen1Layout::BoxMonDataRel,
+                 static_cast<std::size_t>(count) * Gen1Layout::BoxMonStructSize);
+        for (int i = 0; i < count; ++i) {
+            const u8 species = static_cast<u8>(rng.Range(1, 190));
+            const std::size_t mon = base + Gen1Layout::BoxMonDataRel
+                + static_cast<std::size_t>(i) * Gen1Layout::BoxMonStructSize;
+            d[base + 1 + static_cast<std::size_t>(i)] = species;
+            d[mon + Gen1Layout::MonSpeciesRel] = species;
+            d[mon + Gen1Layout::MonBoxLevelRel] = static_cast<u8>(rng.Range(1, 100));
+
+            const std::size_t nameRel = static_cast<std::size_t>(i) * Gen1Layout::NameFieldLen;
+            putName(d + base + Gen1Layout::BoxOTNamesRel + nameRel, otName);
+            putName(d + base + Gen1Layout::BoxNicknamesRel + nameRel, pick(nicknames_));
+        }
+        d[base + 1 + static_cast<std::size_t>(count)] = 0xFF;
+    }
+
+    // Phase 2: codec-written fields, then checksums.
+    SaveBuffer& sb = out;
+    BcdCodec::WriteBcd3(sb, Gen1Layout::MoneyOff, static_cast<u32>(rng.Range(0, 999999)));
+    BcdCodec::WriteBcd2(sb, Gen1Layout::CoinsOff, static_cast<u16>(rng.Range(0, 9999)));
+
+    for (int box = 1; box <= 12; ++box) Gen1Checksum::FixBox(sb, box);
+    Gen1Checksum::FixBankAll(sb, 2);
+    Gen1Checksum::FixBankAll(sb, 3);
+    Gen1Checksum::FixMain(sb);
+
+    // --- Corruption (last, so it survives the fixes) ---
+    SaveCorruption corruption = SaveCorruption::None;
+    if (spec_.corruptionRate > 0.0 &&
+        static_cast<double>(rng.Next() >> 11) * 0x1.0p-53 < spec_.corruptionRate) {
+        corruption = spec_.corruptionKind.value_or(static_cast<SaveCorruption>(rng.Range(1, 4)));
+        InjectCorruption(sb, corruption, rng);
+    }
+    return corruption;
+}
+
+const char* SaveGenerator::CorruptionName(SaveCorruption kind) {
+    switch (kind) {
+        case SaveCorruption::None:         return "none";
+        case SaveCorruption::FlipByte:     return "flip-byte";
+        case SaveCorruption::MainChecksum: return "main-checksum";
+        case SaveCorruption::BoxChecksum:  return "box-checksum";
+        case SaveCorruption::Truncate:     return "truncate";
+    }
+    return "unknown";
+}
+
+std::optional<SaveCorruption> SaveGenerator::ParseCorruption(std::string_view name) {
+    for (SaveCorruption k : {SaveCorruption::None, SaveCorruption::FlipByte, SaveCorruption::MainChecksum,
+                             SaveCorruption::BoxChecksum, SaveCorruption::Truncate}) {
+        if (name == CorruptionName(k)) return k;
+    }
+    return std::nullopt;
+}
+
+} // namespace savegenie
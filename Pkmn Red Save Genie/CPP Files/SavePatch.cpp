@@ -0,0 +1,339 @@
+//
+//  SavePatch.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of SavePatch (diff, apply, serialization).
+//
+
+#include "SavePatch.hpp"
+#include "ContentHash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace savegenie {
+
+namespace {
+
+constexpr char kMagic[4] = {'S', 'G', 'P', 'T'};
+
+// A separate run costs ~3 encoded bytes (gap + length varints); folding an
+// unchanged gap of g bytes into the previous run costs 2g (old + new copies).
+// A gap holding a checksum byte is never folded: that byte is patched as a
+// delta, and a run would overwrite it with an absolute value.
+constexpr std::size_t kMaxMergedGap = 1;
+
+// Every checksum byte of a Gen I save: main, bank-all x2, per-box table x12.
+constexpr std::array<std::size_t, 15> kChecksumOffsets = [] {
+    std::array<std::size_t, 15> a{};
+    std::size_t n = 0;
+    a[n++] = Gen1Layout::MainChecksumOff;
+    a[n++] = Gen1Layout::Bank2AllChecksumOff;
+    for (std::size_t k = 0; k < 6; ++k) a[n++] = Gen1Layout::Bank2BoxChecksumsOff + k;
+    a[n++] = Gen1Layout::Bank3AllChecksumOff;
+    for (std::size_t k = 0; k < 6; ++k) a[n++] = Gen1Layout::Bank3BoxChecksumsOff + k;
+    return a;
+}();
+
+bool IsChecksumOffset(std::size_t off) {
+    return std::find(kChecksumOffsets.begin(), kChecksumOffsets.end(), off) != kChecksumOffsets.end();
+}
+
+u64 LoadWord(const u8* p) {
+    u64 v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Index (in memory order) of the lowest-addressed non-zero byte of a XOR word.
+unsigned FirstDiffByte(u64 x) {
+    if constexpr (std::endian::native == std::endian::little) {
+        return static_cast<unsigned>(std::countr_zero(x)) / 8;
+    } else {
+        return static_cast<unsigned>(std::countl_zero(x)) / 8;
+    }
+}
+
+u64 ByteMask(unsigned byteIndex) {
+    if constexpr (std::endian::native == std::endian::little) {
+        return u64{0xFF} << (8 * byteIndex);
+    } else {
+        return u64{0xFF} << (8 * (7 - byteIndex));
+    }
+}
+
+void PutVarint(std::vector<u8>& out, u64 v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<u8>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<u8>(v));
+}
+
+class PatchReader {
+public:
+    explicit PatchReader(std::span<const u8> bytes) : bytes_(bytes) {}
+
+    u8 Byte() {
+        Need(1);
+        return bytes_[pos_++];
+    }
+
+    u64 Varint() {
+        u64 v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const u8 b = Byte();
+            v |= static_cast<u64>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) return v;
+        }
+        throw std::runtime_error("SavePatch: varint too long");
+    }
+
+    std::span<const u8> Take(std::size_t n) {
+        Need(n);
+        const auto s = bytes_.subspan(pos_, n);
+        pos_ += n;
+        return s;
+    }
+
+    std::size_t Pos() const { return pos_; }
+    std::size_t Remaining() const { return bytes_.size() - pos_; }
+
+private:
+    std::span<const u8> bytes_;
+    std::size_t pos_ = 0;
+
+    void Need(std::size_t n) const {
+        if (n > bytes_.size() - pos_) {
+            throw std::runtime_error("SavePatch: truncated patch");
+        }
+    }
+};
+
+} // namespace
+
+// =========================================================
+// Diff
+// =========================================================
+
+SavePatch SavePatch::Diff(SaveView before, SaveView after) {
+    if (before.Size() != after.Size()) {
+        throw std::invalid_argument("SavePatch::Diff: saves differ in size");
+    }
+
+    SavePatch p;
+    p.size_ = before.Size();
+    const std::span<const u8> a = before.Span();
+    const std::span<const u8> b = after.Span();
+    const std::size_t n = a.size();
+    const bool hasChecksums = n > Gen1Layout::Bank3BoxChecksumsOff + 5;
+
+    auto noteDiff = [&](std::size_t off) {
+        if (hasChecksums && IsChecksumOffset(off)) {
+            p.checksums_.push_back(ChecksumByte{static_cast<u32>(off), a[off], b[off]});
+            return;
+        }
+        if (!p.runs_.empty()) {
+            Run& last = p.runs_.back();
+            const std::size_t end = last.off + last.len;
+            bool mergeable = off - end <= kMaxMergedGap;
+            for (std::size_t g = end; mergeable && hasChecksums && g < off; ++g) {
+                mergeable = !IsChecksumOffset(g);
+            }
+            if (mergeable) {
+                last.len = static_cast<u32>(off + 1 - last.off);
+                return;
+            }
+        }
+        p.runs_.push_back(Run{static_cast<u32>(off), 1});
+    };
+
+    // 8 bytes per step; only differing words are looked at byte by byte.
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        u64 x = LoadWord(a.data() + i) ^ LoadWord(b.data() + i);
+        while (x != 0) {
+            const unsigned k = FirstDiffByte(x);
+            noteDiff(i + k);
+            x &= ~ByteMask(k);
+        }
+    }
+    for (; i < n; ++i) {
+        if (a[i] != b[i]) noteDiff(i);
+    }
+
+    std::size_t total = 0;
+    for (const Run& r : p.runs_) total += r.len;
+    p.before_.reserve(total);
+    p.after_.reserve(total);
+    for (const Run& r : p.runs_) {
+        p.before_.insert(p.before_.end(), a.begin() + r.off, a.begin() + r.off + r.len);
+        p.after_.insert(p.after_.end(), b.begin() + r.off, b.begin() + r.off + r.len);
+    }
+    return p;
+}
+
+// =========================================================
+// Apply
+// =========================================================
+
+PatchStatus SavePatch::Apply(SaveBuffer& target) const {
+    if (target.Size() != size_) return PatchStatus::SizeMismatch;
+
+    // Verify everything before the first write.
+    const u8* bytes = target.View().Span().data();
+    bool oldMatches = true;
+    bool newMatches = true;
+    std::size_t pos = 0;
+    for (const Run& r : runs_) {
+        oldMatches = oldMatches && std::memcmp(bytes + r.off, before_.data() + pos, r.len) == 0;
+        newMatches = newMatches && std::memcmp(bytes + r.off, after_.data() + pos, r.len) == 0;
+        if (!oldMatches && !newMatches) return PatchStatus::Conflict;
+        pos += r.len;
+    }
+    if (!oldMatches) return PatchStatus::AlreadyApplied;
+
+    pos = 0;
+    for (const Run& r : runs_) {
+        target.WriteBytes(r.off, std::span<const u8>(after_.data() + pos, r.len));
+        pos += r.len;
+    }
+    for (const ChecksumByte& c : checksums_) {
+        target.WriteU8(c.off, static_cast<u8>(target.ReadU8(c.off) + static_cast<u8>(c.after - c.before)));
+    }
+    return PatchStatus::Applied;
+}
+
+std::vector<PatchStatus> SavePatch::ApplyAll(std::span<SaveBuffer> targets) const {
+    std::vector<PatchStatus> out;
+    out.reserve(targets.size());
+    for (SaveBuffer& t : targets) out.push_back(Apply(t));
+    return out;
+}
+
+SavePatch SavePatch::Inverted() const {
+    SavePatch p = *this;
+    std::swap(p.before_, p.after_);
+    for (ChecksumByte& c : p.checksums_) std::swap(c.before, c.after);
+    return p;
+}
+
+// =========================================================
+// Serialization
+// =========================================================
+
+std::vector<u8> SavePatch::Serialize() const {
+    std::vector<u8> out;
+    out.reserve(32 + 2 * before_.size() + 3 * runs_.size() + 5 * checksums_.size());
+
+    for (char c : kMagic) out.push_back(static_cast<u8>(c));
+    out.push_back(FormatVersion);
+    PutVarint(out, size_);
+
+    PutVarint(out, runs_.size());
+    std::size_t prevEnd = 0;
+    std::size_t pos = 0;
+    for (const Run& r : runs_) {
+        PutVarint(out, r.off - prevEnd);
+        PutVarint(out, r.len);
+        out.insert(out.end(), before_.begin() + static_cast<std::ptrdiff_t>(pos),
+                   before_.begin() + static_cast<std::ptrdiff_t>(pos + r.len));
+        out.insert(out.end(), after_.begin() + static_cast<std::ptrdiff_t>(pos),
+                   after_.begin() + static_cast<std::ptrdiff_t>(pos + r.len));
+        prevEnd = r.off + r.len;
+        pos += r.len;
+    }
+
+    PutVarint(out, checksums_.size());
+    for (const ChecksumByte& c : checksums_) {
+        PutVarint(out, c.off);
+        out.push_back(c.before);
+        out.push_back(c.after);
+    }
+
+    const u64 hash = ContentHash::Hash64(out);
+    for (int k = 0; k < 8; ++k) out.push_back(static_cast<u8>(hash >> (8 * k)));
+    return out;
+}
+
+SavePatch SavePatch::Parse(std::span<const u8> bytes) {
+    if (bytes.size() < sizeof(kMagic) + 1 + 8 ||
+        std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("SavePatch: not a save patch");
+    }
+
+    const std::span<const u8> body = bytes.first(bytes.size() - 8);
+    u64 stored = 0;
+    for (int k = 0; k < 8; ++k) stored |= static_cast<u64>(bytes[body.size() + static_cast<std::size_t>(k)]) << (8 * k);
+    if (ContentHash::Hash64(body) != stored) {
+        throw std::runtime_error("SavePatch: hash mismatch (corrupted patch)");
+    }
+
+    PatchReader in(body);
+    in.Take(sizeof(kMagic));
+    if (in.Byte() != FormatVersion) {
+        throw std::runtime_error("SavePatch: unsupported format version");
+    }
+
+    SavePatch p;
+    p.size_ = static_cast<std::size_t>(in.Varint());
+
+    // Counts are checked against what is left of the input before anything is
+    // reserved: a run takes at least 4 bytes (gap, length, one old and one new
+    // byte), a checksum entry 3.
+    const u64 runCount = in.Varint();
+    if (runCount > p.size_ || runCount > in.Remaining() / 4) {
+        throw std::runtime_error("SavePatch: run count exceeds the patch");
+    }
+    p.runs_.reserve(static_cast<std::size_t>(runCount));
+    std::size_t prevEnd = 0;
+    for (u64 k = 0; k < runCount; ++k) {
+        const u64 gap = in.Varint();
+        const u64 len = in.Varint();
+        if (len == 0 || gap > p.size_ - prevEnd || len > p.size_ - prevEnd - gap) {
+            throw std::runtime_error("SavePatch: run outside the save");
+        }
+        const Run r{static_cast<u32>(prevEnd + gap), static_cast<u32>(len)};
+        const auto oldBytes = in.Take(r.len);
+        const auto newBytes = in.Take(r.len);
+        p.before_.insert(p.before_.end(), oldBytes.begin(), oldBytes.end());
+        p.after_.insert(p.after_.end(), newBytes.begin(), newBytes.end());
+        p.runs_.push_back(r);
+        prevEnd = r.off + r.len;
+    }
+
+    const u64 checksumCount = in.Varint();
+    if (checksumCount > kChecksumOffsets.size() || checksumCount > in.Remaining() / 3) {
+        throw std::runtime_error("SavePatch: too many checksum bytes");
+    }
+    for (u64 k = 0; k < checksumCount; ++k) {
+        const u64 off = in.Varint();
+        if (off >= p.size_ || !IsChecksumOffset(static_cast<std::size_t>(off))) {
+            throw std::runtime_error("SavePatch: checksum entry at a non-checksum offset");
+        }
+        ChecksumByte c;
+        c.off = static_cast<u32>(off);
+        c.before = in.Byte();
+        c.after = in.Byte();
+        p.checksums_.push_back(c);
+    }
+
+    if (in.Pos() != body.size()) throw std::runtime_error("SavePatch: trailing bytes");
+    return p;
+}
+
+const char* SavePatch::StatusName(PatchStatus status) {
+    switch (status) {
+        case PatchStatus::Applied:        return "applied";
+        case PatchStatus::AlreadyApplied: return "already-applied";
+        case PatchStatus::SizeMismatch:   return "size-mismatch";
+        case PatchStatus::Conflict:       return "conflict";
+    }
+    return "unknown";
+}
+
+} // namespace savegenie
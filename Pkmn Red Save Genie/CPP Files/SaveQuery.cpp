@@ -0,0 +1,646 @@
+//
+//  SaveQuery.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of SaveQuery: field/function tables, recursive-descent
+//     parser, and the evaluator (one direct read per leaf).
+//
+
+#include "SaveQuery.hpp"
+
+#include "Gen1Fields.hpp"
+#include "ReadOnlyData.hpp"
+#include "SummarySink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace savegenie {
+
+namespace {
+
+// =========================================================
+// Fields and functions
+// =========================================================
+
+// Fields stored as-is in the save (money, name, map, ...) come straight from
+// the Gen1Fields table; these are the ones the query computes.
+enum class Field : u8 {
+    BadgeCount, PartyCount, CurrentBox, BoxMons, HofRecords, DexOwned, DexSeen, BagItems, PcItems,
+    FlagsSet, ChecksumOk, Size, MapName,
+};
+
+struct FieldDef {
+    std::string_view name;
+    Field id;
+    QueryType type;
+    std::string_view help;
+};
+
+constexpr std::array<FieldDef, 13> kFields = {{
+    {"badge_count", Field::BadgeCount, QueryType::Number, "number of badges"},
+    {"party_count", Field::PartyCount, QueryType::Number, "Pokémon in the party (0..6)"},
+    {"current_box", Field::CurrentBox, QueryType::Number, "selected PC box (1..12)"},
+    {"box_mons",    Field::BoxMons,    QueryType::Number, "Pokémon stored in boxes 1..12"},
+    {"hof_records", Field::HofRecords, QueryType::Number, "valid Hall of Fame records"},
+    {"dex_owned",   Field::DexOwned,   QueryType::Number, "Pokédex entries owned"},
+    {"dex_seen",    Field::DexSeen,    QueryType::Number, "Pokédex entries seen"},
+    {"bag_items",   Field::BagItems,   QueryType::Number, "item stacks in the bag"},
+    {"pc_items",    Field::PcItems,    QueryType::Number, "item stacks in the PC item box"},
+    {"flags_set",   Field::FlagsSet,   QueryType::Number, "event flags set"},
+    {"checksum_ok", Field::ChecksumOk, QueryType::Bool,   "main checksum matches"},
+    {"size",        Field::Size,       QueryType::Number, "file size in bytes"},
+    {"map_name",    Field::MapName,    QueryType::String, "current map name"},
+}};
+
+enum class Function : u8 {
+    Owns, Seen, Flag, Badge, HasItem, BagQty, PcQty, BoxCount,
+};
+
+// What a function argument names; decides parsing and range checks.
+enum class ArgKind : u8 {
+    Dex,   // 1..151 or a species name
+    Flag,  // 0..2559
+    Badge, // 1..8
+    Item,  // 0..255 or an item name
+    Box,   // 1..12
+};
+
+struct FunctionDef {
+    std::string_view name;
+    Function id;
+    ArgKind arg;
+    QueryType type;
+    std::string_view help;
+};
+
+constexpr std::array<FunctionDef, 8> kFunctions = {{
+    {"owns",      Function::Owns,     ArgKind::Dex,   QueryType::Bool,   "Pokédex owned bit (dex number or species name)"},
+    {"seen",      Function::Seen,     ArgKind::Dex,   QueryType::Bool,   "Pokédex seen bit"},
+    {"flag",      Function::Flag,     ArgKind::Flag,  QueryType::Bool,   "event flag bit"},
+    {"badge",     Function::Badge,    ArgKind::Badge, QueryType::Bool,   "badge N (1 = Boulder .. 8 = Earth)"},
+    {"has_item",  Function::HasItem,  ArgKind::Item,  QueryType::Bool,   "item in the bag or PC item box (id or name)"},
+    {"bag_qty",   Function::BagQty,   ArgKind::Item,  QueryType::Number, "quantity of an item in the bag"},
+    {"pc_qty",    Function::PcQty,    ArgKind::Item,  QueryType::Number, "quantity of an item in the PC item box"},
+    {"box_count", Function::BoxCount, ArgKind::Box,   QueryType::Number, "Pokémon in box N"},
+}};
+
+enum class Comparison : u8 { Eq, Ne, Lt, Le, Gt, Ge };
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(a[i])) != std::toupper(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Dex number for a species name, or 0.
+int DexNumberForName(std::string_view name) {
+    for (int dex = 1; dex <= static_cast<int>(Gen1Layout::PokedexSpeciesCount); ++dex) {
+        const int speciesId = Gen1SpeciesLookup::PokeDex[dex];
+        if (speciesId >= 0 && EqualsIgnoreCase(Gen1SpeciesLookup::NameViewFromId(static_cast<u8>(speciesId)), name)) {
+            return dex;
+        }
+    }
+    return 0;
+}
+
+// Item id for an item name, or -1.
+int ItemIdForName(std::string_view name) {
+    for (int id = 0; id < 256; ++id) {
+        const std::string_view itemName = Gen1ItemLookup::ItemName[static_cast<std::size_t>(id)];
+        if (itemName != "INVALID" && EqualsIgnoreCase(itemName, name)) return id;
+    }
+    return -1;
+}
+
+// Scalars and names only: bitsets and item lists are reached through the
+// computed fields and functions.
+bool IsRawQueryable(const FieldDescriptor& d) {
+    return d.IsNumber() || d.encoding == FieldEncoding::Text;
+}
+
+QueryType RawFieldType(const FieldDescriptor& d) {
+    return d.IsNumber() ? QueryType::Number : QueryType::String;
+}
+
+int BoxCount(SaveView sv, int boxIndex1to12) {
+    return std::min<int>(sv.ReadU8(Gen1Layout::BoxBaseOffsetByIndex1to12(boxIndex1to12)), Gen1Layout::BoxMaxMons);
+}
+
+const char* TypeName(QueryType t) {
+    switch (t) {
+        case QueryType::Bool:   return "bool";
+        case QueryType::Number: return "number";
+        case QueryType::String: return "string";
+    }
+    return "?";
+}
+
+// =========================================================
+// Lexer
+// =========================================================
+
+enum class Tok : u8 { End, Number, String, Ident, LParen, RParen, Comma, Not, And, Or, Cmp };
+
+struct Token {
+    Tok kind = Tok::End;
+    std::size_t pos = 0; // 0-based offset into the source
+    std::size_t len = 0;
+    std::int64_t number = 0;
+    std::string text;    // identifier (lower-case) or string literal
+    Comparison cmp = Comparison::Eq;
+};
+
+[[noreturn]] void Fail(const std::string& what, std::size_t pos) {
+    throw std::invalid_argument("query: " + what + " (column " + std::to_string(pos + 1) + ")");
+}
+
+std::vector<Token> Lex(std::string_view src) {
+    std::vector<Token> out;
+    std::size_t i = 0;
+    while (true) {
+        while (i < src.size() && std::isspace(static_cast<unsigned char>(src[i]))) ++i;
+        Token t;
+        t.pos = i;
+        if (i == src.size()) {
+            out.push_back(t);
+            return out;
+        }
+
+        const char c = src[i];
+        const auto two = [&](char a, char b) { return c == a && i + 1 < src.size() && src[i + 1] == b; };
+
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            int base = 10;
+            std::size_t j = i;
+            if (two('0', 'x') || two('0', 'X')) {
+                base = 16;
+                j += 2;
+            }
+            const std::size_t digitsStart = j;
+            std::int64_t v = 0;
+            while (j < src.size() && std::isxdigit(static_cast<unsigned char>(src[j]))) {
+                const char d = static_cast<char>(std::tolower(static_cast<unsigned char>(src[j])));
+                const int digit = std::isdigit(static_cast<unsigned char>(d)) ? d - '0' : d - 'a' + 10;
+                if (digit >= base) break;
+                v = v * base + digit;
+                if (v > 0xFFFFFFFFll) Fail("number too large", i);
+                ++j;
+            }
+            if (j == digitsStart || (j < src.size() && std::isalnum(static_cast<unsigned char>(src[j])))) {
+                Fail("malformed number", i);
+            }
+            t.kind = Tok::Number;
+            t.number = v;
+            i = j;
+        } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            std::size_t j = i;
+            while (j < src.size() && (std::isalnum(static_cast<unsigned char>(src[j])) || src[j] == '_')) ++j;
+            for (std::size_t k = i; k < j; ++k) {
+                t.text.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(src[k]))));
+            }
+            if (t.text == "and") t.kind = Tok::And;
+            else if (t.text == "or") t.kind = Tok::Or;
+            else if (t.text == "not") t.kind = Tok::Not;
+            else t.kind = Tok::Ident;
+            i = j;
+        } else if (c == '"' || c == '\'') {
+            const std::size_t close = src.find(c, i + 1);
+            if (close == std::string_view::npos) Fail("unterminated string", i);
+            t.kind = Tok::String;
+            t.text = std::string(src.substr(i + 1, close - i - 1));
+            i = close + 1;
+        } else if (two('&', '&')) { t.kind = Tok::And; i += 2; }
+        else if (two('|', '|'))   { t.kind = Tok::Or; i += 2; }
+        else if (two('=', '='))   { t.kind = Tok::Cmp; t.cmp = Comparison::Eq; i += 2; }
+        else if (two('!', '='))   { t.kind = Tok::Cmp; t.cmp = Comparison::Ne; i += 2; }
+        else if (two('<', '='))   { t.kind = Tok::Cmp; t.cmp = Comparison::Le; i += 2; }
+        else if (two('>', '='))   { t.kind = Tok::Cmp; t.cmp = Comparison::Ge; i += 2; }
+        else if (c == '<')        { t.kind = Tok::Cmp; t.cmp = Comparison::Lt; ++i; }
+        else if (c == '>')        { t.kind = Tok::Cmp; t.cmp = Comparison::Gt; ++i; }
+        else if (c == '!')        { t.kind = Tok::Not; ++i; }
+        else if (c == '(')        { t.kind = Tok::LParen; ++i; }
+        else if (c == ')')        { t.kind = Tok::RParen; ++i; }
+        else if (c == ',')        { t.kind = Tok::Comma; ++i; }
+        else Fail(std::string("unexpected character '") + c + "'", i);
+
+        t.len = i - t.pos;
+        out.push_back(std::move(t));
+    }
+}
+
+} // namespace
+
+// =========================================================
+// Parser
+// =========================================================
+
+class SaveQuery::Parser {
+public:
+    Parser(SaveQuery& q, std::string_view src) : q_(q), src_(src), toks_(Lex(src)) {}
+
+    bool AtEnd() const { return Peek().kind == Tok::End; }
+    const Token& Peek() const { return toks_[at_]; }
+    std::size_t Pos() const { return Peek().pos; }
+
+    bool Accept(Tok kind) {
+        if (Peek().kind != kind) return false;
+        ++at_;
+        return true;
+    }
+
+    int ParseOr() {
+        int lhs = ParseAnd();
+        while (Peek().kind == Tok::Or) {
+            const std::size_t pos = Pos();
+            ++at_;
+            lhs = Logical(NodeKind::Or, lhs, ParseAnd(), pos);
+        }
+        return lhs;
+    }
+
+    // Type of a finished node.
+    QueryType TypeOf(int node) const { return q_.nodes_[static_cast<std::size_t>(node)].type; }
+
+private:
+    SaveQuery& q_;
+    std::string_view src_;
+    std::vector<Token> toks_;
+    std::size_t at_ = 0;
+
+    int Add(Node n) {
+        q_.nodes_.push_back(std::move(n));
+        return static_cast<int>(q_.nodes_.size() - 1);
+    }
+
+    int Logical(NodeKind kind, int lhs, int rhs, std::size_t pos) {
+        if (TypeOf(lhs) == QueryType::String || TypeOf(rhs) == QueryType::String) {
+            Fail("'&&' / '||' need bool or number operands, not string", pos);
+        }
+        Node n;
+        n.kind = kind;
+        n.type = QueryType::Bool;
+        n.lhs = lhs;
+        n.rhs = rhs;
+        return Add(std::move(n));
+    }
+
+    int ParseAnd() {
+        int lhs = ParseCompare();
+        while (Peek().kind == Tok::And) {
+            const std::size_t pos = Pos();
+            ++at_;
+            lhs = Logical(NodeKind::And, lhs, ParseCompare(), pos);
+        }
+        return lhs;
+    }
+
+    int ParseCompare() {
+        const int lhs = ParseUnary();
+        if (Peek().kind != Tok::Cmp) return lhs;
+        const Token op = Peek();
+        ++at_;
+        const int rhs = ParseUnary();
+
+        const bool lhsText = TypeOf(lhs) == QueryType::String;
+        const bool rhsText = TypeOf(rhs) == QueryType::String;
+        if (lhsText != rhsText) Fail("cannot compare a string with a number", op.pos);
+        if (lhsText && op.cmp != Comparison::Eq && op.cmp != Comparison::Ne) {
+            Fail("strings only support == and !=", op.pos);
+        }
+
+        Node n;
+        n.kind = lhsText ? NodeKind::CompareText : NodeKind::Compare;
+        n.type = QueryType::Bool;
+        n.arg = static_cast<u8>(op.cmp);
+        n.lhs = lhs;
+        n.rhs = rhs;
+        return Add(std::move(n));
+    }
+
+    int ParseUnary() {
+        if (Peek().kind == Tok::Not) {
+            const std::size_t pos = Pos();
+            ++at_;
+            const int operand = ParseUnary();
+            if (TypeOf(operand) == QueryType::String) Fail("'!' needs a bool or number operand", pos);
+            Node n;
+            n.kind = NodeKind::Not;
+            n.type = QueryType::Bool;
+            n.lhs = operand;
+            return Add(std::move(n));
+        }
+        return ParsePrimary();
+    }
+
+    int ParsePrimary() {
+        const Token t = Peek();
+        switch (t.kind) {
+            case Tok::Number: {
+                ++at_;
+                Node n;
+                n.kind = NodeKind::Number;
+                n.value = t.number;
+                return Add(std::move(n));
+            }
+            case Tok::String: {
+                ++at_;
+                Node n;
+                n.kind = NodeKind::String;
+                n.type = QueryType::String;
+                n.text = t.text;
+                return Add(std::move(n));
+            }
+            case Tok::LParen: {
+                ++at_;
+                const int inner = ParseOr();
+                if (!Accept(Tok::RParen)) Fail("expected ')'", Pos());
+                return inner;
+            }
+            case Tok::Ident:
+                ++at_;
+                return Peek().kind == Tok::LParen ? ParseCall(t) : ParseField(t);
+            case Tok::End:
+                Fail("unexpected end of query", t.pos);
+            default:
+                Fail("unexpected '" + std::string(src_.substr(t.pos, t.len)) + "'", t.pos);
+        }
+    }
+
+    int ParseField(const Token& t) {
+        for (const FieldDef& f : kFields) {
+            if (f.name != t.text) continue;
+            Node n;
+            n.kind = NodeKind::Field;
+            n.type = f.type;
+            n.arg = static_cast<u8>(f.id);
+            n.text = std::string(f.name);
+            return Add(std::move(n));
+        }
+        if (const FieldDescriptor* d = Gen1Fields::Find(t.text); d && IsRawQueryable(*d)) {
+            Node n;
+            n.kind = NodeKind::Raw;
+            n.type = RawFieldType(*d);
+            n.arg = static_cast<u8>(d->id);
+            n.text = std::string(d->name);
+            return Add(std::move(n));
+        }
+        Fail("unknown field '" + t.text + "'", t.pos);
+    }
+
+    int ParseCall(const Token& t) {
+        const FunctionDef* def = nullptr;
+        for (const FunctionDef& f : kFunctions) {
+            if (f.name == t.text) def = &f;
+        }
+        if (!def) Fail("unknown function '" + t.text + "'", t.pos);
+
+        Accept(Tok::LParen);
+        const Token arg = Peek();
+        if (arg.kind != Tok::Number && arg.kind != Tok::String) {
+            Fail(std::string(def->name) + "() takes a constant argument", arg.pos);
+        }
+        ++at_;
+        if (!Accept(Tok::RParen)) Fail("expected ')'", Pos());
+
+        const std::int64_t value = ResolveArgument(*def, arg);
+        Node n;
+        n.kind = NodeKind::Call;
+        n.type = def->type;
+        n.arg = static_cast<u8>(def->id);
+        n.value = value;
+        n.text = std::string(def->name) + "(" + std::to_string(value) + ")";
+        return Add(std::move(n));
+    }
+
+    static std::int64_t ResolveArgument(const FunctionDef& def, const Token& arg) {
+        const auto range = [&](std::int64_t lo, std::int64_t hi) {
+            if (arg.kind != Tok::Number) Fail(std::string(def.name) + "() takes a number", arg.pos);
+            if (arg.number < lo || arg.number > hi) {
+                Fail(std::string(def.name) + "() argument must be " + std::to_string(lo) + ".." + std::to_string(hi),
+                     arg.pos);
+            }
+            return arg.number;
+        };
+
+        switch (def.arg) {
+            case ArgKind::Dex:
+                if (arg.kind == Tok::String) {
+                    const int dex = DexNumberForName(arg.text);
+                    if (dex == 0) Fail("unknown species '" + arg.text + "'", arg.pos);
+                    return dex;
+                }
+                return range(1, static_cast<std::int64_t>(Gen1Layout::PokedexSpeciesCount));
+            case ArgKind::Item:
+                if (arg.kind == Tok::String) {
+                    const int id = ItemIdForName(arg.text);
+                    if (id < 0) Fail("unknown item '" + arg.text + "'", arg.pos);
+                    return id;
+                }
+                return range(0, 255);
+            case ArgKind::Flag:
+                return range(0, static_cast<std::int64_t>(Gen1Layout::EventFlagsLen * 8 - 1));
+            case ArgKind::Badge:
+                return range(1, 8);
+            case ArgKind::Box:
+                return range(1, 12);
+        }
+        return 0;
+    }
+};
+
+// =========================================================
+// Compile
+// =========================================================
+
+SaveQuery SaveQuery::Compile(std::string_view where, std::string_view select) {
+    SaveQuery q;
+
+    {
+        Parser p(q, where);
+        if (!p.AtEnd()) {
+            q.root_ = p.ParseOr();
+            if (!p.AtEnd()) Fail("unexpected text after expression", p.Pos());
+            if (p.TypeOf(q.root_) == QueryType::String) Fail("the filter must be a condition, not a string", 0);
+        }
+    }
+
+    Parser p(q, select);
+    while (!p.AtEnd()) {
+        const std::size_t start = p.Pos();
+        q.columns_.push_back(p.ParseOr());
+        const std::size_t end = p.Pos();
+        if (!p.AtEnd() && !p.Accept(Tok::Comma)) Fail("expected ',' between columns", p.Pos());
+
+        std::string_view name = select.substr(start, end - start);
+        while (!name.empty() && std::isspace(static_cast<unsigned char>(name.back()))) name.remove_suffix(1);
+        q.columnNames_.emplace_back(name);
+    }
+    return q;
+}
+
+// =========================================================
+// Evaluation
+// =========================================================
+
+bool SaveQuery::Matches(SaveView sv) const {
+    return root_ < 0 || EvalNumber(root_, sv) != 0;
+}
+
+void SaveQuery::Project(SaveView sv, SummarySink& sink) const {
+    Gen1Name scratch;
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const int node = columns_[c];
+        const std::string_view key = columnNames_[c];
+        switch (nodes_[static_cast<std::size_t>(node)].type) {
+            case QueryType::Bool:   sink.Bool(key, EvalNumber(node, sv) != 0); break;
+            case QueryType::Number: sink.Uint(key, static_cast<std::uint64_t>(EvalNumber(node, sv))); break;
+            case QueryType::String: sink.String(key, EvalString(node, sv, scratch)); break;
+        }
+    }
+}
+
+std::int64_t SaveQuery::EvalNumber(int index, SaveView sv) const {
+    const Node& n = nodes_[static_cast<std::size_t>(index)];
+    switch (n.kind) {
+        case NodeKind::Number:
+            return n.value;
+
+        case NodeKind::Field:
+            switch (static_cast<Field>(n.arg)) {
+                case Field::BadgeCount: return std::popcount(FieldCodec<Gen1Field::Badges>::Read(sv));
+                case Field::PartyCount:
+                    return std::min<int>(FieldCodec<Gen1Field::PartyCount>::Read(sv), Gen1Layout::PartyMaxMons);
+                case Field::CurrentBox:
+                    return (FieldCodec<Gen1Field::CurrentBoxNumber>::Read(sv) & 0x7F) + 1;
+                case Field::BoxMons: {
+                    int total = 0;
+                    for (int box = 1; box <= 12; ++box) total += BoxCount(sv, box);
+                    return total;
+                }
+                case Field::HofRecords: return HallOfFameRange(sv).Size();
+                case Field::DexOwned:   return static_cast<std::int64_t>(Gen1Bitset::PokedexOwned(sv).Count());
+                case Field::DexSeen:    return static_cast<std::int64_t>(Gen1Bitset::PokedexSeen(sv).Count());
+                case Field::BagItems:   return BagItemsField::Read(sv).Size();
+                case Field::PcItems:    return PCItemBoxField::Read(sv).Size();
+                case Field::FlagsSet:   return static_cast<std::int64_t>(Gen1Bitset::EventFlags(sv).Count());
+                case Field::ChecksumOk: return Gen1Checksum::ValidateMain(sv) ? 1 : 0;
+                case Field::Size:       return static_cast<std::int64_t>(sv.Size());
+                case Field::MapName:
+                    break; // string (rejected by the type checks)
+            }
+            break;
+
+        case NodeKind::Raw:
+            return Gen1Fields::ReadNumber(static_cast<Gen1Field>(n.arg), sv);
+
+        case NodeKind::Call:
+            switch (static_cast<Function>(n.arg)) {
+                case Function::Owns:  return Gen1Bitset::PokedexOwned(sv).Test(static_cast<std::size_t>(n.value - 1));
+                case Function::Seen:  return Gen1Bitset::PokedexSeen(sv).Test(static_cast<std::size_t>(n.value - 1));
+                case Function::Flag:  return Gen1Bitset::EventFlags(sv).Test(static_cast<std::size_t>(n.value));
+                case Function::Badge: return (FieldCodec<Gen1Field::Badges>::Read(sv) >> (n.value - 1)) & 1;
+                case Function::HasItem: {
+                    const u8 id = static_cast<u8>(n.value);
+                    return BagItemsField::Read(sv).QuantityOf(id) >= 0 || PCItemBoxField::Read(sv).QuantityOf(id) >= 0;
+                }
+                case Function::BagQty:
+                    return std::max(0, BagItemsField::Read(sv).QuantityOf(static_cast<u8>(n.value)));
+                case Function::PcQty:
+                    return std::max(0, PCItemBoxField::Read(sv).QuantityOf(static_cast<u8>(n.value)));
+                case Function::BoxCount:
+                    return BoxCount(sv, static_cast<int>(n.value));
+            }
+            break;
+
+        case NodeKind::Not:
+            return EvalNumber(n.lhs, sv) == 0;
+        case NodeKind::And:
+            return EvalNumber(n.lhs, sv) != 0 && EvalNumber(n.rhs, sv) != 0;
+        case NodeKind::Or:
+            return EvalNumber(n.lhs, sv) != 0 || EvalNumber(n.rhs, sv) != 0;
+
+        case NodeKind::Compare: {
+            const std::int64_t a = EvalNumber(n.lhs, sv);
+            const std::int64_t b = EvalNumber(n.rhs, sv);
+            switch (static_cast<Comparison>(n.arg)) {
+                case Comparison::Eq: return a == b;
+                case Comparison::Ne: return a != b;
+                case Comparison::Lt: return a < b;
+                case Comparison::Le: return a <= b;
+                case Comparison::Gt: return a > b;
+                case Comparison::Ge: return a >= b;
+            }
+            break;
+        }
+
+        case NodeKind::CompareText: {
+            Gen1Name left, right;
+            const bool equal = EvalString(n.lhs, sv, left) == EvalString(n.rhs, sv, right);
+            return static_cast<Comparison>(n.arg) == Comparison::Eq ? equal : !equal;
+        }
+
+        case NodeKind::String:
+            break;
+    }
+    throw std::logic_error("SaveQuery: string node evaluated as a number");
+}
+
+std::string_view SaveQuery::EvalString(int index, SaveView sv, Gen1Name& scratch) const {
+    const Node& n = nodes_[static_cast<std::size_t>(index)];
+    if (n.kind == NodeKind::String) return n.text;
+    if (n.kind == NodeKind::Raw) {
+        scratch = Gen1Fields::ReadText(static_cast<Gen1Field>(n.arg), sv);
+        return scratch.View();
+    }
+    if (n.kind == NodeKind::Field && static_cast<Field>(n.arg) == Field::MapName) {
+        return Gen1MapLookup::NameViewFromId(FieldCodec<Gen1Field::MapId>::Read(sv));
+    }
+    throw std::logic_error("SaveQuery: non-string node evaluated as a string");
+}
+
+// =========================================================
+// Introspection
+// =========================================================
+
+std::string SaveQuery::Describe() const {
+    std::vector<std::string_view> seen;
+    std::string out;
+    for (const Node& n : nodes_) {
+        if (n.kind != NodeKind::Field && n.kind != NodeKind::Raw && n.kind != NodeKind::Call) continue;
+        if (std::find(seen.begin(), seen.end(), n.text) != seen.end()) continue;
+        seen.push_back(n.text);
+        if (!out.empty()) out += ", ";
+        out += n.text;
+    }
+    return out;
+}
+
+std::string SaveQuery::Reference() {
+    std::ostringstream oss;
+    for (const FieldDescriptor& d : Gen1Fields::Table) {
+        if (!IsRawQueryable(d)) continue;
+        oss << "  " << std::left << std::setw(16) << d.name << std::setw(8) << TypeName(RawFieldType(d)) << d.help << "\n";
+    }
+    for (const FieldDef& f : kFields) {
+        oss << "  " << std::left << std::setw(16) << f.name << std::setw(8) << TypeName(f.type) << f.help << "\n";
+    }
+    for (const FunctionDef& f : kFunctions) {
+        const std::string sig = std::string(f.name) + "(N)";
+        oss << "  " << std::left << std::setw(16) << sig << std::setw(8) << TypeName(f.type) << f.help << "\n";
+    }
+    return oss.str();
+}
+
+} // namespace savegenie
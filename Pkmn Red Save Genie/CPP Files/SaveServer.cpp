@@ -0,0 +1,796 @@
+//
+//  SaveServer.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of SaveServer / SaveClient and the edit script parser.
+//   - Connection threads only frame requests; all decoding and editing runs on
+//     the worker pool, so CPU use stays bounded however many clients connect.
+//
+
+#include "SaveServer.hpp"
+
+#include "ReadOnlyData.hpp"
+#include "SummarySink.hpp"
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SAVEGENIE_HAVE_UNIX_SOCKETS 1
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#else
+#define SAVEGENIE_HAVE_UNIX_SOCKETS 0
+#endif
+
+namespace savegenie {
+
+namespace {
+
+constexpr std::size_t kRequestHeader = 4 + 4 + 1;  // length, id, op
+constexpr std::size_t kResponseHeader = 4 + 4 + 1; // length, id, status
+
+void PutU32LE(std::uint8_t* p, std::uint32_t v) {
+    p[0] = static_cast<std::uint8_t>(v);
+    p[1] = static_cast<std::uint8_t>(v >> 8);
+    p[2] = static_cast<std::uint8_t>(v >> 16);
+    p[3] = static_cast<std::uint8_t>(v >> 24);
+}
+
+std::uint32_t GetU32LE(const std::uint8_t* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+void AppendU32LE(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    std::uint8_t b[4];
+    PutU32LE(b, v);
+    for (std::uint8_t c : b) out.push_back(c);
+}
+
+void AppendText(std::vector<std::uint8_t>& out, std::string_view s) {
+    out.insert(out.end(), reinterpret_cast<const std::uint8_t*>(s.data()),
+               reinterpret_cast<const std::uint8_t*>(s.data()) + s.size());
+}
+
+// ---- edit script ----
+
+std::vector<std::string_view> SplitWords(std::string_view line) {
+    std::vector<std::string_view> words;
+    std::size_t i = 0;
+    while (i < line.size()) {
+        while (i < line.size() && (line[i] == ' ' || line[i] == '\t')) ++i;
+        const std::size_t start = i;
+        while (i < line.size() && line[i] != ' ' && line[i] != '\t') ++i;
+        if (i > start) words.push_back(line.substr(start, i - start));
+    }
+    return words;
+}
+
+// Everything after the first word (names may contain spaces).
+std::string RestOfLine(std::string_view line, std::string_view keyword) {
+    std::string_view rest = line.substr(line.find(keyword) + keyword.size());
+    while (!rest.empty() && (rest.front() == ' ' || rest.front() == '\t')) rest.remove_prefix(1);
+    while (!rest.empty() && (rest.back() == ' ' || rest.back() == '\t' || rest.back() == '\r')) rest.remove_suffix(1);
+    return std::string(rest);
+}
+
+unsigned long ParseNumber(std::string_view s, unsigned long maxValue, const char* what) {
+    const std::string text(s);
+    std::size_t used = 0;
+    unsigned long v = 0;
+    try {
+        v = std::stoul(text, &used, 0);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used != text.size() || text.empty() || text[0] == '-') {
+        throw std::invalid_argument(std::string("bad ") + what + ": " + text);
+    }
+    if (v > maxValue) throw std::invalid_argument(std::string(what) + " out of range: " + text);
+    return v;
+}
+
+u8 ParseU8(std::string_view s, const char* what) { return static_cast<u8>(ParseNumber(s, 0xFF, what)); }
+
+// "a,b,c": exactly N values, or 1..N when `padZero` (missing ones become 0).
+template <typename T, std::size_t N>
+std::array<T, N> ParseList(std::string_view s, unsigned long maxValue, const char* what, bool padZero) {
+    std::array<T, N> out{};
+    std::size_t n = 0;
+    while (true) {
+        const std::size_t comma = s.find(',');
+        if (n == N) throw std::invalid_argument(std::string("too many ") + what + " values");
+        out[n++] = static_cast<T>(ParseNumber(s.substr(0, comma), maxValue, what));
+        if (comma == std::string_view::npos) break;
+        s.remove_prefix(comma + 1);
+    }
+    if (n != N && !padZero) throw std::invalid_argument(std::string("expected ") + std::to_string(N) + " " + what + " values");
+    return out;
+}
+
+void ParseEditLine(std::string_view line, EditBatch& batch) {
+    const std::vector<std::string_view> w = SplitWords(line);
+    const std::string_view cmd = w[0];
+    const auto need = [&](std::size_t lo, std::size_t hi) {
+        if (w.size() < lo || w.size() > hi) {
+            throw std::invalid_argument("wrong number of arguments for '" + std::string(cmd) + "'");
+        }
+    };
+
+    if (cmd == "trainer-name" || cmd == "rival-name") {
+        need(2, static_cast<std::size_t>(-1));
+        EditRequest req;
+        (cmd == "trainer-name" ? req.newTrainerName : req.newRivalName) = RestOfLine(line, cmd);
+        batch.Add(std::move(req));
+    } else if (cmd == "money") {
+        need(2, 2);
+        EditRequest req;
+        req.newMoney = static_cast<u32>(ParseNumber(w[1], 0xFFFFFFFFul, "money"));
+        batch.Add(std::move(req));
+    } else if (cmd == "coins") {
+        need(2, 2);
+        EditRequest req;
+        req.newCoins = static_cast<u16>(ParseNumber(w[1], 0xFFFF, "coins"));
+        batch.Add(std::move(req));
+    } else if (cmd == "badges") {
+        need(2, 2);
+        EditRequest req;
+        req.newBadges = ParseU8(w[1], "badges");
+        batch.Add(std::move(req));
+    } else if (cmd == "location") {
+        need(4, 4);
+        EditRequest req;
+        req.newMapId = ParseU8(w[1], "map id");
+        req.newX = ParseU8(w[2], "x");
+        req.newY = ParseU8(w[3], "y");
+        batch.Add(std::move(req));
+    } else if (cmd == "item") {
+        need(4, 5);
+        ItemEditRequest req;
+        if (w[1] == "add") req.action = ItemEditAction::AddOrUpdate;
+        else if (w[1] == "set") req.action = ItemEditAction::SetQuantity;
+        else if (w[1] == "remove") req.action = ItemEditAction::Remove;
+        else throw std::invalid_argument("unknown item action: " + std::string(w[1]));
+
+        if (w[2] == "bag") req.list = ItemListKind::Bag;
+        else if (w[2] == "pc") req.list = ItemListKind::PCItemBox;
+        else throw std::invalid_argument("unknown item list: " + std::string(w[2]));
+
+        req.itemId = ParseU8(w[3], "item id");
+        if (req.action == ItemEditAction::Remove) {
+            if (w.size() != 4) throw std::invalid_argument("'item remove' takes no quantity");
+        } else {
+            if (w.size() != 5) throw std::invalid_argument("missing item quantity");
+            req.quantity = ParseU8(w[4], "quantity");
+        }
+        batch.Add(std::move(req));
+    } else if (cmd == "mon") {
+        need(3, static_cast<std::size_t>(-1));
+        PokemonEditRequest req;
+        const std::string_view where = w[1];
+        if (where == "party") {
+            req.kind = PokemonSlotKind::Party;
+        } else if (where == "current") {
+            req.kind = PokemonSlotKind::CurrentBox;
+        } else if (where.rfind("box:", 0) == 0) {
+            req.kind = PokemonSlotKind::PCBox;
+            req.boxIndex1to12 = static_cast<int>(ParseNumber(where.substr(4), 12, "box"));
+        } else {
+            throw std::invalid_argument("unknown mon location: " + std::string(where));
+        }
+        req.slotIndex0to19 = static_cast<int>(ParseNumber(w[2], 19, "slot"));
+
+        for (std::size_t i = 3; i < w.size(); ++i) {
+            if (w[i] == "restore-pp") {
+                req.restorePp = true;
+                continue;
+            }
+            const std::size_t eq = w[i].find('=');
+            if (eq == std::string_view::npos) throw std::invalid_argument("expected key=value: " + std::string(w[i]));
+            const std::string_view key = w[i].substr(0, eq);
+            const std::string_view value = w[i].substr(eq + 1);
+            if (key == "species") req.newSpeciesId = ParseU8(value, "species");
+            else if (key == "level") req.newLevel = ParseU8(value, "level");
+            else if (key == "nickname") req.newNickname = std::string(value);
+            else if (key == "ot") req.newOtName = std::string(value);
+            else if (key == "dvs") req.newDVs = ParseList<u8, 4>(value, 0xFF, "dv", false);
+            else if (key == "statexp") req.newStatExp = ParseList<u16, 5>(value, 0xFFFF, "stat exp", false);
+            else if (key == "moves") req.newMoves = ParseList<u8, 4>(value, 0xFF, "move", true);
+            else if (key == "ppups") req.newPpUps = ParseList<u8, 4>(value, 0xFF, "pp up", true);
+            else throw std::invalid_argument("unknown mon field: " + std::string(key));
+        }
+        batch.Add(std::move(req));
+    } else if (cmd == "mons") {
+        need(3, static_cast<std::size_t>(-1));
+        PokemonBulkEditRequest req;
+        if (w[1] == "party") req.scope = PokemonScope::Party;
+        else if (w[1] == "boxes") req.scope = PokemonScope::PCBoxes;
+        else if (w[1] == "all") req.scope = PokemonScope::All;
+        else throw std::invalid_argument("unknown mons scope: " + std::string(w[1]));
+
+        for (std::size_t i = 2; i < w.size(); ++i) {
+            if (w[i] == "restore-pp") {
+                req.restorePp = true;
+                continue;
+            }
+            const std::size_t eq = w[i].find('=');
+            if (eq == std::string_view::npos) throw std::invalid_argument("expected key=value: " + std::string(w[i]));
+            const std::string_view key = w[i].substr(0, eq);
+            const std::string_view value = w[i].substr(eq + 1);
+            if (key == "level") req.newLevel = ParseU8(value, "level");
+            else if (key == "dvs") req.newDVs = ParseList<u8, 4>(value, 0xFF, "dv", false);
+            else if (key == "statexp") req.newStatExp = ParseList<u16, 5>(value, 0xFFFF, "stat exp", false);
+            else if (key == "ppups") req.newPpUps = ParseList<u8, 4>(value, 0xFF, "pp up", true);
+            else throw std::invalid_argument("unknown mons field: " + std::string(key));
+        }
+        batch.Add(std::move(req));
+    } else {
+        throw std::invalid_argument("unknown edit: " + std::string(cmd));
+    }
+}
+
+#if SAVEGENIE_HAVE_UNIX_SOCKETS
+
+bool ReadExact(int fd, std::uint8_t* p, std::size_t n) {
+    while (n > 0) {
+        const ssize_t r = ::read(fd, p, n);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        p += r;
+        n -= static_cast<std::size_t>(r);
+    }
+    return true;
+}
+
+// Write both parts, retrying partial writes. No SIGPIPE if the peer is gone.
+bool SendAll(int fd, std::span<const std::uint8_t> head, std::span<const std::uint8_t> body) {
+    iovec iov[2] = {{const_cast<std::uint8_t*>(head.data()), head.size()},
+                    {const_cast<std::uint8_t*>(body.data()), body.size()}};
+    int first = 0;
+    while (first < 2) {
+        msghdr msg{};
+        msg.msg_iov = iov + first;
+        msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(2 - first);
+#ifdef MSG_NOSIGNAL
+        const ssize_t n = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+#else
+        const ssize_t n = ::sendmsg(fd, &msg, 0);
+#endif
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) return false;
+        std::size_t left = static_cast<std::size_t>(n);
+        while (first < 2 && left >= iov[first].iov_len) {
+            left -= iov[first].iov_len;
+            ++first;
+        }
+        if (first < 2) {
+            iov[first].iov_base = static_cast<std::uint8_t*>(iov[first].iov_base) + left;
+            iov[first].iov_len -= left;
+        }
+    }
+    return true;
+}
+
+void NoSigPipe([[maybe_unused]] int fd) {
+#ifdef SO_NOSIGPIPE
+    const int one = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+}
+
+sockaddr_un SocketAddress(const std::string& path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+        throw std::runtime_error("Socket path is empty or too long: " + path);
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return addr;
+}
+
+#endif
+
+} // namespace
+
+// =========================================================
+// Connection / Worker state
+// =========================================================
+
+class SaveServer::Connection {
+public:
+    int fd = -1; // -1 once closed; closed (and read by Shutdown) under SaveServer::mu_
+    std::vector<std::uint8_t> rx; // reused for every request on this connection
+
+    // Completion of the request in flight (set by the worker after responding).
+    std::mutex mu;
+    std::condition_variable cv;
+    bool answered = false;
+
+    std::thread thread;
+    std::atomic<bool> finished{false};
+};
+
+class SaveServer::Worker {
+public:
+    SaveBuffer buffer;
+    ReadOnlyData reader{buffer};
+
+    OutputBuffer records;
+    std::array<std::unique_ptr<SummarySink>, 3> sinks; // by SummaryFormat
+
+    std::vector<std::uint8_t> body; // response body, reused
+    std::vector<Job> batch;
+
+    Worker() {
+        for (std::size_t f = 0; f < sinks.size(); ++f) {
+            sinks[f] = SummarySink::Create(static_cast<SummaryFormat>(f), records);
+        }
+    }
+};
+
+// =========================================================
+// Edit script
+// =========================================================
+
+EditBatch SaveServer::ParseEditScript(std::string_view script) {
+    EditBatch batch;
+    std::size_t lineNo = 0;
+    while (!script.empty()) {
+        const std::size_t nl = script.find('\n');
+        std::string_view line = script.substr(0, nl);
+        script = nl == std::string_view::npos ? std::string_view() : script.substr(nl + 1);
+        ++lineNo;
+
+        const std::size_t hash = line.find('#');
+        if (hash != std::string_view::npos) line = line.substr(0, hash);
+        if (SplitWords(line).empty()) continue;
+
+        try {
+            ParseEditLine(line, batch);
+        } catch (const std::invalid_argument& e) {
+            throw std::invalid_argument("edit script line " + std::to_string(lineNo) + ": " + e.what());
+        }
+    }
+    return batch;
+}
+
+// =========================================================
+// SaveServer
+// =========================================================
+
+SaveServer::SaveServer(ServerOptions opts) : opts_(std::move(opts)) {
+    opts_.maxBatch = std::max<std::size_t>(opts_.maxBatch, 1);
+}
+
+SaveServer::~SaveServer() {
+    Shutdown();
+#if SAVEGENIE_HAVE_UNIX_SOCKETS
+    for (int& fd : wakeFds_) {
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+    }
+#endif
+}
+
+void SaveServer::Stop() {
+#if SAVEGENIE_HAVE_UNIX_SOCKETS
+    if (wakeFds_[1] >= 0) {
+        const char c = 'x';
+        [[maybe_unused]] const ssize_t n = ::write(wakeFds_[1], &c, 1);
+    }
+#endif
+}
+
+#if SAVEGENIE_HAVE_UNIX_SOCKETS
+
+void SaveServer::Run() {
+    if (::pipe(wakeFds_) != 0) throw std::runtime_error("SaveServer: pipe failed");
+
+    const sockaddr_un addr = SocketAddress(opts_.socketPath);
+
+    // A socket file left by a previous run is replaced; a live server's socket
+    // or anything that is not a socket is not ours.
+    struct stat st {};
+    if (::lstat(opts_.socketPath.c_str(), &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            throw std::runtime_error("SaveServer: path exists and is not a socket: " + opts_.socketPath);
+        }
+        const int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        const bool live = probe >= 0 && ::connect(probe, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+        if (probe >= 0) ::close(probe);
+        if (live) throw std::runtime_error("SaveServer: another server is listening on " + opts_.socketPath);
+        ::unlink(opts_.socketPath.c_str());
+    }
+
+    listenFd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd_ < 0) throw std::runtime_error("SaveServer: socket failed");
+    ::fcntl(listenFd_, F_SETFD, FD_CLOEXEC);
+    if (::bind(listenFd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listenFd_, 128) != 0) {
+        const std::string reason = std::strerror(errno);
+        ::close(listenFd_);
+        listenFd_ = -1;
+        throw std::runtime_error("SaveServer: could not listen on " + opts_.socketPath + " (" + reason + ")");
+    }
+
+    const unsigned workerCount = WorkStealingPool::ResolveThreadCount(opts_.workers);
+    std::vector<std::unique_ptr<Worker>> state;
+    for (unsigned i = 0; i < workerCount; ++i) state.push_back(std::make_unique<Worker>());
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers_.emplace_back([this, w = state[i].get()] { RunWorker(*w); });
+    }
+
+    for (;;) {
+        pollfd fds[2] = {{listenFd_, POLLIN, 0}, {wakeFds_[0], POLLIN, 0}};
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (fds[1].revents != 0) break;
+        if ((fds[0].revents & POLLIN) == 0) continue;
+
+        const int fd = ::accept(listenFd_, nullptr, nullptr);
+        if (fd < 0) continue;
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        NoSigPipe(fd);
+
+        std::lock_guard<std::mutex> lock(mu_);
+        // Reap connections whose clients have gone.
+        for (auto it = conns_.begin(); it != conns_.end();) {
+            if ((*it)->finished.load(std::memory_order_acquire)) {
+                (*it)->thread.join();
+                it = conns_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (conns_.size() >= opts_.maxConnections) {
+            // No thread for this one: say why and hang up.
+            static constexpr std::string_view msg = "too many connections";
+            std::uint8_t head[kResponseHeader];
+            PutU32LE(head, static_cast<std::uint32_t>(kResponseHeader - 4 + msg.size()));
+            PutU32LE(head + 4, 0);
+            head[8] = static_cast<std::uint8_t>(ServerStatus::Busy);
+            SendAll(fd, head, {reinterpret_cast<const std::uint8_t*>(msg.data()), msg.size()});
+            ::close(fd);
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        connections_.fetch_add(1, std::memory_order_relaxed);
+        auto conn = std::make_shared<Connection>();
+        conn->fd = fd;
+        conns_.push_back(conn);
+        conn->thread = std::thread([this, conn] { ServeConnection(conn); });
+    }
+
+    Shutdown();
+}
+
+void SaveServer::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (stopping_ && workers_.empty()) return;
+        stopping_ = true;
+        // Wake readers blocked in read(); requests already queued still finish.
+        for (const auto& c : conns_) {
+            if (c->fd >= 0) ::shutdown(c->fd, SHUT_RDWR);
+        }
+    }
+
+    std::vector<std::shared_ptr<Connection>> conns;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        conns.swap(conns_);
+    }
+    for (const auto& c : conns) c->thread.join();
+
+    jobsCv_.notify_all();
+    for (std::thread& t : workers_) t.join();
+    workers_.clear();
+
+    if (listenFd_ >= 0) {
+        ::close(listenFd_);
+        listenFd_ = -1;
+        ::unlink(opts_.socketPath.c_str());
+    }
+}
+
+void SaveServer::ServeConnection(const std::shared_ptr<Connection>& conn) {
+    Connection& c = *conn;
+    std::uint8_t head[4];
+    while (ReadExact(c.fd, head, sizeof(head))) {
+        const std::uint32_t len = GetU32LE(head);
+        if (len < kRequestHeader - 4 || len > opts_.maxRequestBytes) {
+            const std::string_view msg = "request too large or truncated";
+            Respond(c, 0, ServerStatus::BadRequest,
+                    {reinterpret_cast<const std::uint8_t*>(msg.data()), msg.size()});
+            failures_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        c.rx.resize(len);
+        if (!ReadExact(c.fd, c.rx.data(), len)) break;
+
+        Job job;
+        job.conn = &c;
+        job.id = GetU32LE(c.rx.data());
+        job.op = static_cast<ServerOp>(c.rx[4]);
+        job.payload = std::span<const std::uint8_t>(c.rx).subspan(5);
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (stopping_) break;
+            jobs_.push_back(job);
+        }
+        jobsCv_.notify_one();
+
+        std::unique_lock<std::mutex> lock(c.mu);
+        c.cv.wait(lock, [&] { return c.answered; });
+        c.answered = false;
+    }
+    {
+        // Shutdown() must never see a closed number that may already be reused.
+        std::lock_guard<std::mutex> lock(mu_);
+        ::close(c.fd);
+        c.fd = -1;
+    }
+    c.finished.store(true, std::memory_order_release);
+}
+
+void SaveServer::RunWorker(Worker& w) {
+    for (;;) {
+        w.batch.clear();
+        {
+            std::unique_lock<std::mutex> lock(mu_);
+            jobsCv_.wait(lock, [&] { return !jobs_.empty() || stopping_; });
+            if (jobs_.empty()) return;
+            const std::size_t n = std::min(jobs_.size(), opts_.maxBatch);
+            w.batch.assign(jobs_.begin(), jobs_.begin() + static_cast<std::ptrdiff_t>(n));
+            jobs_.erase(jobs_.begin(), jobs_.begin() + static_cast<std::ptrdiff_t>(n));
+        }
+        batches_.fetch_add(1, std::memory_order_relaxed);
+
+        for (const Job& job : w.batch) {
+            Handle(w, job);
+            Connection& c = *job.conn;
+            {
+                std::lock_guard<std::mutex> lock(c.mu);
+                c.answered = true;
+            }
+            c.cv.notify_one();
+        }
+    }
+}
+
+void SaveServer::Respond(Connection& conn, std::uint32_t id, ServerStatus status,
+                         std::span<const std::uint8_t> body) {
+    std::uint8_t head[kResponseHeader];
+    PutU32LE(head, static_cast<std::uint32_t>(kResponseHeader - 4 + body.size()));
+    PutU32LE(head + 4, id);
+    head[8] = static_cast<std::uint8_t>(status);
+    SendAll(conn.fd, head, body); // a vanished client just ends its connection
+}
+
+#else
+
+void SaveServer::Run() {
+    throw std::runtime_error("SaveServer: Unix domain sockets are not available on this platform");
+}
+
+void SaveServer::Shutdown() {}
+void SaveServer::ServeConnection(const std::shared_ptr<Connection>&) {}
+void SaveServer::RunWorker(Worker&) {}
+void SaveServer::Respond(Connection&, std::uint32_t, ServerStatus, std::span<const std::uint8_t>) {}
+
+#endif
+
+void SaveServer::Handle(Worker& w, const Job& job) {
+    requests_.fetch_add(1, std::memory_order_relaxed);
+    std::vector<std::uint8_t>& body = w.body;
+    body.clear();
+    ServerStatus status = ServerStatus::Ok;
+
+    try {
+        const std::span<const std::uint8_t> p = job.payload;
+        switch (job.op) {
+            case ServerOp::Ping:
+                break;
+
+            case ServerOp::Stats:
+                AppendText(body, StatsText());
+                break;
+
+            case ServerOp::Summary: {
+                if (p.empty()) throw std::invalid_argument("summary: missing format byte");
+                const std::uint8_t format = p[0];
+                w.buffer.BytesMutable().assign(p.begin() + 1, p.end());
+                if (format == SummaryTextFormat) {
+                    AppendText(body, w.reader.DumpFullSummary());
+                } else if (format < w.sinks.size()) {
+                    SummarySink& sink = *w.sinks[format];
+                    w.records.Clear();
+                    sink.BeginRecord();
+                    sink.Bool("ok", true);
+                    sink.Uint("size", w.buffer.Size());
+                    w.reader.WriteSummary(sink);
+                    sink.EndRecord();
+                    AppendText(body, w.records.Data());
+                } else {
+                    throw std::invalid_argument("summary: unknown format " + std::to_string(format));
+                }
+                break;
+            }
+
+            case ServerOp::Edit: {
+                if (p.size() < 4) throw std::invalid_argument("edit: missing script length");
+                const std::uint32_t scriptLen = GetU32LE(p.data());
+                if (scriptLen > p.size() - 4) throw std::invalid_argument("edit: script length past end of request");
+                const std::string_view script(reinterpret_cast<const char*>(p.data() + 4), scriptLen);
+                const EditBatch batch = ParseEditScript(script);
+
+                w.buffer.BytesMutable().assign(p.begin() + 4 + scriptLen, p.end());
+                WriteOnlyData writer(w.buffer);
+                EditLog log;
+                const EditMessage msg = writer.ApplyBatch(batch, &log);
+                const std::string logText = log.ToString();
+                if (msg.Ok()) {
+                    AppendU32LE(body, static_cast<std::uint32_t>(logText.size()));
+                    AppendText(body, logText);
+                    const SaveBuffer::Bytes& edited = w.buffer.BytesView();
+                    body.insert(body.end(), edited.begin(), edited.end());
+                } else {
+                    status = ServerStatus::EditRejected;
+                    AppendText(body, msg.message);
+                    AppendText(body, "\n");
+                    AppendText(body, logText);
+                }
+                break;
+            }
+
+            default:
+                throw std::invalid_argument("unknown op " + std::to_string(static_cast<int>(job.op)));
+        }
+    } catch (const std::exception& e) {
+        // Malformed requests and unreadable saves (wrong size, out-of-range offsets).
+        status = ServerStatus::BadRequest;
+        body.clear();
+        AppendText(body, e.what());
+    }
+
+    if (status != ServerStatus::Ok) failures_.fetch_add(1, std::memory_order_relaxed);
+    Respond(*job.conn, job.id, status, body);
+}
+
+std::string SaveServer::StatsText() const {
+    std::ostringstream oss;
+    const auto counter = [&](const char* name, const char* help, std::uint64_t v) {
+        oss << "# HELP savegenie_server_" << name << ' ' << help << "\n"
+            << "# TYPE savegenie_server_" << name << " counter\n"
+            << "savegenie_server_" << name << ' ' << v << "\n";
+    };
+    counter("requests_total", "Requests handled.", requests_.load(std::memory_order_relaxed));
+    counter("failures_total", "Requests answered with a non-ok status.", failures_.load(std::memory_order_relaxed));
+    counter("batches_total", "Worker wake-ups (each takes up to maxBatch requests).",
+            batches_.load(std::memory_order_relaxed));
+    counter("connections_total", "Connections accepted.", connections_.load(std::memory_order_relaxed));
+    counter("connections_rejected_total", "Connections turned away at maxConnections.",
+            rejected_.load(std::memory_order_relaxed));
+    oss << "# HELP savegenie_server_workers Worker threads.\n"
+        << "# TYPE savegenie_server_workers gauge\n"
+        << "savegenie_server_workers " << workers_.size() << "\n";
+    return oss.str();
+}
+
+// =========================================================
+// SaveClient
+// =========================================================
+
+#if SAVEGENIE_HAVE_UNIX_SOCKETS
+
+SaveClient::SaveClient(const std::string& socketPath) {
+    const sockaddr_un addr = SocketAddress(socketPath);
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd_ < 0) throw std::runtime_error("SaveClient: socket failed");
+    if (::connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        const std::string reason = std::strerror(errno);
+        ::close(fd_);
+        fd_ = -1;
+        throw std::runtime_error("SaveClient: could not connect to " + socketPath + " (" + reason + ")");
+    }
+    NoSigPipe(fd_);
+}
+
+SaveClient::~SaveClient() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+SaveClient::Response SaveClient::Call(ServerOp op, std::span<const std::uint8_t> payload) {
+    const std::uint32_t id = nextId_++;
+    std::uint8_t head[kRequestHeader];
+    PutU32LE(head, static_cast<std::uint32_t>(kRequestHeader - 4 + payload.size()));
+    PutU32LE(head + 4, id);
+    head[8] = static_cast<std::uint8_t>(op);
+    // A failed send may still have a reply waiting (Busy is sent before the server hangs up).
+    const bool sent = SendAll(fd_, head, payload);
+
+    std::uint8_t rh[kResponseHeader];
+    if (!ReadExact(fd_, rh, sizeof(rh))) {
+        throw std::runtime_error(sent ? "SaveClient: connection closed by server" : "SaveClient: send failed");
+    }
+    const std::uint32_t len = GetU32LE(rh);
+    if (len < kResponseHeader - 4) throw std::runtime_error("SaveClient: malformed response");
+
+    Response r;
+    r.status = static_cast<ServerStatus>(rh[8]);
+    r.body.resize(len - (kResponseHeader - 4));
+    if (!ReadExact(fd_, r.body.data(), r.body.size())) throw std::runtime_error("SaveClient: truncated response");
+    // id 0 answers a request the server could not frame.
+    if (GetU32LE(rh + 4) != id && GetU32LE(rh + 4) != 0) throw std::runtime_error("SaveClient: response id mismatch");
+    return r;
+}
+
+#else
+
+SaveClient::SaveClient(const std::string&) {
+    throw std::runtime_error("SaveClient: Unix domain sockets are not available on this platform");
+}
+SaveClient::~SaveClient() {}
+SaveClient::Response SaveClient::Call(ServerOp, std::span<const std::uint8_t>) { return {}; }
+
+#endif
+
+SaveClient::Response SaveClient::Ping() {
+    return Call(ServerOp::Ping, {});
+}
+
+SaveClient::Response SaveClient::Stats() {
+    return Call(ServerOp::Stats, {});
+}
+
+SaveClient::Response SaveClient::Summary(std::uint8_t format, std::span<const std::uint8_t> save) {
+    tx_.clear();
+    tx_.push_back(format);
+    tx_.insert(tx_.end(), save.begin(), save.end());
+    return Call(ServerOp::Summary, tx_);
+}
+
+SaveClient::Response SaveClient::Edit(std::string_view script, std::span<const std::uint8_t> save) {
+    tx_.clear();
+    AppendU32LE(tx_, static_cast<std::uint32_t>(script.size()));
+    AppendText(tx_, script);
+    tx_.insert(tx_.end(), save.begin(), save.end());
+    return Call(ServerOp::Edit, tx_);
+}
+
+void SaveClient::SplitEditBody(std::span<const std::uint8_t> body, std::string& log, std::vector<std::uint8_t>& save) {
+    if (body.size() < 4) throw std::runtime_error("SaveClient: malformed edit response");
+    const std::uint32_t logLen = GetU32LE(body.data());
+    if (logLen > body.size() - 4) throw std::runtime_error("SaveClient: malformed edit response");
+    log.assign(reinterpret_cast<const char*>(body.data() + 4), logLen);
+    save.assign(body.begin() + 4 + logLen, body.end());
+}
+
+const char* SaveClient::StatusName(ServerStatus status) {
+    switch (status) {
+        case ServerStatus::Ok:            return "ok";
+        case ServerStatus::BadRequest:    return "bad-request";
+        case ServerStatus::EditRejected:  return "edit-rejected";
+        case ServerStatus::InternalError: return "internal-error";
+        case ServerStatus::Busy:          return "busy";
+    }
+    return "unknown";
+}
+
+} // namespace savegenie
@@ -0,0 +1,476 @@
+//
+//  SaveStream.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of SaveStream: a forward-only reader over stdin or a
+//     file that yields saves from raw frame concatenations, tar and zip.
+//
+//  Notes:
+//   - Contains no Pokémon-specific logic (like FileManipulation).
+//   - The read-ahead window is 64 KiB; payloads larger than that are read
+//     straight into the frame buffer.
+//
+
+#include "SaveStream.hpp"
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <stdexcept>
+
+namespace savegenie {
+
+// =========================================================
+// Helpers
+// =========================================================
+
+namespace {
+
+constexpr std::size_t kWindow = 64 * 1024;
+constexpr std::size_t kTarBlock = 512;
+
+constexpr std::array<std::uint32_t, 256> MakeCrcTable() {
+    std::array<std::uint32_t, 256> t{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t c = i;
+        for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        t[i] = c;
+    }
+    return t;
+}
+
+constexpr auto kCrcTable = MakeCrcTable();
+
+// CRC-32 (IEEE, reflected) as stored in zip headers.
+std::uint32_t Crc32(const std::uint8_t* p, std::size_t n) {
+    std::uint32_t c = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < n; ++i) c = kCrcTable[(c ^ p[i]) & 0xFF] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+std::uint16_t Le16(const std::uint8_t* p) {
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+std::uint32_t Le32(const std::uint8_t* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t Le64(const std::uint8_t* p) {
+    return static_cast<std::uint64_t>(Le32(p)) | (static_cast<std::uint64_t>(Le32(p + 4)) << 32);
+}
+
+// NUL-terminated (or full-width) tar string field.
+std::string_view TarString(const std::uint8_t* p, std::size_t width) {
+    const char* s = reinterpret_cast<const char*>(p);
+    return std::string_view(s, ::strnlen(s, width));
+}
+
+// Octal (space / NUL padded) or GNU base-256 numeric field.
+bool TarNumber(const std::uint8_t* p, std::size_t width, std::uint64_t& out) {
+    out = 0;
+    if (p[0] & 0x80) {
+        for (std::size_t i = 1; i < width; ++i) {
+            if (out >> 56) return false;
+            out = (out << 8) | p[i];
+        }
+        return true;
+    }
+    std::size_t i = 0;
+    while (i < width && p[i] == ' ') ++i;
+    bool any = false;
+    for (; i < width && p[i] >= '0' && p[i] <= '7'; ++i) {
+        if (out >> 61) return false;
+        out = (out << 3) | static_cast<std::uint64_t>(p[i] - '0');
+        any = true;
+    }
+    for (; i < width; ++i) {
+        if (p[i] != ' ' && p[i] != '\0') return false;
+    }
+    return any;
+}
+
+bool TarChecksumOk(const std::uint8_t* h) {
+    std::uint64_t stored = 0;
+    if (!TarNumber(h + 148, 8, stored)) return false;
+    std::uint64_t unsignedSum = 0;
+    std::int64_t signedSum = 0;
+    for (std::size_t i = 0; i < kTarBlock; ++i) {
+        const std::uint8_t b = (i >= 148 && i < 156) ? ' ' : h[i];
+        unsignedSum += b;
+        signedSum += static_cast<std::int8_t>(b);
+    }
+    return stored == unsignedSum || static_cast<std::int64_t>(stored) == signedSum;
+}
+
+std::uint64_t TarPadding(std::uint64_t size) {
+    return (kTarBlock - size % kTarBlock) % kTarBlock;
+}
+
+// PAX extended header: "<len> <key>=<value>\n" records.
+void ParsePax(std::string_view rec, std::string& path, std::optional<std::uint64_t>& size) {
+    while (!rec.empty()) {
+        std::size_t len = 0;
+        std::size_t i = 0;
+        while (i < rec.size() && rec[i] >= '0' && rec[i] <= '9') len = len * 10 + static_cast<std::size_t>(rec[i++] - '0');
+        if (i == 0 || len <= i || len > rec.size()) return;
+        std::string_view kv = rec.substr(i + 1, len - i - 1);
+        rec.remove_prefix(len);
+        if (!kv.empty() && kv.back() == '\n') kv.remove_suffix(1);
+        const std::size_t eq = kv.find('=');
+        if (eq == std::string_view::npos) continue;
+        const std::string_view key = kv.substr(0, eq);
+        const std::string_view value = kv.substr(eq + 1);
+        if (key == "path") {
+            path.assign(value);
+        } else if (key == "size") {
+            std::uint64_t v = 0;
+            bool ok = !value.empty();
+            for (char c : value) {
+                if (c < '0' || c > '9') { ok = false; break; }
+                v = v * 10 + static_cast<std::uint64_t>(c - '0');
+            }
+            if (ok) size = v;
+        }
+    }
+}
+
+} // namespace
+
+// =========================================================
+// SaveStream
+// =========================================================
+
+SaveStream::SaveStream(const std::string& path, StreamFormat format, std::size_t frameSize)
+    : format_(format), frameSize_(frameSize), buf_(kWindow) {
+    if (frameSize_ == 0 || frameSize_ > MaxMemberSize) {
+        throw std::invalid_argument("SaveStream: frame size must be within 1.." + std::to_string(MaxMemberSize));
+    }
+    if (path == "-") {
+        file_ = stdin;
+        label_ = "stdin";
+    } else {
+        file_ = std::fopen(path.c_str(), "rb");
+        if (!file_) {
+            throw std::runtime_error("SaveStream failed: could not open input file: " + path + " (" +
+                                     std::strerror(errno) + ")");
+        }
+        ownsFile_ = true;
+        label_ = path;
+    }
+}
+
+SaveStream::~SaveStream() {
+    if (ownsFile_) std::fclose(file_);
+}
+
+std::optional<StreamFormat> SaveStream::ParseFormat(std::string_view s) {
+    if (s == "auto") return StreamFormat::Auto;
+    if (s == "raw") return StreamFormat::Raw;
+    if (s == "tar") return StreamFormat::Tar;
+    if (s == "zip") return StreamFormat::Zip;
+    return std::nullopt;
+}
+
+std::string_view SaveStream::FormatName(StreamFormat f) {
+    switch (f) {
+    case StreamFormat::Auto: return "auto";
+    case StreamFormat::Raw: return "raw";
+    case StreamFormat::Tar: return "tar";
+    case StreamFormat::Zip: return "zip";
+    }
+    return "auto";
+}
+
+void SaveStream::Fail(const std::string& what) const {
+    throw std::runtime_error("SaveStream failed: " + what + " in " + label_ + " (offset " +
+                             std::to_string(offset_) + ")");
+}
+
+std::size_t SaveStream::Fill(std::size_t n) {
+    if (end_ - pos_ >= n || eof_) return end_ - pos_;
+    if (pos_ > 0) {
+        std::memmove(buf_.data(), buf_.data() + pos_, end_ - pos_);
+        end_ -= pos_;
+        pos_ = 0;
+    }
+    while (end_ < n && !eof_) {
+        const std::size_t got = std::fread(buf_.data() + end_, 1, buf_.size() - end_, file_);
+        SAVEGENIE_COUNT(BytesRead, got);
+        end_ += got;
+        if (got == 0) {
+            if (std::ferror(file_)) Fail(std::string("read error (") + std::strerror(errno) + ")");
+            eof_ = true;
+        }
+    }
+    return end_ - pos_;
+}
+
+std::size_t SaveStream::Read(std::uint8_t* dst, std::size_t n) {
+    std::size_t done = std::min(n, end_ - pos_);
+    std::memcpy(dst, buf_.data() + pos_, done);
+    pos_ += done;
+    while (done < n && !eof_) {
+        // Large payloads bypass the window; small remainders refill it.
+        if (n - done >= buf_.size()) {
+            const std::size_t got = std::fread(dst + done, 1, n - done, file_);
+            SAVEGENIE_COUNT(BytesRead, got);
+            done += got;
+            if (got == 0) {
+                if (std::ferror(file_)) Fail(std::string("read error (") + std::strerror(errno) + ")");
+                eof_ = true;
+            }
+        } else {
+            const std::size_t avail = Fill(n - done);
+            const std::size_t take = std::min(avail, n - done);
+            std::memcpy(dst + done, buf_.data() + pos_, take);
+            pos_ += take;
+            done += take;
+            if (take == 0) break;
+        }
+    }
+    offset_ += done;
+    return done;
+}
+
+bool SaveStream::Skip(std::uint64_t n) {
+    while (n > 0) {
+        if (Fill(1) == 0) return false;
+        const std::size_t take = static_cast<std::size_t>(std::min<std::uint64_t>(n, end_ - pos_));
+        pos_ += take;
+        offset_ += take;
+        n -= take;
+    }
+    return true;
+}
+
+void SaveStream::Detect() {
+    const std::size_t have = Fill(kTarBlock);
+    const std::uint8_t* p = buf_.data() + pos_;
+    if (have >= 4 && p[0] == 'P' && p[1] == 'K' && ((p[2] == 3 && p[3] == 4) || (p[2] == 5 && p[3] == 6))) {
+        format_ = StreamFormat::Zip;
+    } else if (have >= kTarBlock && std::memcmp(p + 257, "ustar", 5) == 0) {
+        format_ = StreamFormat::Tar;
+    } else {
+        format_ = StreamFormat::Raw;
+    }
+}
+
+bool SaveStream::Next(StreamFrame& out) {
+    SAVEGENIE_STAGE(Load);
+    out.name.clear();
+    out.member.clear();
+    out.error.clear();
+    out.bytes.clear();
+    if (finished_) return false;
+    if (format_ == StreamFormat::Auto) Detect();
+
+    bool more = false;
+    switch (format_) {
+    case StreamFormat::Tar: more = NextTar(out); break;
+    case StreamFormat::Zip: more = NextZip(out); break;
+    default: more = NextRaw(out); break;
+    }
+    if (!more) {
+        finished_ = true;
+        return false;
+    }
+    out.index = nextIndex_++;
+    return true;
+}
+
+void SaveStream::ReadMember(StreamFrame& out, std::uint64_t size, const char* container) {
+    if (size > MaxMemberSize) {
+        out.error = std::string(container) + ": member is " + std::to_string(size) + " bytes (limit " +
+                    std::to_string(MaxMemberSize) + ")";
+        if (!Skip(size)) finished_ = true;
+        return;
+    }
+    out.bytes.resize(static_cast<std::size_t>(size));
+    const std::size_t got = Read(out.bytes.data(), out.bytes.size());
+    if (got < size) {
+        out.error = std::string(container) + ": stream ended inside member (" + std::to_string(got) + " of " +
+                    std::to_string(size) + " bytes)";
+        out.bytes.clear();
+        finished_ = true;
+    }
+}
+
+// ---------------------------------------------------------
+// Raw frames
+// ---------------------------------------------------------
+
+bool SaveStream::NextRaw(StreamFrame& out) {
+    if (Fill(1) == 0) return false;
+    char idx[24];
+    std::snprintf(idx, sizeof idx, "%07" PRIu64, nextIndex_);
+    out.name = label_ + ":" + idx;
+    out.bytes.resize(frameSize_);
+    const std::size_t got = Read(out.bytes.data(), frameSize_);
+    if (got < frameSize_) {
+        out.error = "stream ended mid-frame (" + std::to_string(got) + " of " + std::to_string(frameSize_) +
+                    " bytes)";
+        out.bytes.clear();
+        finished_ = true;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------
+// Tar
+// ---------------------------------------------------------
+
+bool SaveStream::NextTar(StreamFrame& out) {
+    std::array<std::uint8_t, kTarBlock> h{};
+    for (;;) {
+        const std::size_t have = Fill(kTarBlock);
+        if (have == 0) return false; // tolerate a missing end-of-archive marker
+        if (have < kTarBlock) Fail("tar: truncated header");
+        Read(h.data(), kTarBlock);
+        if (std::all_of(h.begin(), h.end(), [](std::uint8_t b) { return b == 0; })) return false;
+        if (!TarChecksumOk(h.data())) Fail("tar: bad header checksum");
+
+        std::uint64_t size = 0;
+        if (!TarNumber(h.data() + 124, 12, size)) Fail("tar: bad size field");
+        if (pendingSize_) size = *pendingSize_;
+        const char type = static_cast<char>(h[156]);
+
+        if (type == 'L' || type == 'x') {
+            if (size > MaxMemberSize) Fail("tar: extended header too large");
+            std::string rec(static_cast<std::size_t>(size), '\0');
+            if (Read(reinterpret_cast<std::uint8_t*>(rec.data()), rec.size()) < rec.size() || !Skip(TarPadding(size))) {
+                Fail("tar: stream ended inside extended header");
+            }
+            if (type == 'L') {
+                pendingName_.assign(rec.c_str());
+            } else {
+                ParsePax(rec, pendingName_, pendingSize_);
+            }
+            continue;
+        }
+
+        std::string member;
+        if (!pendingName_.empty()) {
+            member = std::move(pendingName_);
+        } else {
+            const std::string_view prefix = std::memcmp(h.data() + 257, "ustar", 5) == 0
+                                                ? TarString(h.data() + 345, 155)
+                                                : std::string_view();
+            if (!prefix.empty()) {
+                member.assign(prefix);
+                member += '/';
+            }
+            member += TarString(h.data(), 100);
+        }
+        pendingName_.clear();
+        pendingSize_.reset();
+
+        if (type != '0' && type != '\0' && type != '7') {
+            // Directories, links, devices, global PAX headers: nothing to scan.
+            if (!Skip(size + TarPadding(size))) return false;
+            continue;
+        }
+
+        out.name = label_ + ":" + member;
+        out.member = std::move(member);
+        ReadMember(out, size, "tar");
+        if (!finished_ && !Skip(TarPadding(size))) finished_ = true;
+        return true;
+    }
+}
+
+// ---------------------------------------------------------
+// Zip
+// ---------------------------------------------------------
+
+bool SaveStream::NextZip(StreamFrame& out) {
+    constexpr std::uint32_t kLocal = 0x04034b50;
+    constexpr std::uint32_t kDescriptor = 0x08074b50;
+    constexpr std::size_t kLocalSize = 30;
+
+    std::array<std::uint8_t, kLocalSize> h{};
+    std::vector<std::uint8_t> extra;
+    for (;;) {
+        if (Fill(4) < 4) return false;
+        const std::uint32_t sig = Le32(buf_.data() + pos_);
+        if (sig != kLocal) {
+            // Central directory / end records follow the last entry.
+            if (sig == 0x02014b50 || sig == 0x06054b50 || sig == 0x06064b50) return false;
+            Fail("zip: unexpected record signature");
+        }
+        if (Read(h.data(), kLocalSize) < kLocalSize) Fail("zip: truncated local header");
+
+        const std::uint16_t flags = Le16(h.data() + 6);
+        const std::uint16_t method = Le16(h.data() + 8);
+        const std::uint32_t crc = Le32(h.data() + 14);
+        std::uint64_t csize = Le32(h.data() + 18);
+        std::uint64_t usize = Le32(h.data() + 22);
+        const std::uint16_t nameLen = Le16(h.data() + 26);
+        const std::uint16_t extraLen = Le16(h.data() + 28);
+
+        std::string member(nameLen, '\0');
+        extra.resize(extraLen);
+        if (Read(reinterpret_cast<std::uint8_t*>(member.data()), nameLen) < nameLen ||
+            Read(extra.data(), extraLen) < extraLen) {
+            Fail("zip: truncated local header");
+        }
+
+        if (csize == 0xFFFFFFFFu || usize == 0xFFFFFFFFu) {
+            for (std::size_t i = 0; i + 4 <= extra.size();) {
+                const std::uint16_t id = Le16(extra.data() + i);
+                const std::uint16_t len = Le16(extra.data() + i + 2);
+                const std::uint8_t* field = extra.data() + i + 4;
+                if (i + 4 + len > extra.size()) break;
+                if (id == 0x0001) {
+                    std::size_t at = 0;
+                    if (usize == 0xFFFFFFFFu && at + 8 <= len) { usize = Le64(field + at); at += 8; }
+                    if (csize == 0xFFFFFFFFu && at + 8 <= len) { csize = Le64(field + at); }
+                    break;
+                }
+                i += 4 + len;
+            }
+        }
+
+        const bool hasDescriptor = (flags & 0x0008) != 0;
+        if (hasDescriptor && csize == 0) {
+            Fail("zip: member '" + member + "' records its size only after the data (streamed zip); not supported");
+        }
+
+        const bool isDirectory = !member.empty() && member.back() == '/';
+        if (isDirectory) {
+            if (!Skip(csize)) return false;
+        } else {
+            out.name = label_ + ":" + member;
+            out.member = member;
+            if (flags & 0x0001) {
+                out.error = "zip: member is encrypted";
+                if (!Skip(csize)) finished_ = true;
+            } else if (method != 0) {
+                out.error = "zip: member uses compression method " + std::to_string(method) +
+                            "; only stored (zip -0) members are supported";
+                if (!Skip(csize)) finished_ = true;
+            } else {
+                ReadMember(out, csize, "zip");
+                // With a data descriptor the header CRC is zero; the real one trails the data.
+                if (out.error.empty() && !hasDescriptor && Crc32(out.bytes.data(), out.bytes.size()) != crc) {
+                    out.error = "zip: CRC-32 mismatch";
+                    out.bytes.clear();
+                }
+            }
+        }
+
+        if (hasDescriptor && !finished_) {
+            const std::size_t have = Fill(4);
+            const bool tagged = have >= 4 && Le32(buf_.data() + pos_) == kDescriptor;
+            if (!Skip(tagged ? 16 : 12)) finished_ = true;
+        }
+        if (!isDirectory) return true;
+    }
+}
+
+} // namespace savegenie
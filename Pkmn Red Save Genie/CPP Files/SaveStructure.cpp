@@ -10,81 +10,169 @@
 
 #include "SaveStructure.hpp"
 
+#include "ChecksumKernels.hpp"
+#include "Instrumentation.hpp"
+
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 
 namespace savegenie {
 
 // =========================================================
-// SaveBuffer
+// SaveView
 // =========================================================
 
-SaveBuffer::SaveBuffer() : bytes_() {}
-
-SaveBuffer::SaveBuffer(Bytes bytes) : bytes_(std::move(bytes)) {}
-
-std::size_t SaveBuffer::Size() const { return bytes_.size(); }
-
-const SaveBuffer::Bytes& SaveBuffer::BytesView() const { return bytes_; }
-
-SaveBuffer::Bytes& SaveBuffer::BytesMutable() { return bytes_; }
-
-void SaveBuffer::RequireRange(std::size_t off, std::size_t len) const {
+// Shared by SaveView and SaveBuffer so both report identical errors.
+static void RequireRangeWithin(std::size_t size, std::size_t off, std::size_t len) {
     if (len == 0) return;
 
     // Protect against overflow in off + len
-    if (off > bytes_.size()) {
+    if (off > size) {
         throw std::out_of_range("SaveBuffer: offset out of range");
     }
     const std::size_t end = off + len;
-    if (end < off || end > bytes_.size()) {
+    if (end < off || end > size) {
         throw std::out_of_range("SaveBuffer: range out of range");
     }
 }
 
-u8 SaveBuffer::ReadU8(std::size_t off) const {
+void SaveView::RequireRange(std::size_t off, std::size_t len) const {
+    RequireRangeWithin(bytes_.size(), off, len);
+}
+
+u8 SaveView::ReadU8(std::size_t off) const {
     RequireRange(off, 1);
     return bytes_[off];
 }
 
-u16 SaveBuffer::ReadU16LE(std::size_t off) const {
+u16 SaveView::ReadU16LE(std::size_t off) const {
     RequireRange(off, 2);
     return static_cast<u16>(bytes_[off]) |
            static_cast<u16>(static_cast<u16>(bytes_[off + 1]) << 8);
 }
 
-u32 SaveBuffer::ReadU24BE(std::size_t off) const {
+u32 SaveView::ReadU24BE(std::size_t off) const {
     RequireRange(off, 3);
     return (static_cast<u32>(bytes_[off]) << 16) |
            (static_cast<u32>(bytes_[off + 1]) << 8) |
            (static_cast<u32>(bytes_[off + 2]));
 }
 
+bool SaveView::GetBit(std::size_t byteOff, u8 bitIndex0to7) const {
+    if (bitIndex0to7 >= 8) {
+        throw std::out_of_range("SaveBuffer: bitIndex must be 0..7");
+    }
+    RequireRange(byteOff, 1);
+    const u8 mask = static_cast<u8>(1u << bitIndex0to7);
+    return (bytes_[byteOff] & mask) != 0;
+}
+
+std::span<const u8> SaveView::Subspan(std::size_t off, std::size_t len) const {
+    RequireRange(off, len);
+    return bytes_.subspan(off, len);
+}
+
+// =========================================================
+// SaveBuffer
+// =========================================================
+
+SaveBuffer::SaveBuffer() : bytes_() {}
+
+SaveBuffer::SaveBuffer(Bytes bytes) : bytes_(std::move(bytes)) {}
+
+std::size_t SaveBuffer::Size() const { return bytes_.size(); }
+
+const SaveBuffer::Bytes& SaveBuffer::BytesView() const { return bytes_; }
+
+SaveBuffer::Bytes& SaveBuffer::BytesMutable() {
+    // Writes through the raw vector are invisible to NoteWrite.
+    sums_.InvalidateAll();
+    if (journal_ && !journal_->image) {
+        // Bytes already journaled have changed since BeginJournal(): put their
+        // recorded pre-images back so the copy is the state at Begin.
+        Bytes image = bytes_;
+        for (const Journal::Entry& e : journal_->entries) {
+            image[e.off] = e.before;
+        }
+        journal_->image = std::move(image);
+        journal_->entries.clear();
+        journal_->dirty.fill(true);
+    }
+    ++generation_;
+    return bytes_;
+}
+
+void SaveBuffer::RequireRange(std::size_t off, std::size_t len) const {
+    RequireRangeWithin(bytes_.size(), off, len);
+}
+
+// Reads share the SaveView implementation.
+u8 SaveBuffer::ReadU8(std::size_t off) const { return View().ReadU8(off); }
+
+u16 SaveBuffer::ReadU16LE(std::size_t off) const { return View().ReadU16LE(off); }
+
+u16 SaveBuffer::ReadU16BE(std::size_t off) const {
+    RequireRange(off, 2);
+    return static_cast<u16>((bytes_[off] << 8) | bytes_[off + 1]);
+}
+
+u32 SaveBuffer::ReadU24BE(std::size_t off) const { return View().ReadU24BE(off); }
+
 void SaveBuffer::WriteU8(std::size_t off, u8 v) {
     RequireRange(off, 1);
+    ++generation_;
+    NoteWrite(off, bytes_[off], v);
     bytes_[off] = v;
 }
 
 void SaveBuffer::WriteU16LE(std::size_t off, u16 v) {
     RequireRange(off, 2);
-    bytes_[off]     = static_cast<u8>(v & 0xFF);
-    bytes_[off + 1] = static_cast<u8>((v >> 8) & 0xFF);
+    ++generation_;
+    const u8 b0 = static_cast<u8>(v & 0xFF);
+    const u8 b1 = static_cast<u8>((v >> 8) & 0xFF);
+    NoteWrite(off, bytes_[off], b0);
+    NoteWrite(off + 1, bytes_[off + 1], b1);
+    bytes_[off]     = b0;
+    bytes_[off + 1] = b1;
+}
+
+void SaveBuffer::WriteU16BE(std::size_t off, u16 v) {
+    RequireRange(off, 2);
+    ++generation_;
+    const u8 b0 = static_cast<u8>((v >> 8) & 0xFF);
+    const u8 b1 = static_cast<u8>(v & 0xFF);
+    NoteWrite(off, bytes_[off], b0);
+    NoteWrite(off + 1, bytes_[off + 1], b1);
+    bytes_[off]     = b0;
+    bytes_[off + 1] = b1;
 }
 
 void SaveBuffer::WriteU24BE(std::size_t off, u32 v) {
     RequireRange(off, 3);
-    bytes_[off]     = static_cast<u8>((v >> 16) & 0xFF);
-    bytes_[off + 1] = static_cast<u8>((v >> 8) & 0xFF);
-    bytes_[off + 2] = static_cast<u8>(v & 0xFF);
+    ++generation_;
+    const u8 b0 = static_cast<u8>((v >> 16) & 0xFF);
+    const u8 b1 = static_cast<u8>((v >> 8) & 0xFF);
+    const u8 b2 = static_cast<u8>(v & 0xFF);
+    NoteWrite(off, bytes_[off], b0);
+    NoteWrite(off + 1, bytes_[off + 1], b1);
+    NoteWrite(off + 2, bytes_[off + 2], b2);
+    bytes_[off]     = b0;
+    bytes_[off + 1] = b1;
+    bytes_[off + 2] = b2;
 }
 
-bool SaveBuffer::GetBit(std::size_t byteOff, u8 bitIndex0to7) const {
-    if (bitIndex0to7 >= 8) {
-        throw std::out_of_range("SaveBuffer: bitIndex must be 0..7");
+void SaveBuffer::WriteBytes(std::size_t off, std::span<const u8> src) {
+    RequireRange(off, src.size());
+    ++generation_;
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        NoteWrite(off + i, bytes_[off + i], src[i]);
+        bytes_[off + i] = src[i];
     }
-    RequireRange(byteOff, 1);
-    const u8 mask = static_cast<u8>(1u << bitIndex0to7);
-    return (bytes_[byteOff] & mask) != 0;
+}
+
+bool SaveBuffer::GetBit(std::size_t byteOff, u8 bitIndex0to7) const {
+    return View().GetBit(byteOff, bitIndex0to7);
 }
 
 void SaveBuffer::SetBit(std::size_t byteOff, u8 bitIndex0to7, bool value) {
@@ -92,12 +180,77 @@ void SaveBuffer::SetBit(std::size_t byteOff, u8 bitIndex0to7, bool value) {
         throw std::out_of_range("SaveBuffer: bitIndex must be 0..7");
     }
     RequireRange(byteOff, 1);
+    ++generation_;
     const u8 mask = static_cast<u8>(1u << bitIndex0to7);
-    if (value) {
-        bytes_[byteOff] |= mask;
-    } else {
-        bytes_[byteOff] &= static_cast<u8>(~mask);
+    const u8 old = bytes_[byteOff];
+    const u8 next = value ? static_cast<u8>(old | mask) : static_cast<u8>(old & static_cast<u8>(~mask));
+    NoteWrite(byteOff, old, next);
+    bytes_[byteOff] = next;
+}
+
+void SaveBuffer::NoteWrite(std::size_t off, u8 oldValue, u8 newValue) {
+    if (oldValue == newValue) return;
+    const int d = ChecksumDomainSums::DomainOf(off);
+    if (journal_) journal_->Record(off, oldValue, d);
+    if (d < 0) return;
+    const std::size_t i = static_cast<std::size_t>(d);
+    if (!sums_.known[i]) return;
+    sums_.sum[i] = static_cast<u8>(sums_.sum[i] + static_cast<u8>(newValue - oldValue));
+}
+
+// ---- Undo journal ----
+
+void SaveBuffer::Journal::Record(std::size_t off, u8 before, int domain) {
+    if (image) return; // the full pre-image already covers every byte
+    const std::size_t word = off / 64;
+    const u64 bit = u64{1} << (off % 64);
+    if (word >= touched.size() || (touched[word] & bit)) return;
+    touched[word] |= bit;
+    entries.push_back(Entry{static_cast<u32>(off), before});
+    if (domain >= 0) dirty[static_cast<std::size_t>(domain)] = true;
+}
+
+void SaveBuffer::BeginJournal() {
+    if (journal_) {
+        throw std::logic_error("SaveBuffer: a journal is already open");
     }
+    journal_.emplace();
+    journal_->touched.assign((bytes_.size() + 63) / 64, 0);
+}
+
+void SaveBuffer::CommitJournal() {
+    if (!journal_) {
+        throw std::logic_error("SaveBuffer: no journal is open");
+    }
+    journal_.reset();
+}
+
+void SaveBuffer::RollbackJournal() {
+    if (!journal_) {
+        throw std::logic_error("SaveBuffer: no journal is open");
+    }
+    Journal j = std::move(*journal_);
+    journal_.reset();
+    ++generation_;
+
+    if (j.image) {
+        bytes_ = std::move(*j.image);
+        sums_.InvalidateAll();
+        return;
+    }
+    for (const Journal::Entry& e : j.entries) {
+        NoteWrite(e.off, bytes_[e.off], e.before);
+        bytes_[e.off] = e.before;
+    }
+}
+
+std::size_t SaveBuffer::JournalSize() const {
+    if (!journal_) return 0;
+    return journal_->image ? journal_->image->size() : journal_->entries.size();
+}
+
+std::array<bool, ChecksumDomainSums::DomainCount> SaveBuffer::JournalDirtyDomains() const {
+    return journal_ ? journal_->dirty : std::array<bool, ChecksumDomainSums::DomainCount>{};
 }
 
 SaveBuffer::Bytes SaveBuffer::Slice(std::size_t off, std::size_t len) const {
@@ -110,6 +263,18 @@ SaveBuffer::Bytes SaveBuffer::Slice(std::size_t off, std::size_t len) const {
 // Gen1Layout helpers
 // =========================================================
 
+// Box block internals tile the whole 0x462-byte block.
+static_assert(Gen1Layout::BoxMonDataRel + Gen1Layout::BoxMaxMons * Gen1Layout::BoxMonStructSize == Gen1Layout::BoxOTNamesRel);
+static_assert(Gen1Layout::BoxOTNamesRel + Gen1Layout::BoxMaxMons * Gen1Layout::NameFieldLen == Gen1Layout::BoxNicknamesRel);
+static_assert(Gen1Layout::BoxNicknamesRel + Gen1Layout::BoxMaxMons * Gen1Layout::NameFieldLen == Gen1Layout::BoxBlockSize);
+static_assert(Gen1Layout::MonPPRel + 4 == Gen1Layout::BoxMonStructSize);
+static_assert(Gen1Layout::PartyMonDataRel == 1 + Gen1Layout::PartyMaxMons + 1);
+static_assert(Gen1Layout::PartyMonDataRel + Gen1Layout::PartyMaxMons * Gen1Layout::PartyMonStructSize == Gen1Layout::PartyOTNamesRel);
+static_assert(Gen1Layout::PartyOTNamesRel + Gen1Layout::PartyMaxMons * Gen1Layout::NameFieldLen == Gen1Layout::PartyNicknamesRel);
+static_assert(Gen1Layout::PartyNicknamesRel + Gen1Layout::PartyMaxMons * Gen1Layout::NameFieldLen == Gen1Layout::PartyBlockSize);
+static_assert(Gen1Layout::MonMaxHpRel + 5 * 2 == Gen1Layout::PartyMonStructSize);
+static_assert(Gen1Layout::CurrentBoxDataOff + Gen1Layout::BoxBlockSize - 1 <= Gen1Layout::MainChecksumEnd);
+
 std::size_t Gen1Layout::BoxBaseOffsetByIndex1to12(int boxIndex1to12) {
     if (boxIndex1to12 < 1 || boxIndex1to12 > 12) {
         throw std::out_of_range("Gen1Layout: box index must be 1..12");
@@ -141,7 +306,7 @@ std::size_t Gen1Layout::BankPerBoxChecksumsBaseOffsetForBoxIndex1to12(int boxInd
 // =========================================================
 
 // Human-readable map names
-const std::string Gen1MapLookup::MapIDName[256] = {
+constexpr std::array<std::string_view, 256> Gen1MapLookup::MapIDName = {
     
           "Pallet Town",
           "Viridian City",
@@ -406,7 +571,7 @@ const int Gen1MapLookup::MapIDNo[256] = {
     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
 };
 
-const std::string Gen1MapLookup::MapIDHex[256] = {
+constexpr std::array<std::string_view, 256> Gen1MapLookup::MapIDHex = {
     "0x00", "0x01", "0x02", "0x03", "0x04", "0x05", "0x06", "0x07", "0x08", "0x09", "0x0A", "0x0B", "0x0C", "0x0D", "0x0E", "0x0F",
     "0x10", "0x11", "0x12", "0x13", "0x14", "0x15", "0x16", "0x17", "0x18", "0x19", "0x1A", "0x1B", "0x1C", "0x1D", "0x1E", "0x1F",
     "0x20", "0x21", "0x22", "0x23", "0x24", "0x25", "0x26", "0x27", "0x28", "0x29", "0x2A", "0x2B", "0x2C", "0x2D", "0x2E", "0x2F",
@@ -425,19 +590,19 @@ const std::string Gen1MapLookup::MapIDHex[256] = {
     "0xF0", "0xF1", "0xF2", "0xF3", "0xF4", "0xF5", "0xF6", "0xF7", "0xF8", "0xF9", "0xFA", "0xFB", "0xFC", "0xFD", "0xFE", "0xFF",
 };
 
-std::string Gen1MapLookup::NameFromId(u8 mapId) {
-    const std::size_t idx = static_cast<std::size_t>(mapId);
-    // idx is always 0..255 for u8, but keep the check for safety.
-    if (idx >= 256) return "INVALID";
+std::string_view Gen1MapLookup::NameViewFromId(u8 mapId) {
+    const std::string_view n = MapIDName[static_cast<std::size_t>(mapId)];
+    return n.empty() ? std::string_view("INVALID") : n;
+}
 
-    const std::string& n = MapIDName[idx];
-    return n.empty() ? std::string("INVALID") : n;
+std::string Gen1MapLookup::NameFromId(u8 mapId) {
+    return std::string(NameViewFromId(mapId));
 }
 
 // =========================================================
 // Gen1SpeciesLookup
 // =========================================================
-const std::string Gen1SpeciesLookup::SpeciesName[256] = {
+constexpr std::array<std::string_view, 256> Gen1SpeciesLookup::SpeciesName = {
     /*0x00*/ "INVALID",
     /*0x01*/ "RHYDON",
     /*0x02*/ "KANGASKHAN",
@@ -688,7 +853,7 @@ const int Gen1SpeciesLookup::PokeDex[256] = {
     /*248 */ -1, /*249 */ -1, /*250 */ -1, /*251 */ -1, /*252 */ -1, /*253 */ -1, /*254 */ -1, /*255 */ -1
 };
 
-const std::string Gen1SpeciesLookup::SpeciesHex[256]= {
+constexpr std::array<std::string_view, 256> Gen1SpeciesLookup::SpeciesHex = {
         "0x00","0x01","0x02","0x03","0x04","0x05","0x06","0x07","0x08","0x09","0x0a","0x0b","0x0c","0x0d","0x0e","0x0f",
         "0x10","0x11","0x12","0x13","0x14","0x15","0x16","0x17","0x18","0x19","0x1a","0x1b","0x1c","0x1d","0x1e","0x1f",
         "0x20","0x21","0x22","0x23","0x24","0x25","0x26","0x27","0x28","0x29","0x2a","0x2b","0x2c","0x2d","0x2e","0x2f",
@@ -707,12 +872,13 @@ const std::string Gen1SpeciesLookup::SpeciesHex[256]= {
         "0xf0","0xf1","0xf2","0xf3","0xf4","0xf5","0xf6","0xf7","0xf8","0xf9","0xfa","0xfb","0xfc","0xfd","0xfe","0xff"
     };
 
+std::string_view Gen1SpeciesLookup::NameViewFromId(u8 speciesId) {
+    const std::string_view n = SpeciesName[static_cast<std::size_t>(speciesId)];
+    return n.empty() ? std::string_view("INVALID") : n;
+}
+
 std::string Gen1SpeciesLookup::NameFromId(u8 speciesId) {
-    const std::size_t idx = static_cast<std::size_t>(speciesId);
-    if (idx >= 256) return "INVALID";
-    const std::string& n = SpeciesName[idx];
-    if (n.empty()) return "INVALID";
-    return n;
+    return std::string(NameViewFromId(speciesId));
 }
 
 
@@ -723,7 +889,7 @@ std::string Gen1SpeciesLookup::NameFromId(u8 speciesId) {
 // Item names by Gen I item index (0x00..0xFF).
 // Source: Bulbapedia "List of items by index number in Generation I".
 // Unused/unknown/glitch entries are normalized to "INVALID".
-const std::string Gen1ItemLookup::ItemName[256] = {
+constexpr std::array<std::string_view, 256> Gen1ItemLookup::ItemName = {
     /*0x00*/ "INVALID",
     /*0x01*/ "MASTER BALL",
     /*0x02*/ "ULTRA BALL",
@@ -1005,7 +1171,7 @@ const int Gen1ItemLookup::ItemNo[256] = {
     240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
 };
 
-const std::string Gen1ItemLookup::ItemHex[256] = {
+constexpr std::array<std::string_view, 256> Gen1ItemLookup::ItemHex = {
     "0x00", "0x01", "0x02", "0x03", "0x04", "0x05", "0x06", "0x07", "0x08", "0x09", "0x0A", "0x0B", "0x0C", "0x0D", "0x0E", "0x0F",
     "0x10", "0x11", "0x12", "0x13", "0x14", "0x15", "0x16", "0x17", "0x18", "0x19", "0x1A", "0x1B", "0x1C", "0x1D", "0x1E", "0x1F",
     "0x20", "0x21", "0x22", "0x23", "0x24", "0x25", "0x26", "0x27", "0x28", "0x29", "0x2A", "0x2B", "0x2C", "0x2D", "0x2E", "0x2F",
@@ -1024,12 +1190,13 @@ const std::string Gen1ItemLookup::ItemHex[256] = {
     "0xF0", "0xF1", "0xF2", "0xF3", "0xF4", "0xF5", "0xF6", "0xF7", "0xF8", "0xF9", "0xFA", "0xFB", "0xFC", "0xFD", "0xFE", "0xFF",
 };
 
-std::string Gen1ItemLookup::NameFromId(u8 itemId) {
-    const std::size_t idx = static_cast<std::size_t>(itemId);
-    if (idx >= 256) return "INVALID";
+std::string_view Gen1ItemLookup::NameViewFromId(u8 itemId) {
+    const std::string_view n = ItemName[static_cast<std::size_t>(itemId)];
+    return n.empty() ? std::string_view("INVALID") : n;
+}
 
-    const std::string& n = ItemName[idx];
-    return n.empty() ? std::string("INVALID") : n;
+std::string Gen1ItemLookup::NameFromId(u8 itemId) {
+    return std::string(NameViewFromId(itemId));
 }
 
 
@@ -1037,59 +1204,208 @@ std::string Gen1ItemLookup::NameFromId(u8 itemId) {
 // Gen1TextCodec
 // =========================================================
 
+// Gen I (English) charset. Unlisted bytes are control codes / unused tiles.
+static constexpr std::array<std::string_view, 256> makeGen1Glyphs() {
+    std::array<std::string_view, 256> g{};
+
+    constexpr std::string_view upper[26] = {"A","B","C","D","E","F","G","H","I","J","K","L","M",
+                                            "N","O","P","Q","R","S","T","U","V","W","X","Y","Z"};
+    constexpr std::string_view lower[26] = {"a","b","c","d","e","f","g","h","i","j","k","l","m",
+                                            "n","o","p","q","r","s","t","u","v","w","x","y","z"};
+    constexpr std::string_view digits[10] = {"0","1","2","3","4","5","6","7","8","9"};
+
+    for (int i = 0; i < 26; ++i) {
+        g[static_cast<std::size_t>(0x80 + i)] = upper[i];
+        g[static_cast<std::size_t>(0xA0 + i)] = lower[i];
+    }
+    for (int i = 0; i < 10; ++i) {
+        g[static_cast<std::size_t>(0xF6 + i)] = digits[i];
+    }
+
+    // Quotes and box-drawing (0x70..0x7F)
+    g[0x70] = "‘"; g[0x71] = "’"; g[0x72] = "“"; g[0x73] = "”";
+    g[0x74] = "・"; g[0x75] = "…";
+    g[0x79] = "┌"; g[0x7A] = "─"; g[0x7B] = "┐"; g[0x7C] = "│"; g[0x7D] = "└"; g[0x7E] = "┘";
+    g[0x7F] = " ";
+
+    // Punctuation after the alphabets
+    g[0x9A] = "("; g[0x9B] = ")"; g[0x9C] = ":"; g[0x9D] = ";"; g[0x9E] = "["; g[0x9F] = "]";
+    g[0xBA] = "é"; g[0xBB] = "'d"; g[0xBC] = "'l"; g[0xBD] = "'s"; g[0xBE] = "'t"; g[0xBF] = "'v";
+
+    // Symbols (0xE0..0xF5)
+    g[0xE0] = "'"; g[0xE1] = "PK"; g[0xE2] = "MN"; g[0xE3] = "-";
+    g[0xE4] = "'r"; g[0xE5] = "'m"; g[0xE6] = "?"; g[0xE7] = "!"; g[0xE8] = ".";
+    g[0xEC] = "▷"; g[0xED] = "▶"; g[0xEE] = "▼"; g[0xEF] = "♂";
+    g[0xF0] = "¥"; g[0xF1] = "×"; g[0xF2] = "."; g[0xF3] = "/"; g[0xF4] = ","; g[0xF5] = "♀";
+
+    return g;
+}
+
+static constexpr std::array<std::string_view, 256> kGen1Glyphs = makeGen1Glyphs();
+
+// ASCII -> Gen I byte for single-character glyphs (0 = not encodable).
+// Lowest byte wins, so '.' maps to 0xE8 (period) rather than 0xF2 (decimal point).
+static constexpr std::array<u8, 128> makeAsciiToGen1() {
+    std::array<u8, 128> t{};
+    for (std::size_t b = 0; b < 256; ++b) {
+        const std::string_view& gl = kGen1Glyphs[b]; // by reference: GCC 12 rejects the copy here
+        if (gl.size() != 1) continue;
+        const auto c = static_cast<unsigned char>(gl[0]);
+        if (c < 128 && t[c] == 0) t[c] = static_cast<u8>(b);
+    }
+    return t;
+}
+
+static constexpr std::array<u8, 128> kAsciiToGen1 = makeAsciiToGen1();
+
+static_assert(kAsciiToGen1['A'] == 0x80 && kAsciiToGen1['a'] == 0xA0 && kAsciiToGen1['0'] == 0xF6);
+static_assert(kAsciiToGen1[' '] == 0x7F && kAsciiToGen1['.'] == 0xE8);
+
+static constexpr std::string_view kUnknownGlyph = "?";
+
+std::string_view Gen1TextCodec::Glyph(u8 byte) {
+    if (byte == Terminator) return std::string_view();
+    const std::string_view gl = kGen1Glyphs[byte];
+    return gl.empty() ? kUnknownGlyph : gl;
+}
+
 char Gen1TextCodec::ByteToAscii(u8 byte) {
-    // Minimal charset for MVP (names): A-Z, 0-9, space, terminator.
-    if (byte >= 0x80 && byte <= 0x99) return static_cast<char>('A' + (byte - 0x80));
-    if (byte >= 0xA0 && byte <= 0xA9) return static_cast<char>('0' + (byte - 0xA0));
-    if (byte == 0x7F) return ' ';
-    if (byte == 0x50) return '\0';
+    if (byte == Terminator) return '\0';
+    const std::string_view gl = Glyph(byte);
+    if (gl.size() == 1 && static_cast<unsigned char>(gl[0]) < 128) return gl[0];
     return '?';
 }
 
 u8 Gen1TextCodec::AsciiToByte(char c) {
-    // Normalize lowercase to uppercase.
-    if (c >= 'a' && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+    const auto uc = static_cast<unsigned char>(c);
+    const u8 b = (uc < 128) ? kAsciiToGen1[uc] : 0;
+
+    // Fallback to space for characters outside the charset.
+    return b != 0 ? b : 0x7F;
+}
 
-    if (c >= 'A' && c <= 'Z') return static_cast<u8>(0x80 + (c - 'A'));
-    if (c >= '0' && c <= '9') return static_cast<u8>(0xA0 + (c - '0'));
-    if (c == ' ') return 0x7F;
+// Encode the glyph at the front of `text`; sets `consumed` to the bytes used.
+static u8 encodeGlyph(std::string_view text, std::size_t& consumed) {
+    const auto lead = static_cast<unsigned char>(text[0]);
+    if (lead < 128) {
+        consumed = 1;
+        return Gen1TextCodec::AsciiToByte(static_cast<char>(lead));
+    }
+
+    // Non-ASCII: longest multi-byte glyph that prefixes the input.
+    std::size_t best = 0;
+    u8 bestByte = 0x7F;
+    for (std::size_t b = 0; b < 256; ++b) {
+        const std::string_view gl = kGen1Glyphs[b];
+        if (gl.size() > best && static_cast<unsigned char>(gl[0]) >= 128 && text.substr(0, gl.size()) == gl) {
+            best = gl.size();
+            bestByte = static_cast<u8>(b);
+        }
+    }
+    if (best != 0) {
+        consumed = best;
+        return bestByte;
+    }
 
-    // Fallback to space for unsupported characters in MVP.
+    // Unknown UTF-8 sequence: skip it whole, write a space.
+    std::size_t n = 1;
+    while (n < text.size() && (static_cast<unsigned char>(text[n]) & 0xC0) == 0x80) ++n;
+    consumed = n;
     return 0x7F;
 }
 
-std::string Gen1TextCodec::DecodeName(const SaveBuffer& sb, std::size_t off, std::size_t len) {
-    const auto bytes = sb.Slice(off, len);
+std::string Gen1TextCodec::DecodeName(SaveView sv, std::size_t off, std::size_t len) {
+    const auto bytes = sv.Subspan(off, len);
 
     std::string out;
     out.reserve(len);
 
     for (u8 b : bytes) {
-        const char c = ByteToAscii(b);
-        if (c == '\0') break;
-        out.push_back(c);
+        if (b == Terminator) break;
+        out.append(Glyph(b));
     }
 
+    SAVEGENIE_COUNT(StringsBuilt, 1);
     return out;
 }
 
-void Gen1TextCodec::EncodeName(SaveBuffer& sb, std::size_t off, std::size_t len, std::string_view name) {
-    if (len == 0) return;
+std::size_t Gen1TextCodec::DecodeNameInto(SaveView sv, std::size_t off, std::size_t len, std::span<char> out) {
+    const auto bytes = sv.Subspan(off, len);
 
-    // Fill with terminators (0x50).
-    std::vector<u8> out(len, 0x50);
+    std::size_t n = 0;
+    for (u8 b : bytes) {
+        if (b == Terminator) break;
+        const std::string_view gl = Glyph(b);
+        if (gl.size() > out.size() - n) break;
+        std::copy(gl.begin(), gl.end(), out.begin() + static_cast<std::ptrdiff_t>(n));
+        n += gl.size();
+    }
+    return n;
+}
 
-    const std::size_t n = std::min(name.size(), len - 1);
-    for (std::size_t i = 0; i < n; ++i) {
-        out[i] = AsciiToByte(name[i]);
+Gen1Name Gen1TextCodec::DecodeNameInline(SaveView sv, std::size_t off, std::size_t len) {
+    Gen1Name name;
+    name.size_ = static_cast<u8>(DecodeNameInto(sv, off, len, name.chars_));
+    return name;
+}
+
+void Gen1TextCodec::DecodeNames(SaveView sv, std::span<const Gen1NameField> fields, std::span<Gen1Name> out) {
+    if (fields.size() != out.size()) {
+        throw std::invalid_argument("DecodeNames: fields and out must have the same size");
+    }
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        Gen1Name& name = out[i];
+        name.size_ = static_cast<u8>(DecodeNameInto(sv, fields[i].off, fields[i].len, name.chars_));
     }
+}
 
-    out[n] = 0x50;
+void Gen1TextCodec::AppendNameFields(SaveView sv, std::vector<Gen1NameField>& out) {
+    out.push_back({Gen1Layout::TrainerNameOff, Gen1Layout::TrainerNameLen});
+    out.push_back({Gen1Layout::RivalNameOff, Gen1Layout::RivalNameLen});
+
+    // Hall of Fame: records up to the Bank 1 count hint, until an empty slot.
+    const int records = std::clamp(static_cast<int>(sv.ReadU8(Gen1Layout::HallOfFameRecordCountOff)),
+                                   0, Gen1Layout::HallOfFameMaxRecords);
+    for (int r = 0; r < records; ++r) {
+        const std::size_t recordOff = Gen1Layout::HallOfFameOff
+            + static_cast<std::size_t>(r) * Gen1Layout::HallOfFameRecordSize;
+        for (int m = 0; m < Gen1Layout::HallOfFameMonsPerRecord; ++m) {
+            const std::size_t monOff = recordOff + static_cast<std::size_t>(m) * Gen1Layout::HallOfFameMonEntrySize;
+            const u8 species = sv.ReadU8(monOff);
+            if (species == 0x00 || species == 0xFF) break;
+            out.push_back({monOff + Gen1Layout::HallOfFameMonNameRel, Gen1Layout::HallOfFameMonNameLen});
+        }
+    }
+
+    // PC boxes: OT name + nickname per occupied slot.
+    for (int box = 1; box <= 12; ++box) {
+        const std::size_t base = Gen1Layout::BoxBaseOffsetByIndex1to12(box);
+        const int count = std::min(static_cast<int>(sv.ReadU8(base)), Gen1Layout::BoxMaxMons);
+        for (int i = 0; i < count; ++i) {
+            const std::size_t slot = static_cast<std::size_t>(i) * Gen1Layout::NameFieldLen;
+            out.push_back({base + Gen1Layout::BoxOTNamesRel + slot, Gen1Layout::NameFieldLen});
+            out.push_back({base + Gen1Layout::BoxNicknamesRel + slot, Gen1Layout::NameFieldLen});
+        }
+    }
+}
 
-    // Write into the buffer.
+void Gen1TextCodec::EncodeName(SaveBuffer& sb, std::size_t off, std::size_t len, std::string_view name) {
+    if (len == 0) return;
     sb.RequireRange(off, len);
-    auto& bytes = sb.BytesMutable();
-    std::copy(out.begin(), out.end(), bytes.begin() + static_cast<std::ptrdiff_t>(off));
+
+    // Encode up to len - 1 glyphs, then terminate and pad with 0x50.
+    // Written byte by byte (tracked, so incremental checksums stay current).
+    std::size_t pos = 0;
+    std::size_t i = 0;
+    while (i < name.size() && pos < len - 1) {
+        std::size_t consumed = 1;
+        sb.WriteU8(off + pos, encodeGlyph(name.substr(i), consumed));
+        i += consumed;
+        ++pos;
+    }
+    for (; pos < len; ++pos) {
+        sb.WriteU8(off + pos, Terminator);
+    }
 }
 
 // =========================================================
@@ -1100,10 +1416,14 @@ static u32 bcdDigit(u8 nibble) {
     return (nibble <= 9) ? static_cast<u32>(nibble) : 0u;
 }
 
-u32 BcdCodec::ReadBcd3(const SaveBuffer& sb, std::size_t off) {
-    const u8 b0 = sb.ReadU8(off);
-    const u8 b1 = sb.ReadU8(off + 1);
-    const u8 b2 = sb.ReadU8(off + 2);
+u32 BcdCodec::ReadBcd3(SaveView sv, std::size_t off) {
+    return DecodeBcd3(sv.Subspan(off, 3).first<3>());
+}
+
+u32 BcdCodec::DecodeBcd3(std::span<const u8, 3> bytes) {
+    const u8 b0 = bytes[0];
+    const u8 b1 = bytes[1];
+    const u8 b2 = bytes[2];
 
     const u32 d0 = bcdDigit((b0 >> 4) & 0xF);
     const u32 d1 = bcdDigit(b0 & 0xF);
@@ -1136,9 +1456,13 @@ void BcdCodec::WriteBcd3(SaveBuffer& sb, std::size_t off, u32 value) {
     sb.WriteU8(off + 2, b2);
 }
 
-u16 BcdCodec::ReadBcd2(const SaveBuffer& sb, std::size_t off) {
-    const u8 b0 = sb.ReadU8(off);
-    const u8 b1 = sb.ReadU8(off + 1);
+u16 BcdCodec::ReadBcd2(SaveView sv, std::size_t off) {
+    return DecodeBcd2(sv.Subspan(off, 2).first<2>());
+}
+
+u16 BcdCodec::DecodeBcd2(std::span<const u8, 2> bytes) {
+    const u8 b0 = bytes[0];
+    const u8 b1 = bytes[1];
 
     const u32 d0 = bcdDigit((b0 >> 4) & 0xF);
     const u32 d1 = bcdDigit(b0 & 0xF);
@@ -1171,36 +1495,74 @@ void BcdCodec::WriteBcd2(SaveBuffer& sb, std::size_t off, u16 value) {
 // Gen1Checksum
 // =========================================================
 
-static u8 sumAndInvert8(const SaveBuffer& sb, std::size_t startInclusive, std::size_t endInclusive) {
+static u8 sumAndInvert8(SaveView sv, std::size_t startInclusive, std::size_t endInclusive) {
+    SAVEGENIE_STAGE(Checksum);
     if (endInclusive < startInclusive) {
         throw std::invalid_argument("Checksum: end < start");
     }
 
-    u32 sum = 0;
-    for (std::size_t i = startInclusive; i <= endInclusive; ++i) {
-        sum += sb.ReadU8(i);
-    }
+    // Range-check once, then sum the raw span (SIMD where available).
+    const u32 sum = ChecksumKernels::Sum(sv.Subspan(startInclusive, endInclusive - startInclusive + 1));
 
     const u8 low = static_cast<u8>(sum & 0xFF);
     return static_cast<u8>(~low);
 }
 
-u8 Gen1Checksum::ComputeMain(const SaveBuffer& sb) {
+u8 Gen1Checksum::ComputeMain(SaveView sv) {
     // Bulbapedia: sum bytes 0x2598..0x3522 inclusive; stored at 0x3523.
-    return sumAndInvert8(sb, Gen1Layout::MainChecksumStart, Gen1Layout::MainChecksumEnd);
+    return sumAndInvert8(sv, Gen1Layout::MainChecksumStart, Gen1Layout::MainChecksumEnd);
 }
 
-bool Gen1Checksum::ValidateMain(const SaveBuffer& sb) {
-    const u8 expected = ComputeMain(sb);
-    const u8 stored = sb.ReadU8(Gen1Layout::MainChecksumOff);
+bool Gen1Checksum::ValidateMain(SaveView sv) {
+    const u8 expected = ComputeMain(sv);
+    const u8 stored = sv.ReadU8(Gen1Layout::MainChecksumOff);
     return expected == stored;
 }
 
+// ---- Incremental fix support ----
+
+#if defined(DEBUG)
+static std::atomic<bool> g_incrementalCrossCheck{true};
+#else
+static std::atomic<bool> g_incrementalCrossCheck{false};
+#endif
+
+void Gen1Checksum::SetIncrementalCrossCheck(bool enabled) {
+    g_incrementalCrossCheck.store(enabled, std::memory_order_relaxed);
+}
+
+bool Gen1Checksum::IncrementalCrossCheck() {
+    return g_incrementalCrossCheck.load(std::memory_order_relaxed);
+}
+
+// Raw (non-inverted) 8-bit sum of one domain, seeding it on first use.
+static u8 domainSum(SaveBuffer& sb, ChecksumDomainSums& sums, int domain) {
+    const std::size_t d = static_cast<std::size_t>(domain);
+
+    auto fullSum = [&]() -> u8 {
+        // The Compute* helpers return ~sum; invert back to the raw sum.
+        if (domain == ChecksumDomainSums::MainDomain) {
+            return static_cast<u8>(~Gen1Checksum::ComputeMain(sb));
+        }
+        return static_cast<u8>(~Gen1Checksum::ComputeBox(sb, domain));
+    };
+
+    if (!sums.known[d]) {
+        sums.sum[d] = fullSum();
+        sums.known[d] = true;
+    } else if (Gen1Checksum::IncrementalCrossCheck() && sums.sum[d] != fullSum()) {
+        throw std::logic_error("Gen1Checksum: incremental sum diverged from full recompute");
+    }
+
+    return sums.sum[d];
+}
+
 void Gen1Checksum::FixMain(SaveBuffer& sb) {
-    sb.WriteU8(Gen1Layout::MainChecksumOff, ComputeMain(sb));
+    const u8 sum = domainSum(sb, sb.sums_, ChecksumDomainSums::MainDomain);
+    sb.WriteU8(Gen1Layout::MainChecksumOff, static_cast<u8>(~sum));
 }
 
-u8 Gen1Checksum::ComputeBankAll(const SaveBuffer& sb, int bankIndex2or3) {
+u8 Gen1Checksum::ComputeBankAll(SaveView sv, int bankIndex2or3) {
     if (bankIndex2or3 != 2 && bankIndex2or3 != 3) {
         throw std::invalid_argument("ComputeBankAll: bank index must be 2 or 3");
     }
@@ -1209,33 +1571,43 @@ u8 Gen1Checksum::ComputeBankAll(const SaveBuffer& sb, int bankIndex2or3) {
     const std::size_t checksumOff = (bankIndex2or3 == 2) ? Gen1Layout::Bank2AllChecksumOff : Gen1Layout::Bank3AllChecksumOff;
 
     // Boxes occupy start .. checksumOff-1
-    return sumAndInvert8(sb, start, checksumOff - 1);
+    return sumAndInvert8(sv, start, checksumOff - 1);
 }
 
-bool Gen1Checksum::ValidateBankAll(const SaveBuffer& sb, int bankIndex2or3) {
+bool Gen1Checksum::ValidateBankAll(SaveView sv, int bankIndex2or3) {
     const std::size_t checksumOff = (bankIndex2or3 == 2) ? Gen1Layout::Bank2AllChecksumOff : Gen1Layout::Bank3AllChecksumOff;
-    const u8 stored = sb.ReadU8(checksumOff);
-    const u8 expected = ComputeBankAll(sb, bankIndex2or3);
+    const u8 stored = sv.ReadU8(checksumOff);
+    const u8 expected = ComputeBankAll(sv, bankIndex2or3);
     return stored == expected;
 }
 
 void Gen1Checksum::FixBankAll(SaveBuffer& sb, int bankIndex2or3) {
+    if (bankIndex2or3 != 2 && bankIndex2or3 != 3) {
+        throw std::invalid_argument("FixBankAll: bank index must be 2 or 3");
+    }
     const std::size_t checksumOff = (bankIndex2or3 == 2) ? Gen1Layout::Bank2AllChecksumOff : Gen1Layout::Bank3AllChecksumOff;
-    sb.WriteU8(checksumOff, ComputeBankAll(sb, bankIndex2or3));
+
+    // The bank-all range is exactly its six boxes (see ScanAll).
+    const int firstBox = (bankIndex2or3 == 2) ? 1 : 7;
+    u8 sum = 0;
+    for (int box = firstBox; box < firstBox + 6; ++box) {
+        sum = static_cast<u8>(sum + domainSum(sb, sb.sums_, box));
+    }
+    sb.WriteU8(checksumOff, static_cast<u8>(~sum));
 }
 
-u8 Gen1Checksum::ComputeBox(const SaveBuffer& sb, int boxIndex1to12) {
+u8 Gen1Checksum::ComputeBox(SaveView sv, int boxIndex1to12) {
     const std::size_t start = Gen1Layout::BoxBaseOffsetByIndex1to12(boxIndex1to12);
     const std::size_t end = start + Gen1Layout::BoxBlockSize - 1;
-    return sumAndInvert8(sb, start, end);
+    return sumAndInvert8(sv, start, end);
 }
 
-bool Gen1Checksum::ValidateBox(const SaveBuffer& sb, int boxIndex1to12) {
+bool Gen1Checksum::ValidateBox(SaveView sv, int boxIndex1to12) {
     const std::size_t tableBase = Gen1Layout::BankPerBoxChecksumsBaseOffsetForBoxIndex1to12(boxIndex1to12);
     const int withinBank = (boxIndex1to12 <= 6) ? (boxIndex1to12 - 1) : (boxIndex1to12 - 7);
 
-    const u8 stored = sb.ReadU8(tableBase + static_cast<std::size_t>(withinBank));
-    const u8 expected = ComputeBox(sb, boxIndex1to12);
+    const u8 stored = sv.ReadU8(tableBase + static_cast<std::size_t>(withinBank));
+    const u8 expected = ComputeBox(sv, boxIndex1to12);
     return stored == expected;
 }
 
@@ -1243,30 +1615,199 @@ void Gen1Checksum::FixBox(SaveBuffer& sb, int boxIndex1to12) {
     const std::size_t tableBase = Gen1Layout::BankPerBoxChecksumsBaseOffsetForBoxIndex1to12(boxIndex1to12);
     const int withinBank = (boxIndex1to12 <= 6) ? (boxIndex1to12 - 1) : (boxIndex1to12 - 7);
 
-    sb.WriteU8(tableBase + static_cast<std::size_t>(withinBank), ComputeBox(sb, boxIndex1to12));
+    const u8 sum = domainSum(sb, sb.sums_, boxIndex1to12);
+    sb.WriteU8(tableBase + static_cast<std::size_t>(withinBank), static_cast<u8>(~sum));
+}
+
+// The bank-all range (bank base .. bank-all checksum - 1) is exactly the six box
+// blocks laid end to end, which is what lets ScanAll derive it from box sums.
+static_assert(Gen1Layout::Box1Off == Gen1Layout::Bank2Base &&
+              Gen1Layout::Bank2Base + 6 * Gen1Layout::BoxBlockSize == Gen1Layout::Bank2AllChecksumOff,
+              "Bank 2 boxes must tile the bank-all checksum range");
+static_assert(Gen1Layout::Box7Off == Gen1Layout::Bank3Base &&
+              Gen1Layout::Bank3Base + 6 * Gen1Layout::BoxBlockSize == Gen1Layout::Bank3AllChecksumOff,
+              "Bank 3 boxes must tile the bank-all checksum range");
+
+IntegrityReport Gen1Checksum::ScanAll(SaveView sv) {
+    SAVEGENIE_STAGE(Checksum);
+    IntegrityReport r;
+
+    // One range check covering everything we touch (through the bank 3 per-box table).
+    sv.RequireRange(0, Gen1Layout::Bank3BoxChecksumsOff + 6);
+    const std::span<const u8> bytes = sv.Span();
+
+    // Bank 1: main checksum.
+    const u32 mainSum = ChecksumKernels::Sum(bytes.subspan(
+        Gen1Layout::MainChecksumStart, Gen1Layout::MainChecksumEnd - Gen1Layout::MainChecksumStart + 1));
+    r.mainComputed = static_cast<u8>(~static_cast<u8>(mainSum & 0xFF));
+    r.mainStored = bytes[Gen1Layout::MainChecksumOff];
+
+    // Banks 2 and 3: sum each box once, fold box sums into the bank-all sum.
+    for (int bank = 0; bank < 2; ++bank) {
+        const std::size_t bankBase = (bank == 0) ? Gen1Layout::Bank2Base : Gen1Layout::Bank3Base;
+        const std::size_t allOff = (bank == 0) ? Gen1Layout::Bank2AllChecksumOff : Gen1Layout::Bank3AllChecksumOff;
+        const std::size_t tableOff = (bank == 0) ? Gen1Layout::Bank2BoxChecksumsOff : Gen1Layout::Bank3BoxChecksumsOff;
+
+        u32 bankSum = 0;
+        for (int k = 0; k < 6; ++k) {
+            const std::size_t boxOff = bankBase + static_cast<std::size_t>(k) * Gen1Layout::BoxBlockSize;
+            const u32 boxSum = ChecksumKernels::Sum(bytes.subspan(boxOff, Gen1Layout::BoxBlockSize));
+            bankSum += boxSum;
+
+            const std::size_t idx = static_cast<std::size_t>(bank * 6 + k);
+            r.boxComputed[idx] = static_cast<u8>(~static_cast<u8>(boxSum & 0xFF));
+            r.boxStored[idx] = bytes[tableOff + static_cast<std::size_t>(k)];
+        }
+
+        r.bankAllComputed[static_cast<std::size_t>(bank)] = static_cast<u8>(~static_cast<u8>(bankSum & 0xFF));
+        r.bankAllStored[static_cast<std::size_t>(bank)] = bytes[allOff];
+    }
+
+    return r;
+}
+
+// =========================================================
+// IntegrityReport
+// =========================================================
+
+bool IntegrityReport::BankAllValid(int bankIndex2or3) const {
+    if (bankIndex2or3 != 2 && bankIndex2or3 != 3) {
+        throw std::invalid_argument("IntegrityReport: bank index must be 2 or 3");
+    }
+    const std::size_t i = static_cast<std::size_t>(bankIndex2or3 - 2);
+    return bankAllStored[i] == bankAllComputed[i];
+}
+
+bool IntegrityReport::BoxValid(int boxIndex1to12) const {
+    if (boxIndex1to12 < 1 || boxIndex1to12 > 12) {
+        throw std::out_of_range("IntegrityReport: box index must be 1..12");
+    }
+    const std::size_t i = static_cast<std::size_t>(boxIndex1to12 - 1);
+    return boxStored[i] == boxComputed[i];
+}
+
+int IntegrityReport::ValidBoxCount() const {
+    int n = 0;
+    for (std::size_t i = 0; i < boxStored.size(); ++i) {
+        if (boxStored[i] == boxComputed[i]) n++;
+    }
+    return n;
+}
+
+bool IntegrityReport::AllValid() const {
+    return MainValid() && BankAllValid(2) && BankAllValid(3) && ValidBoxCount() == 12;
+}
+
+// =========================================================
+// Gen1Bitset
+// =========================================================
+
+Gen1Bitset::Gen1Bitset(std::span<const u8> bytes, std::size_t bitCount)
+    : bytes_(bytes), bitCount_(bitCount) {
+    if (bitCount > bytes.size() * 8) {
+        throw std::invalid_argument("Gen1Bitset: bitCount exceeds the byte range");
+    }
+}
+
+Gen1Bitset Gen1Bitset::FromSave(SaveView sv, std::size_t off, std::size_t len, std::size_t bitCount) {
+    return Gen1Bitset(sv.Subspan(off, len), bitCount);
+}
+
+Gen1Bitset Gen1Bitset::PokedexOwned(SaveView sv) {
+    return FromSave(sv, Gen1Layout::PokedexOwnedOff, Gen1Layout::PokedexBitsLen, Gen1Layout::PokedexSpeciesCount);
+}
+
+Gen1Bitset Gen1Bitset::PokedexSeen(SaveView sv) {
+    return FromSave(sv, Gen1Layout::PokedexSeenOff, Gen1Layout::PokedexBitsLen, Gen1Layout::PokedexSpeciesCount);
+}
+
+Gen1Bitset Gen1Bitset::EventFlags(SaveView sv) {
+    return FromSave(sv, Gen1Layout::EventFlagsOff, Gen1Layout::EventFlagsLen, Gen1Layout::EventFlagsLen * 8);
+}
+
+bool Gen1Bitset::Test(std::size_t bit) const {
+    if (bit >= bitCount_) {
+        throw std::out_of_range("Gen1Bitset: bit index out of range");
+    }
+    return (bytes_[bit / 8] >> (bit % 8)) & 1u;
+}
+
+std::size_t Gen1Bitset::Count() const {
+    std::size_t n = 0;
+    for (std::size_t w = 0; w < WordCount(); ++w) {
+        n += static_cast<std::size_t>(std::popcount(Word(w)));
+    }
+    return n;
+}
+
+bool Gen1Bitset::AnySet() const {
+    for (std::size_t w = 0; w < WordCount(); ++w) {
+        if (Word(w) != 0) return true;
+    }
+    return false;
+}
+
+bool Gen1Bitset::AllSet() const {
+    const std::size_t words = WordCount();
+    for (std::size_t w = 0; w < words; ++w) {
+        const std::size_t bits = std::min<std::size_t>(64, bitCount_ - w * 64);
+        const u64 full = (bits == 64) ? ~u64{0} : ((u64{1} << bits) - 1);
+        if (Word(w) != full) return false;
+    }
+    return true;
+}
+
+std::size_t Gen1Bitset::NextSet(std::size_t from) const {
+    if (from >= bitCount_) return npos;
+
+    std::size_t w = from / 64;
+    // Drop bits below `from` in the first word.
+    u64 word = Word(w) & (~u64{0} << (from % 64));
+    for (;;) {
+        if (word != 0) return w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+        if (++w >= WordCount()) return npos;
+        word = Word(w);
+    }
+}
+
+void Gen1Bitset::RequireSameSize(const Gen1Bitset& a, const Gen1Bitset& b) {
+    if (a.bitCount_ != b.bitCount_) {
+        throw std::invalid_argument("Gen1Bitset: bitsets differ in size");
+    }
+}
+
+std::size_t Gen1Bitset::CountCombined(const Gen1Bitset& a, const Gen1Bitset& b, Op op) {
+    RequireSameSize(a, b);
+    std::size_t n = 0;
+    for (std::size_t w = 0; w < a.WordCount(); ++w) {
+        n += static_cast<std::size_t>(std::popcount(Combine(a.Word(w), b.Word(w), op)));
+    }
+    return n;
 }
 
 // =========================================================
 // SaveValidator
 // =========================================================
 
-void SaveValidator::RequireExpectedSize(const SaveBuffer& sb) {
-    if (sb.Size() != Gen1Layout::ExpectedSize) {
+void SaveValidator::RequireExpectedSize(SaveView sv) {
+    SAVEGENIE_STAGE(Validate);
+    if (sv.Size() != Gen1Layout::ExpectedSize) {
         std::ostringstream oss;
-        oss << "Unexpected save size: 0x" << std::hex << sb.Size()
+        oss << "Unexpected save size: 0x" << std::hex << sv.Size()
             << " (expected 0x" << Gen1Layout::ExpectedSize << ")";
         throw std::runtime_error(oss.str());
     }
 }
 
-bool SaveValidator::HasExpectedSize(const SaveBuffer& sb) {
-    return sb.Size() == Gen1Layout::ExpectedSize;
+bool SaveValidator::HasExpectedSize(SaveView sv) {
+    return sv.Size() == Gen1Layout::ExpectedSize;
 }
 
-bool SaveValidator::HasValidMainChecksum(const SaveBuffer& sb) {
+bool SaveValidator::HasValidMainChecksum(SaveView sv) {
+    SAVEGENIE_STAGE(Validate);
     // If size is wrong, checksum check may throw; treat as invalid.
     try {
-        return Gen1Checksum::ValidateMain(sb);
+        return Gen1Checksum::ValidateMain(sv);
     } catch (...) {
         return false;
     }
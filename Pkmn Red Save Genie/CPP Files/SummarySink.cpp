@@ -0,0 +1,353 @@
+//
+//  SummarySink.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of OutputBuffer and the NDJSON / binary / text sinks.
+//   - Numbers are formatted with std::to_chars (no streams, no locale).
+//
+
+#include "SummarySink.hpp"
+
+#include <bit>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+namespace savegenie {
+
+// =========================================================
+// OutputBuffer
+// =========================================================
+
+OutputBuffer::OutputBuffer(int fd, std::size_t flushThreshold)
+    : fd_(fd), flushThreshold_(flushThreshold) {
+    buf_.reserve(fd >= 0 ? flushThreshold + flushThreshold / 2 : 4096);
+}
+
+OutputBuffer::~OutputBuffer() {
+    // Best effort: destructors must not throw.
+    try {
+        Flush();
+    } catch (...) {
+    }
+}
+
+void OutputBuffer::PatchU32LE(std::size_t pos, std::uint32_t v) {
+    if (pos + 4 > buf_.size()) {
+        throw std::out_of_range("OutputBuffer: patch position out of range");
+    }
+    for (int i = 0; i < 4; ++i) {
+        buf_[pos + static_cast<std::size_t>(i)] = static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+}
+
+void OutputBuffer::RecordBoundary() {
+    if (fd_ >= 0 && buf_.size() >= flushThreshold_) Flush();
+}
+
+void OutputBuffer::Flush() {
+    if (fd_ < 0 || buf_.empty()) return;
+
+    std::size_t done = 0;
+    while (done < buf_.size()) {
+#if defined(__unix__) || defined(__APPLE__)
+        const ssize_t n = ::write(fd_, buf_.data() + done, buf_.size() - done);
+        if (n < 0 && errno == EINTR) continue;
+#else
+        const int n = ::_write(fd_, buf_.data() + done, static_cast<unsigned>(buf_.size() - done));
+#endif
+        if (n <= 0) {
+            buf_.clear();
+            throw std::runtime_error("OutputBuffer: write failed");
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    buf_.clear();
+}
+
+// =========================================================
+// Shared formatting helpers
+// =========================================================
+
+static void AppendUint(OutputBuffer& out, std::uint64_t v) {
+    char tmp[24];
+    const auto r = std::to_chars(tmp, tmp + sizeof(tmp), v);
+    out.Append(std::string_view(tmp, static_cast<std::size_t>(r.ptr - tmp)));
+}
+
+static void AppendFixed2(OutputBuffer& out, double v) {
+    char tmp[64];
+    const auto r = std::to_chars(tmp, tmp + sizeof(tmp), v, std::chars_format::fixed, 2);
+    if (r.ec != std::errc()) {
+        out.Append("0.00");
+        return;
+    }
+    out.Append(std::string_view(tmp, static_cast<std::size_t>(r.ptr - tmp)));
+}
+
+// =========================================================
+// SummarySink (factory / names)
+// =========================================================
+
+std::unique_ptr<SummarySink> SummarySink::Create(SummaryFormat format, OutputBuffer& out) {
+    switch (format) {
+        case SummaryFormat::Text:   return std::make_unique<TextSink>(out);
+        case SummaryFormat::Ndjson: return std::make_unique<NdjsonSink>(out);
+        case SummaryFormat::Binary: return std::make_unique<BinarySink>(out);
+    }
+    throw std::invalid_argument("SummarySink: unknown format");
+}
+
+const char* SummarySink::FormatName(SummaryFormat format) {
+    switch (format) {
+        case SummaryFormat::Text:   return "text";
+        case SummaryFormat::Ndjson: return "ndjson";
+        case SummaryFormat::Binary: return "binary";
+    }
+    return "unknown";
+}
+
+std::optional<SummaryFormat> SummarySink::ParseFormat(std::string_view name) {
+    for (SummaryFormat f : {SummaryFormat::Text, SummaryFormat::Ndjson, SummaryFormat::Binary}) {
+        if (name == FormatName(f)) return f;
+    }
+    return std::nullopt;
+}
+
+// =========================================================
+// NdjsonSink
+// =========================================================
+
+void NdjsonSink::Quoted(std::string_view s) {
+    static const char* kHex = "0123456789abcdef";
+    out_.Append('"');
+    for (char c : s) {
+        const auto uc = static_cast<unsigned char>(c);
+        switch (c) {
+            case '"':  out_.Append("\\\""); break;
+            case '\\': out_.Append("\\\\"); break;
+            case '\n': out_.Append("\\n"); break;
+            case '\r': out_.Append("\\r"); break;
+            case '\t': out_.Append("\\t"); break;
+            default:
+                if (uc < 0x20) {
+                    out_.Append("\\u00");
+                    out_.Append(kHex[uc >> 4]);
+                    out_.Append(kHex[uc & 0xF]);
+                } else {
+                    out_.Append(c); // UTF-8 passes through
+                }
+        }
+    }
+    out_.Append('"');
+}
+
+void NdjsonSink::Key(std::string_view key) {
+    if (firstItem_.empty()) {
+        throw std::logic_error("NdjsonSink: field written outside a record");
+    }
+    if (!firstItem_.back()) out_.Append(',');
+    firstItem_.back() = false;
+
+    if (!inArray_.back()) {
+        Quoted(key);
+        out_.Append(':');
+    }
+}
+
+void NdjsonSink::Open(std::string_view key, char bracket, bool isArray) {
+    Key(key);
+    out_.Append(bracket);
+    inArray_.push_back(isArray);
+    firstItem_.push_back(true);
+}
+
+void NdjsonSink::Close(char bracket) {
+    if (inArray_.size() <= 1) {
+        throw std::logic_error("NdjsonSink: unbalanced End*");
+    }
+    out_.Append(bracket);
+    inArray_.pop_back();
+    firstItem_.pop_back();
+}
+
+void NdjsonSink::BeginRecord() {
+    inArray_.assign(1, false);
+    firstItem_.assign(1, true);
+    out_.Append('{');
+}
+
+void NdjsonSink::EndRecord() {
+    if (inArray_.size() != 1) {
+        throw std::logic_error("NdjsonSink: record ended with open scopes");
+    }
+    inArray_.clear();
+    firstItem_.clear();
+    out_.Append("}\n");
+    out_.RecordBoundary();
+}
+
+void NdjsonSink::BeginObject(std::string_view key) { Open(key, '{', false); }
+void NdjsonSink::EndObject() { Close('}'); }
+void NdjsonSink::BeginArray(std::string_view key) { Open(key, '[', true); }
+void NdjsonSink::EndArray() { Close(']'); }
+
+void NdjsonSink::String(std::string_view key, std::string_view value) {
+    Key(key);
+    Quoted(value);
+}
+
+void NdjsonSink::Uint(std::string_view key, std::uint64_t value) {
+    Key(key);
+    AppendUint(out_, value);
+}
+
+void NdjsonSink::Bool(std::string_view key, bool value) {
+    Key(key);
+    out_.Append(value ? "true" : "false");
+}
+
+void NdjsonSink::Double(std::string_view key, double value) {
+    Key(key);
+    AppendFixed2(out_, value);
+}
+
+void NdjsonSink::AppendRendered(std::string_view fields) {
+    if (firstItem_.size() != 1) {
+        throw std::logic_error("NdjsonSink: rendered fields belong at record level");
+    }
+    // The fragment carries a leading ',' if it was captured after another field.
+    if (!fields.empty() && fields.front() == ',') fields.remove_prefix(1);
+    if (fields.empty()) return;
+
+    if (!firstItem_.back()) out_.Append(',');
+    firstItem_.back() = false;
+    out_.Append(fields);
+}
+
+// =========================================================
+// BinarySink
+// =========================================================
+
+void BinarySink::Varint(std::uint64_t v) {
+    while (v >= 0x80) {
+        out_.Append(static_cast<char>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out_.Append(static_cast<char>(v));
+}
+
+void BinarySink::Entry(Tag tag, std::string_view key) {
+    out_.Append(static_cast<char>(tag));
+    Varint(key.size());
+    out_.Append(key);
+}
+
+void BinarySink::BeginRecord() {
+    recordStart_ = out_.Size();
+    out_.Append(std::string_view("\0\0\0\0", 4)); // length, patched in EndRecord
+}
+
+void BinarySink::EndRecord() {
+    const std::size_t payload = out_.Size() - recordStart_ - 4;
+    out_.PatchU32LE(recordStart_, static_cast<std::uint32_t>(payload));
+    out_.RecordBoundary();
+}
+
+void BinarySink::BeginObject(std::string_view key) { Entry(TagObject, key); }
+void BinarySink::EndObject() { out_.Append(static_cast<char>(TagEnd)); }
+void BinarySink::BeginArray(std::string_view key) { Entry(TagArray, key); }
+void BinarySink::EndArray() { out_.Append(static_cast<char>(TagEnd)); }
+
+void BinarySink::String(std::string_view key, std::string_view value) {
+    Entry(TagString, key);
+    Varint(value.size());
+    out_.Append(value);
+}
+
+void BinarySink::Uint(std::string_view key, std::uint64_t value) {
+    Entry(TagUint, key);
+    Varint(value);
+}
+
+void BinarySink::Bool(std::string_view key, bool value) {
+    Entry(TagBool, key);
+    out_.Append(static_cast<char>(value ? 1 : 0));
+}
+
+void BinarySink::Double(std::string_view key, double value) {
+    Entry(TagDouble, key);
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    for (int i = 0; i < 8; ++i) {
+        out_.Append(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+}
+
+void BinarySink::AppendRendered(std::string_view fields) { out_.Append(fields); }
+
+// =========================================================
+// TextSink
+// =========================================================
+
+void TextSink::Line(std::string_view key, std::string_view value) {
+    for (std::size_t i = 1; i < inArray_.size(); ++i) out_.Append("  ");
+    if (!inArray_.empty() && inArray_.back()) {
+        out_.Append(value.empty() ? "-" : "- ");
+    } else {
+        out_.Append(key);
+        out_.Append(value.empty() ? ":" : ": ");
+    }
+    out_.Append(value);
+    out_.Append('\n');
+}
+
+void TextSink::BeginRecord() { inArray_.assign(1, false); }
+
+void TextSink::EndRecord() {
+    inArray_.clear();
+    out_.Append('\n');
+    out_.RecordBoundary();
+}
+
+void TextSink::BeginObject(std::string_view key) {
+    Line(key, {});
+    inArray_.push_back(false);
+}
+
+void TextSink::EndObject() { inArray_.pop_back(); }
+
+void TextSink::BeginArray(std::string_view key) {
+    Line(key, {});
+    inArray_.push_back(true);
+}
+
+void TextSink::EndArray() { inArray_.pop_back(); }
+
+void TextSink::String(std::string_view key, std::string_view value) { Line(key, value); }
+
+void TextSink::Uint(std::string_view key, std::uint64_t value) {
+    char tmp[24];
+    const auto r = std::to_chars(tmp, tmp + sizeof(tmp), value);
+    Line(key, std::string_view(tmp, static_cast<std::size_t>(r.ptr - tmp)));
+}
+
+void TextSink::Bool(std::string_view key, bool value) { Line(key, value ? "true" : "false"); }
+
+void TextSink::Double(std::string_view key, double value) {
+    char tmp[64];
+    const auto r = std::to_chars(tmp, tmp + sizeof(tmp), value, std::chars_format::fixed, 2);
+    Line(key, r.ec == std::errc() ? std::string_view(tmp, static_cast<std::size_t>(r.ptr - tmp))
+                                  : std::string_view("0.00"));
+}
+
+void TextSink::AppendRendered(std::string_view fields) { out_.Append(fields); }
+
+} // namespace savegenie
@@ -0,0 +1,131 @@
+//
+//  WorkStealingPool.cpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Implementation of WorkStealingPool.
+//   - Range-splitting work stealing: cheap for the owner, fair under skew
+//     (a handful of huge or slow files no longer stalls one core).
+//
+
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace savegenie {
+
+namespace {
+
+// One worker's remaining [begin, end) slice of the index space.
+struct WorkRange {
+    std::mutex mu;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+};
+
+// Owner side: take the next index from the front.
+bool PopFront(WorkRange& r, std::size_t& out) {
+    std::lock_guard<std::mutex> lock(r.mu);
+    if (r.begin >= r.end) return false;
+    out = r.begin++;
+    return true;
+}
+
+// Thief side: move the back half of victim's range into self.
+bool StealHalf(WorkRange& victim, WorkRange& self) {
+    std::size_t b = 0;
+    std::size_t e = 0;
+    {
+        std::lock_guard<std::mutex> lock(victim.mu);
+        if (victim.begin >= victim.end) return false;
+
+        const std::size_t remaining = victim.end - victim.begin;
+        const std::size_t take = (remaining + 1) / 2;
+        e = victim.end;
+        b = victim.end - take;
+        victim.end = b;
+    }
+
+    std::lock_guard<std::mutex> lock(self.mu);
+    self.begin = b;
+    self.end = e;
+    return true;
+}
+
+} // namespace
+
+unsigned WorkStealingPool::ResolveThreadCount(unsigned requested) {
+    if (requested != 0) return requested;
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1u : hw;
+}
+
+void WorkStealingPool::ParallelFor(std::size_t count, unsigned threads, const Task& task) {
+    if (count == 0) return;
+
+    const unsigned n = static_cast<unsigned>(
+        std::min<std::size_t>(ResolveThreadCount(threads), count));
+
+    // Single worker: no threads, no locks.
+    if (n == 1) {
+        for (std::size_t i = 0; i < count; ++i) task(0, i);
+        return;
+    }
+
+    std::vector<std::unique_ptr<WorkRange>> ranges;
+    ranges.reserve(n);
+    for (unsigned w = 0; w < n; ++w) {
+        auto r = std::make_unique<WorkRange>();
+        r->begin = count * w / n;
+        r->end = count * (w + 1) / n;
+        ranges.push_back(std::move(r));
+    }
+
+    std::atomic<bool> failed{false};
+    std::exception_ptr firstError;
+    std::mutex errorMu;
+
+    auto workerMain = [&](unsigned self) {
+        try {
+            std::size_t idx = 0;
+            for (;;) {
+                if (failed.load(std::memory_order_relaxed)) return;
+
+                if (PopFront(*ranges[self], idx)) {
+                    task(self, idx);
+                    continue;
+                }
+
+                // Own range is empty: try each victim once, starting after self.
+                bool stole = false;
+                for (unsigned k = 1; k < n && !stole; ++k) {
+                    stole = StealHalf(*ranges[(self + k) % n], *ranges[self]);
+                }
+                if (!stole) return;
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMu);
+            if (!firstError) firstError = std::current_exception();
+            failed.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(n - 1);
+    for (unsigned w = 1; w < n; ++w) {
+        pool.emplace_back(workerMain, w);
+    }
+    workerMain(0);
+
+    for (auto& t : pool) t.join();
+
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+} // namespace savegenie
@@ -19,10 +19,12 @@
 // =========================================================
 
 #include "WriteOnlyData.hpp"
+#include "Gen1Stats.hpp"
 
 #include <algorithm>
 #include <cctype>
 #include <sstream>
+#include <type_traits>
 
 namespace savegenie {
 
@@ -49,6 +51,17 @@ static std::string UpperAscii(std::string s) {
     return s;
 }
 
+// Append "[OK] label - message" / "[ERROR] ..." to the log, pass `m` through.
+static EditMessage Logged(EditLog* log, const char* label, EditMessage m) {
+    if (log) {
+        std::ostringstream oss;
+        oss << (m.Ok() ? "[OK] " : "[ERROR] ") << label;
+        if (!m.message.empty()) oss << " - " << m.message;
+        log->Add(oss.str());
+    }
+    return m;
+}
+
 // =========================================================
 // WriteOnlyData
 // =========================================================
@@ -56,19 +69,19 @@ static std::string UpperAscii(std::string s) {
 WriteOnlyData::WriteOnlyData(SaveBuffer& buffer) : buffer_(buffer) {}
 
 EditMessage WriteOnlyData::SetTrainerName(const std::string& name) {
-    const auto v = ValidateGen1Name(name, Gen1Layout::TrainerNameLen);
+    const auto v = ValidateGen1Name(name, TrainerNameField::Len);
     if (!v.Ok()) return v;
 
-    // EncodeName should write terminator + pad.
-    Gen1TextCodec::EncodeName(buffer_, Gen1Layout::TrainerNameOff, Gen1Layout::TrainerNameLen, UpperAscii(name));
+    // EncodeName writes terminator + pad.
+    TrainerNameField::Write(buffer_, UpperAscii(name));
     return EditMessage(EditStatus::Ok, "Trainer name set.");
 }
 
 EditMessage WriteOnlyData::SetRivalName(const std::string& name) {
-    const auto v = ValidateGen1Name(name, Gen1Layout::RivalNameLen);
+    const auto v = ValidateGen1Name(name, RivalNameField::Len);
     if (!v.Ok()) return v;
 
-    Gen1TextCodec::EncodeName(buffer_, Gen1Layout::RivalNameOff, Gen1Layout::RivalNameLen, UpperAscii(name));
+    RivalNameField::Write(buffer_, UpperAscii(name));
     return EditMessage(EditStatus::Ok, "Rival name set.");
 }
 
@@ -76,7 +89,7 @@ EditMessage WriteOnlyData::SetMoney(u32 money) {
     const auto v = ValidateMoney(money);
     if (!v.Ok()) return v;
 
-    BcdCodec::WriteBcd3(buffer_, Gen1Layout::MoneyOff, money);
+    MoneyField::Write(buffer_, money);
     return EditMessage(EditStatus::Ok, "Money set.");
 }
 
@@ -84,68 +97,127 @@ EditMessage WriteOnlyData::SetCoins(u16 coins) {
     const auto v = ValidateCoins(coins);
     if (!v.Ok()) return v;
 
-    BcdCodec::WriteBcd2(buffer_, Gen1Layout::CoinsOff, coins);
+    CoinsField::Write(buffer_, coins);
     return EditMessage(EditStatus::Ok, "Coins set.");
 }
 
 EditMessage WriteOnlyData::SetBadges(u8 badgesBitfield) {
-    buffer_.WriteU8(Gen1Layout::BadgesOff, badgesBitfield);
+    FieldCodec<Gen1Field::Badges>::Write(buffer_, badgesBitfield);
     return EditMessage(EditStatus::Ok, "Badges bitfield set.");
 }
 
 EditMessage WriteOnlyData::SetLocation(u8 mapId, u8 x, u8 y) {
     // Conservative validation: accept any mapId that isn't explicitly INVALID in your map table.
-    if (Gen1MapLookup::NameFromId(mapId) == "INVALID") {
+    if (Gen1MapLookup::NameViewFromId(mapId) == "INVALID") {
         return EditMessage(EditStatus::OutOfRange, "Map ID is invalid (per map table).");
     }
 
-    buffer_.WriteU8(Gen1Layout::MapIdOff, mapId);
-    buffer_.WriteU8(Gen1Layout::XCoordOff, x);
-    buffer_.WriteU8(Gen1Layout::YCoordOff, y);
+    FieldCodec<Gen1Field::MapId>::Write(buffer_, mapId);
+    FieldCodec<Gen1Field::XCoord>::Write(buffer_, x);
+    FieldCodec<Gen1Field::YCoord>::Write(buffer_, y);
 
     return EditMessage(EditStatus::Ok, "Location set (MapID/X/Y).");
 }
 
 EditMessage WriteOnlyData::Apply(const EditRequest& req, EditLog* log) {
-    bool any = false;
+    return Transact([&](bool& requested) { return ApplyFields(req, log, requested); }, log);
+}
+
+EditMessage WriteOnlyData::ApplyBatch(const EditBatch& batch, EditLog* log) {
+    return Transact([&](bool& requested) {
+        for (std::size_t i = 0; i < batch.edits.size(); ++i) {
+            const EditMessage m = std::visit([&](const auto& edit) -> EditMessage {
+                using T = std::decay_t<decltype(edit)>;
+                if constexpr (std::is_same_v<T, EditRequest>) {
+                    return ApplyFields(edit, log, requested);
+                } else if constexpr (std::is_same_v<T, ItemEditRequest>) {
+                    requested = true;
+                    return ApplyItemFields(edit, log);
+                } else if constexpr (std::is_same_v<T, PokemonEditRequest>) {
+                    return ApplyPokemonFields(edit, log, requested);
+                } else {
+                    return ApplyBulkPokemonFields(edit, log, requested);
+                }
+            }, batch.edits[i]);
+
+            if (!m.Ok()) {
+                std::ostringstream oss;
+                oss << "Batch edit #" << (i + 1) << " of " << batch.Size() << ": " << m.message;
+                return EditMessage(m.status, oss.str());
+            }
+        }
+        if (!requested) return Logged(log, "ApplyBatch", EditMessage(EditStatus::Ok, "No edits requested."));
+
+        std::ostringstream oss;
+        oss << "Batch applied (" << batch.Size() << " edit(s)).";
+        return EditMessage(EditStatus::Ok, oss.str());
+    }, log);
+}
 
-    auto run = [&](const char* label, const EditMessage& m) -> EditMessage {
+EditMessage WriteOnlyData::Transact(const TransactionBody& body, EditLog* log) {
+    if (buffer_.JournalOpen()) {
+        return EditMessage(EditStatus::InvalidArgument, "Another edit transaction is already open on this save.");
+    }
+
+    buffer_.BeginJournal();
+    bool requested = false;
+    EditMessage result;
+    try {
+        result = body(requested);
+        if (result.Ok() && requested) {
+            // One repair for the whole transaction, covering every domain it touched.
+            const EditMessage fixed = Logged(log, "FixChecksums", FixDirtyChecksums(buffer_.JournalDirtyDomains()));
+            if (!fixed.Ok()) result = fixed;
+        }
+    } catch (const std::exception& e) {
+        result = Logged(log, "Transaction", EditMessage(EditStatus::InvalidSave, e.what()));
+    }
+
+    if (!result.Ok()) {
+        const std::size_t restored = buffer_.JournalSize();
+        buffer_.RollbackJournal();
         if (log) {
             std::ostringstream oss;
-            oss << (m.Ok() ? "[OK] " : "[ERROR] ") << label;
-            if (!m.message.empty()) oss << " - " << m.message;
+            oss << "[ROLLBACK] " << restored << " byte(s) restored; save unchanged.";
             log->Add(oss.str());
         }
-        return m;
-    };
+        return result;
+    }
+
+    buffer_.CommitJournal();
+    return result;
+}
+
+EditMessage WriteOnlyData::ApplyFields(const EditRequest& req, EditLog* log, bool& requested) {
+    bool any = false;
 
     if (req.newTrainerName.has_value()) {
         any = true;
-        auto m = run("SetTrainerName", SetTrainerName(*req.newTrainerName));
+        auto m = Logged(log, "SetTrainerName", SetTrainerName(*req.newTrainerName));
         if (!m.Ok()) return m;
     }
 
     if (req.newRivalName.has_value()) {
         any = true;
-        auto m = run("SetRivalName", SetRivalName(*req.newRivalName));
+        auto m = Logged(log, "SetRivalName", SetRivalName(*req.newRivalName));
         if (!m.Ok()) return m;
     }
 
     if (req.newMoney.has_value()) {
         any = true;
-        auto m = run("SetMoney", SetMoney(*req.newMoney));
+        auto m = Logged(log, "SetMoney", SetMoney(*req.newMoney));
         if (!m.Ok()) return m;
     }
 
     if (req.newCoins.has_value()) {
         any = true;
-        auto m = run("SetCoins", SetCoins(*req.newCoins));
+        auto m = Logged(log, "SetCoins", SetCoins(*req.newCoins));
         if (!m.Ok()) return m;
     }
 
     if (req.newBadges.has_value()) {
         any = true;
-        auto m = run("SetBadges", SetBadges(*req.newBadges));
+        auto m = Logged(log, "SetBadges", SetBadges(*req.newBadges));
         if (!m.Ok()) return m;
     }
 
@@ -153,57 +225,431 @@ EditMessage WriteOnlyData::Apply(const EditRequest& req, EditLog* log) {
     if (req.newMapId.has_value() || req.newX.has_value() || req.newY.has_value()) {
         any = true;
         if (!req.newMapId.has_value() || !req.newX.has_value() || !req.newY.has_value()) {
-            auto m = run("SetLocation", EditMessage(EditStatus::InvalidArgument, "Location edit requires MapID, X, and Y together."));
-            return m;
+            return Logged(log, "SetLocation", EditMessage(EditStatus::InvalidArgument, "Location edit requires MapID, X, and Y together."));
         }
 
-        auto m = run("SetLocation", SetLocation(*req.newMapId, *req.newX, *req.newY));
+        auto m = Logged(log, "SetLocation", SetLocation(*req.newMapId, *req.newX, *req.newY));
         if (!m.Ok()) return m;
     }
 
     if (!any) {
-        return run("Apply", EditMessage(EditStatus::Ok, "No edits requested."));
-    }
-
-    // Always fix checksums after successful edits.
-    {
-        auto m = run("FixChecksums", FixChecksums(log));
-        if (!m.Ok()) return m;
+        return Logged(log, "Apply", EditMessage(EditStatus::Ok, "No edits requested."));
     }
 
+    requested = true;
     return EditMessage(EditStatus::Ok, "Edits applied.");
 }
 
 std::vector<ItemStack> WriteOnlyData::ReadItemList(ItemListKind kind, bool includeNamesAndHex) const {
-    const auto r = RegionFor(kind);
-    return ReadItemListInternal(r, includeNamesAndHex);
+    return ReadItemListInternal(RegionFor(kind), includeNamesAndHex);
 }
 
 EditMessage WriteOnlyData::AddOrUpdateItem(const ItemEditRequest& req, EditLog* log) {
-    (void)req;
-    (void)log;
-    return EditMessage(EditStatus::InvalidArgument, "Item edits not implemented yet (next step).");
+    ItemEditRequest add = req;
+    add.action = ItemEditAction::AddOrUpdate;
+    return Transact([&](bool& requested) {
+        requested = true;
+        return ApplyItemFields(add, log);
+    }, log);
 }
 
 EditMessage WriteOnlyData::RemoveItem(ItemListKind kind, u8 itemId, EditLog* log) {
-    (void)kind;
-    (void)itemId;
-    (void)log;
-    return EditMessage(EditStatus::InvalidArgument, "Item edits not implemented yet (next step).");
+    ItemEditRequest remove;
+    remove.list = kind;
+    remove.action = ItemEditAction::Remove;
+    remove.itemId = itemId;
+    return Transact([&](bool& requested) {
+        requested = true;
+        return ApplyItemFields(remove, log);
+    }, log);
 }
 
 EditMessage WriteOnlyData::SetItemQuantity(ItemListKind kind, u8 itemId, u8 quantity, EditLog* log) {
-    (void)kind;
-    (void)itemId;
-    (void)quantity;
-    (void)log;
-    return EditMessage(EditStatus::InvalidArgument, "Item edits not implemented yet (next step).");
+    ItemEditRequest set;
+    set.list = kind;
+    set.action = ItemEditAction::SetQuantity;
+    set.itemId = itemId;
+    set.quantity = quantity;
+    return Transact([&](bool& requested) {
+        requested = true;
+        return ApplyItemFields(set, log);
+    }, log);
+}
+
+EditMessage WriteOnlyData::ApplyItemFields(const ItemEditRequest& req, EditLog* log) {
+    const char* label = req.action == ItemEditAction::AddOrUpdate ? "AddOrUpdateItem"
+                      : req.action == ItemEditAction::SetQuantity ? "SetItemQuantity"
+                                                                  : "RemoveItem";
+    const FieldDescriptor& list = RegionFor(req.list);
+    const char* listName = req.list == ItemListKind::Bag ? "Bag" : "PC Item Box";
+
+    std::vector<ItemStack> items = ReadItemListInternal(list, false);
+    auto it = std::find_if(items.begin(), items.end(), [&](const ItemStack& s) { return s.itemId == req.itemId; });
+
+    const bool removing = req.action == ItemEditAction::Remove ||
+                          (req.action == ItemEditAction::SetQuantity && req.quantity == 0);
+    if (removing || req.action == ItemEditAction::SetQuantity) {
+        if (it == items.end()) {
+            return Logged(log, label, EditMessage(EditStatus::ItemNotFound, std::string("Item is not in the ") + listName + "."));
+        }
+    } else {
+        const auto v = ValidateItemId(req.itemId, req.allowInvalidIds);
+        if (!v.Ok()) return Logged(log, label, v);
+    }
+
+    if (removing) {
+        items.erase(it);
+    } else {
+        const auto q = ValidateQuantity(req.quantity, req.minQuantity, req.maxQuantity);
+        if (!q.Ok()) return Logged(log, label, q);
+
+        if (req.action == ItemEditAction::SetQuantity) {
+            it->quantity = req.quantity;
+        } else if (it != items.end()) {
+            const int total = static_cast<int>(it->quantity) + static_cast<int>(req.quantity);
+            if (total > static_cast<int>(req.maxQuantity)) {
+                std::ostringstream oss;
+                oss << "Quantity would exceed " << static_cast<int>(req.maxQuantity) << " (already holding "
+                    << static_cast<int>(it->quantity) << ").";
+                return Logged(log, label, EditMessage(EditStatus::InvalidQuantity, oss.str()));
+            }
+            it->quantity = static_cast<u8>(total);
+        } else {
+            ItemStack added;
+            added.itemId = req.itemId;
+            added.quantity = req.quantity;
+            items.push_back(added);
+        }
+    }
+
+    const auto w = WriteItemListInternal(list, items);
+    if (!w.Ok()) return Logged(log, label, w);
+
+    std::ostringstream oss;
+    oss << Gen1ItemLookup::NameViewFromId(req.itemId) << " in " << listName << ": ";
+    if (removing) {
+        oss << "removed.";
+    } else {
+        const auto now = std::find_if(items.begin(), items.end(), [&](const ItemStack& s) { return s.itemId == req.itemId; });
+        oss << "x" << static_cast<int>(now->quantity) << ".";
+    }
+    return Logged(log, label, EditMessage(EditStatus::Ok, oss.str()));
+}
+
+// =========================================================
+// Pokémon struct edits
+// =========================================================
+
+namespace {
+
+// The struct-level part of a Pokémon edit, shared by single and bulk edits.
+struct MonChanges {
+    std::optional<u8> species;
+    std::optional<u8> level;
+    std::optional<std::array<u8, 4>> dvs;
+    std::optional<std::array<u16, 5>> statExp;
+    std::optional<std::array<u8, 4>> moves;
+    std::optional<std::array<u8, 4>> ppUps;
+    bool restorePp = false;
+
+    bool NeedsStats() const { return species || level || dvs || statExp; }
+    bool TouchesPp() const { return moves || ppUps || restorePp; }
+    bool Any() const { return NeedsStats() || TouchesPp(); }
+};
+
+// One occupied slot: its block (count byte first) and its struct.
+struct MonSlot {
+    std::size_t block = 0;
+    std::size_t mon = 0;
+    std::size_t slot = 0;
+    bool party = false;
+};
+
+} // namespace
+
+static MonSlot MonSlotAt(std::size_t block, std::size_t slot, bool party) {
+    MonSlot at;
+    at.block = block;
+    at.slot = slot;
+    at.party = party;
+    at.mon = block + (party ? Gen1Layout::PartyMonDataRel : Gen1Layout::BoxMonDataRel)
+        + slot * (party ? Gen1Layout::PartyMonStructSize : Gen1Layout::BoxMonStructSize);
+    return at;
+}
+
+static u16 PackDVs(const std::array<u8, 4>& dvs) {
+    return static_cast<u16>((dvs[0] << 12) | (dvs[1] << 8) | (dvs[2] << 4) | dvs[3]);
+}
+
+// Range checks only; nothing is written.
+static EditMessage ValidateMonChanges(const MonChanges& c) {
+    if (c.species && !Gen1Stats::ForSpecies(*c.species)) {
+        return EditMessage(EditStatus::InvalidArgument, "Species ID is not one of the 151 (no base stats).");
+    }
+    if (c.level && (*c.level < 1 || *c.level > Gen1Stats::MaxLevel)) {
+        return EditMessage(EditStatus::OutOfRange, "Level out of range (1..100).");
+    }
+    if (c.dvs && std::any_of(c.dvs->begin(), c.dvs->end(), [](u8 dv) { return dv > 15; })) {
+        return EditMessage(EditStatus::OutOfRange, "DVs out of range (0..15 each).");
+    }
+    if (c.ppUps && std::any_of(c.ppUps->begin(), c.ppUps->end(), [](u8 u) { return u > Gen1Stats::MaxPpUps; })) {
+        return EditMessage(EditStatus::OutOfRange, "PP Ups out of range (0..3 each).");
+    }
+    if (c.moves) {
+        const auto& m = *c.moves;
+        if (m[0] == 0) return EditMessage(EditStatus::InvalidArgument, "The first move slot cannot be empty.");
+        for (std::size_t k = 0; k < m.size(); ++k) {
+            if (m[k] > Gen1Stats::MaxMoveId) {
+                return EditMessage(EditStatus::OutOfRange, "Move ID out of range (1..165).");
+            }
+            if (k > 0 && m[k] != 0 && m[k - 1] == 0) {
+                return EditMessage(EditStatus::InvalidArgument, "Empty move slots must come last.");
+            }
+            if (m[k] != 0 && std::find(m.begin(), m.begin() + k, m[k]) != m.begin() + k) {
+                return EditMessage(EditStatus::InvalidArgument, "A move cannot be listed twice.");
+            }
+        }
+    }
+    return EditMessage(EditStatus::Ok, "");
+}
+
+// Applies validated changes to one slot. Stats are recomputed from the tables
+// and written back for party mons; HP keeps the damage taken (fainted stays 0).
+static EditMessage ApplyMonChanges(SaveBuffer& b, const MonSlot& at, const MonChanges& c) {
+    const u8 oldSpecies = b.ReadU8(at.mon + Gen1Layout::MonSpeciesRel);
+    const u8 species = c.species.value_or(oldSpecies);
+    const Gen1BaseStats* base = Gen1Stats::ForSpecies(species);
+    if (c.NeedsStats() && !base) {
+        std::ostringstream oss;
+        oss << "Slot " << at.slot << " holds species 0x" << std::hex << static_cast<int>(oldSpecies)
+            << ", which has no base stats; set a species first.";
+        return EditMessage(EditStatus::InvalidSave, oss.str());
+    }
+
+    const std::size_t levelRel = at.party ? Gen1Layout::MonPartyLevelRel : Gen1Layout::MonBoxLevelRel;
+    const u8 oldLevel = b.ReadU8(at.mon + levelRel);
+
+    if (c.NeedsStats()) {
+        std::array<u16, Gen1StatCount> statExp{};
+        for (std::size_t i = 0; i < Gen1StatCount; ++i) {
+            statExp[i] = b.ReadU16BE(at.mon + Gen1Layout::MonStatExpRel + 2 * i);
+        }
+        const u16 oldDvs = b.ReadU16BE(at.mon + Gen1Layout::MonDVsRel);
+
+        // Max HP before the edit: stored for party mons, derived for box mons.
+        u16 oldMaxHp = 0;
+        if (at.party) {
+            oldMaxHp = b.ReadU16BE(at.mon + Gen1Layout::MonMaxHpRel);
+        } else if (const Gen1BaseStats* oldBase = Gen1Stats::ForSpecies(oldSpecies)) {
+            oldMaxHp = Gen1Stats::Compute(*oldBase, oldDvs, statExp, std::clamp<u8>(oldLevel, 1, Gen1Stats::MaxLevel)).MaxHp();
+        }
+
+        if (c.species) {
+            b.WriteU8(at.block + 1 + at.slot, species); // species list mirrors the struct
+            b.WriteU8(at.mon + Gen1Layout::MonSpeciesRel, species);
+            b.WriteU8(at.mon + Gen1Layout::MonType1Rel, static_cast<u8>(base->type1));
+            b.WriteU8(at.mon + Gen1Layout::MonType2Rel, static_cast<u8>(base->type2));
+        }
+
+        const u8 level = c.level.value_or(std::clamp<u8>(oldLevel, 1, Gen1Stats::MaxLevel));
+        if (c.level || c.species) {
+            b.WriteU8(at.mon + Gen1Layout::MonBoxLevelRel, level);
+            if (at.party) b.WriteU8(at.mon + Gen1Layout::MonPartyLevelRel, level);
+
+            // A new level starts at its minimum; a new species keeps its exp if
+            // that still falls inside the level's range on its own curve.
+            const u32 floor = Gen1Stats::ExpForLevel(base->growth, level);
+            u32 exp = floor;
+            if (!c.level) {
+                const u32 ceiling = level < Gen1Stats::MaxLevel
+                    ? Gen1Stats::ExpForLevel(base->growth, static_cast<u8>(level + 1)) - 1
+                    : floor;
+                exp = std::clamp(b.ReadU24BE(at.mon + Gen1Layout::MonExpRel), floor, ceiling);
+            }
+            b.WriteU24BE(at.mon + Gen1Layout::MonExpRel, exp);
+        }
+
+        const u16 dvs = c.dvs ? PackDVs(*c.dvs) : oldDvs;
+        if (c.dvs) b.WriteU16BE(at.mon + Gen1Layout::MonDVsRel, dvs);
+        if (c.statExp) {
+            statExp = *c.statExp;
+            for (std::size_t i = 0; i < Gen1StatCount; ++i) {
+                b.WriteU16BE(at.mon + Gen1Layout::MonStatExpRel + 2 * i, statExp[i]);
+            }
+        }
+
+        const Gen1StatBlock stats = Gen1Stats::Compute(*base, dvs, statExp, level);
+        if (at.party) {
+            for (std::size_t i = 0; i < Gen1StatCount; ++i) {
+                b.WriteU16BE(at.mon + Gen1Layout::MonMaxHpRel + 2 * i, stats.values[i]);
+            }
+        }
+
+        const u16 hp = b.ReadU16BE(at.mon + Gen1Layout::MonCurrentHpRel);
+        if (hp != 0) {
+            const int damage = std::max(0, static_cast<int>(oldMaxHp) - static_cast<int>(hp));
+            const int newHp = std::max(1, static_cast<int>(stats.MaxHp()) - damage);
+            b.WriteU16BE(at.mon + Gen1Layout::MonCurrentHpRel, static_cast<u16>(newHp));
+        }
+    }
+
+    if (c.TouchesPp()) {
+        for (std::size_t k = 0; k < 4; ++k) {
+            const u8 oldMove = b.ReadU8(at.mon + Gen1Layout::MonMovesRel + k);
+            const u8 ppByte = b.ReadU8(at.mon + Gen1Layout::MonPPRel + k);
+            const u8 move = c.moves ? (*c.moves)[k] : oldMove;
+            const bool changed = move != oldMove;
+
+            u8 ups = c.ppUps ? (*c.ppUps)[k] : changed ? 0 : static_cast<u8>(ppByte >> 6);
+            u8 pp = 0;
+            if (move == 0) {
+                ups = 0;
+            } else {
+                const u8 maxPp = Gen1Stats::MaxPp(move, ups);
+                pp = (changed || c.restorePp) ? maxPp : std::min<u8>(ppByte & 0x3F, maxPp);
+            }
+            if (changed) b.WriteU8(at.mon + Gen1Layout::MonMovesRel + k, move);
+            b.WriteU8(at.mon + Gen1Layout::MonPPRel + k, static_cast<u8>((ups << 6) | pp));
+        }
+    }
+    return EditMessage(EditStatus::Ok, "");
 }
 
 EditMessage WriteOnlyData::ApplyPokemonEdit(const PokemonEditRequest& req, EditLog* log) {
-    (void)req;
-    (void)log;
-    return EditMessage(EditStatus::InvalidArgument, "Pokémon edits not implemented yet (placeholder).");
+    return Transact([&](bool& requested) { return ApplyPokemonFields(req, log, requested); }, log);
+}
+
+EditMessage WriteOnlyData::ApplyBulkPokemonEdit(const PokemonBulkEditRequest& req, EditLog* log) {
+    return Transact([&](bool& requested) { return ApplyBulkPokemonFields(req, log, requested); }, log);
+}
+
+EditMessage WriteOnlyData::ApplyPokemonFields(const PokemonEditRequest& req, EditLog* log, bool& requested) {
+    const char* label = "ApplyPokemonEdit";
+
+    // Resolve the block: party, the bank 1 copy of the current box, or a bank 2/3 box.
+    const bool party = req.kind == PokemonSlotKind::Party;
+    std::size_t base = 0;
+    if (party) {
+        base = Gen1Layout::PartyOff;
+    } else if (req.kind == PokemonSlotKind::CurrentBox) {
+        base = Gen1Layout::CurrentBoxDataOff;
+    } else {
+        if (req.boxIndex1to12 < 1 || req.boxIndex1to12 > 12) {
+            return Logged(log, label, EditMessage(EditStatus::OutOfRange, "Box index must be 1..12."));
+        }
+        base = Gen1Layout::BoxBaseOffsetByIndex1to12(req.boxIndex1to12);
+    }
+
+    const int maxMons = party ? Gen1Layout::PartyMaxMons : Gen1Layout::BoxMaxMons;
+    const int count = buffer_.ReadU8(base);
+    if (count > maxMons) {
+        return Logged(log, label, EditMessage(EditStatus::InvalidSave, "Pokémon count byte is out of range."));
+    }
+    if (req.slotIndex0to19 < 0 || req.slotIndex0to19 >= count) {
+        std::ostringstream oss;
+        oss << "Slot " << req.slotIndex0to19 << " is empty (" << count << " Pokémon stored).";
+        return Logged(log, label, EditMessage(EditStatus::OutOfRange, oss.str()));
+    }
+
+    // Validate everything before the first write.
+    MonChanges changes;
+    changes.species = req.newSpeciesId;
+    changes.level = req.newLevel;
+    changes.dvs = req.newDVs;
+    changes.statExp = req.newStatExp;
+    changes.moves = req.newMoves;
+    changes.ppUps = req.newPpUps;
+    changes.restorePp = req.restorePp;
+
+    const auto valid = ValidateMonChanges(changes);
+    if (!valid.Ok()) return Logged(log, label, valid);
+    for (const auto* name : {&req.newNickname, &req.newOtName}) {
+        if (!name->has_value()) continue;
+        const auto v = ValidateGen1Name(**name, Gen1Layout::NameFieldLen);
+        if (!v.Ok()) return Logged(log, label, v);
+    }
+
+    if (!changes.Any() && !req.newNickname && !req.newOtName) {
+        return Logged(log, label, EditMessage(EditStatus::Ok, "No Pokémon fields requested."));
+    }
+    requested = true;
+
+    const std::size_t slot = static_cast<std::size_t>(req.slotIndex0to19);
+    const std::size_t nameRel = slot * Gen1Layout::NameFieldLen;
+
+    if (changes.Any()) {
+        const auto applied = ApplyMonChanges(buffer_, MonSlotAt(base, slot, party), changes);
+        if (!applied.Ok()) return Logged(log, label, applied);
+    }
+    if (req.newOtName) {
+        const std::size_t rel = party ? Gen1Layout::PartyOTNamesRel : Gen1Layout::BoxOTNamesRel;
+        Gen1TextCodec::EncodeName(buffer_, base + rel + nameRel, Gen1Layout::NameFieldLen, UpperAscii(*req.newOtName));
+    }
+    if (req.newNickname) {
+        const std::size_t rel = party ? Gen1Layout::PartyNicknamesRel : Gen1Layout::BoxNicknamesRel;
+        Gen1TextCodec::EncodeName(buffer_, base + rel + nameRel, Gen1Layout::NameFieldLen, UpperAscii(*req.newNickname));
+    }
+
+    std::ostringstream oss;
+    oss << (party ? "Party" : req.kind == PokemonSlotKind::CurrentBox ? "Current box" : "Box ");
+    if (req.kind == PokemonSlotKind::PCBox) oss << req.boxIndex1to12;
+    oss << " slot " << req.slotIndex0to19 << " updated.";
+    return Logged(log, label, EditMessage(EditStatus::Ok, oss.str()));
+}
+
+EditMessage WriteOnlyData::ApplyBulkPokemonFields(const PokemonBulkEditRequest& req, EditLog* log, bool& requested) {
+    const char* label = "ApplyBulkPokemonEdit";
+
+    MonChanges changes;
+    changes.level = req.newLevel;
+    changes.dvs = req.newDVs;
+    changes.statExp = req.newStatExp;
+    changes.ppUps = req.newPpUps;
+    changes.restorePp = req.restorePp;
+
+    const auto valid = ValidateMonChanges(changes);
+    if (!valid.Ok()) return Logged(log, label, valid);
+    if (!changes.Any()) return Logged(log, label, EditMessage(EditStatus::Ok, "No Pokémon fields requested."));
+
+    // Blocks in address order: party, current box copy, then boxes 1..12.
+    std::vector<std::pair<std::size_t, bool>> blocks;
+    if (req.scope != PokemonScope::PCBoxes) blocks.emplace_back(Gen1Layout::PartyOff, true);
+    if (req.scope != PokemonScope::Party) {
+        blocks.emplace_back(Gen1Layout::CurrentBoxDataOff, false);
+        for (int box = 1; box <= 12; ++box) blocks.emplace_back(Gen1Layout::BoxBaseOffsetByIndex1to12(box), false);
+    }
+
+    // Check every count byte before writing anything.
+    for (const auto& [block, party] : blocks) {
+        if (buffer_.ReadU8(block) > (party ? Gen1Layout::PartyMaxMons : Gen1Layout::BoxMaxMons)) {
+            std::ostringstream oss;
+            oss << "Pokémon count byte at 0x" << std::hex << block << " is out of range.";
+            return Logged(log, label, EditMessage(EditStatus::InvalidSave, oss.str()));
+        }
+    }
+    requested = true;
+
+    std::size_t edited = 0;
+    std::size_t skipped = 0;
+    for (const auto& [block, party] : blocks) {
+        const std::size_t count = buffer_.ReadU8(block);
+        for (std::size_t slot = 0; slot < count; ++slot) {
+            const MonSlot at = MonSlotAt(block, slot, party);
+            if (changes.NeedsStats() && !Gen1Stats::ForSpecies(buffer_.ReadU8(at.mon + Gen1Layout::MonSpeciesRel))) {
+                ++skipped;
+                continue;
+            }
+            const auto applied = ApplyMonChanges(buffer_, at, changes);
+            if (!applied.Ok()) return Logged(log, label, applied);
+            ++edited;
+        }
+    }
+
+    std::ostringstream oss;
+    oss << edited << " Pokémon updated";
+    if (skipped) oss << " (" << skipped << " skipped: no base stats)";
+    oss << ".";
+    return Logged(log, label, EditMessage(EditStatus::Ok, oss.str()));
 }
 
 EditMessage WriteOnlyData::FixChecksums(EditLog* log) {
@@ -215,6 +661,26 @@ EditMessage WriteOnlyData::FixChecksums(EditLog* log) {
     return EditMessage(EditStatus::Ok, "Main checksum repaired.");
 }
 
+EditMessage WriteOnlyData::FixDirtyChecksums(const std::array<bool, ChecksumDomainSums::DomainCount>& dirty) {
+    Gen1Checksum::FixMain(buffer_);
+
+    int boxes = 0;
+    bool bankDirty[2] = {false, false};
+    for (int box = 1; box <= 12; ++box) {
+        if (!dirty[static_cast<std::size_t>(box)]) continue;
+        Gen1Checksum::FixBox(buffer_, box);
+        bankDirty[box <= 6 ? 0 : 1] = true;
+        ++boxes;
+    }
+    if (bankDirty[0]) Gen1Checksum::FixBankAll(buffer_, 2);
+    if (bankDirty[1]) Gen1Checksum::FixBankAll(buffer_, 3);
+
+    if (boxes == 0) return EditMessage(EditStatus::Ok, "Main checksum repaired.");
+    std::ostringstream oss;
+    oss << "Main checksum and " << boxes << " box checksum(s) repaired.";
+    return EditMessage(EditStatus::Ok, oss.str());
+}
+
 EditMessage WriteOnlyData::Validate() const {
     // Minimal validation. You can expand later.
     if (buffer_.Size() != 0x8000) {
@@ -294,7 +760,7 @@ EditMessage WriteOnlyData::ValidateItemId(u8 itemId, bool allowInvalidIds) {
         return EditMessage(EditStatus::InvalidItemId, "Invalid item ID (0x00/0xFF)." );
     }
 
-    if (!allowInvalidIds && Gen1ItemLookup::NameFromId(itemId) == "INVALID") {
+    if (!allowInvalidIds && Gen1ItemLookup::NameViewFromId(itemId) == "INVALID") {
         return EditMessage(EditStatus::InvalidItemId, "Invalid item ID (lookup says INVALID)." );
     }
 
@@ -313,73 +779,60 @@ EditMessage WriteOnlyData::ValidateQuantity(u8 qty, u8 minQty, u8 maxQty) {
 }
 
 EditMessage WriteOnlyData::WriteTrainerNameBytes(const std::string& name) {
-    Gen1TextCodec::EncodeName(buffer_, Gen1Layout::TrainerNameOff, Gen1Layout::TrainerNameLen, UpperAscii(name));
+    TrainerNameField::Write(buffer_, UpperAscii(name));
     return EditMessage(EditStatus::Ok, "");
 }
 
 EditMessage WriteOnlyData::WriteRivalNameBytes(const std::string& name) {
-    Gen1TextCodec::EncodeName(buffer_, Gen1Layout::RivalNameOff, Gen1Layout::RivalNameLen, UpperAscii(name));
+    RivalNameField::Write(buffer_, UpperAscii(name));
     return EditMessage(EditStatus::Ok, "");
 }
 
-WriteOnlyData::ListRegion WriteOnlyData::RegionFor(ItemListKind kind) {
-    ListRegion r;
-
-    if (kind == ItemListKind::Bag) {
-        r.base = Gen1Layout::BagItemsOff;
-        r.len = Gen1Layout::BagItemsLen;
-        r.countOff = Gen1Layout::BagItemsCountOff;
-        r.pairsOff = Gen1Layout::BagItemsPairsOff;
-        r.maxPairs = Gen1Layout::BagItemsMaxPairs;
-    } else {
-        r.base = Gen1Layout::PCItemBoxOff;
-        r.len = Gen1Layout::PCItemBoxLen;
-        r.countOff = Gen1Layout::PCItemBoxCountOff;
-        r.pairsOff = Gen1Layout::PCItemBoxPairsOff;
-        r.maxPairs = Gen1Layout::PCItemBoxMaxPairs;
-    }
-
-    return r;
+const FieldDescriptor& WriteOnlyData::RegionFor(ItemListKind kind) {
+    return Gen1Fields::Get(kind == ItemListKind::Bag ? Gen1Field::BagItems : Gen1Field::PCItemBox);
 }
 
-std::vector<ItemStack> WriteOnlyData::ReadItemListInternal(const ListRegion& r, bool includeNamesAndHex) const {
+std::vector<ItemStack> WriteOnlyData::ReadItemListInternal(const FieldDescriptor& list, bool includeNamesAndHex) const {
     std::vector<ItemStack> out;
 
-    buffer_.RequireRange(r.base, r.len);
-
-    const u8 rawCount = buffer_.ReadU8(r.countOff);
-    const int count = std::clamp<int>(static_cast<int>(rawCount), 0, r.maxPairs);
-
-    std::size_t off = r.pairsOff;
-    for (int i = 0; i < count; ++i) {
-        buffer_.RequireRange(off, 2);
-
-        const u8 itemId = buffer_.ReadU8(off + 0);
-        const u8 qty    = buffer_.ReadU8(off + 1);
-
-        if (itemId == 0xFF) break;
-
+    const Gen1ItemList items(buffer_.View().Subspan(list.off, list.len), list.count);
+    out.reserve(static_cast<std::size_t>(items.Size()));
+    items.ForEach([&](u8 itemId, u8 qty) {
         ItemStack it;
         it.itemId = itemId;
         it.quantity = qty;
 
         if (includeNamesAndHex) {
-            it.itemName = Gen1ItemLookup::NameFromId(itemId);
+            it.itemName = Gen1ItemLookup::NameViewFromId(itemId);
             it.itemHex  = Gen1ItemLookup::ItemHex[static_cast<std::size_t>(itemId)];
         }
 
         out.push_back(std::move(it));
-        off += 2;
-    }
+    });
 
     return out;
 }
 
-EditMessage WriteOnlyData::WriteItemListInternal(const ListRegion& r, const std::vector<ItemStack>& items, EditLog* log) {
-    (void)r;
-    (void)items;
-    (void)log;
-    return EditMessage(EditStatus::InvalidArgument, "WriteItemListInternal not implemented yet (next step)." );
+EditMessage WriteOnlyData::WriteItemListInternal(const FieldDescriptor& list, const std::vector<ItemStack>& items) {
+    if (items.size() > list.count) {
+        std::ostringstream oss;
+        oss << "List is full (max " << list.count << " items).";
+        return EditMessage(EditStatus::ListFull, oss.str());
+    }
+
+    // [count][(itemId, qty) * count][0xFF]; bytes past the terminator are left as-is.
+    std::vector<u8> bytes;
+    bytes.reserve(2 + 2 * items.size());
+    bytes.push_back(static_cast<u8>(items.size()));
+    for (const ItemStack& it : items) {
+        bytes.push_back(it.itemId);
+        bytes.push_back(it.quantity);
+    }
+    bytes.push_back(0xFF);
+
+    buffer_.RequireRange(list.off, list.len);
+    buffer_.WriteBytes(list.off, bytes);
+    return EditMessage(EditStatus::Ok, "");
 }
 
 } // namespace savegenie
@@ -5,18 +5,1001 @@
 //  Purpose:
 //   - Reader-only test harness.
 //   - Flow: Load save -> backup -> validate -> dump readable summary.
+//   - `batch` mode runs the same summary over many files (see BatchScanner).
+//   - `bench` mode runs the benchmark suite on synthetic saves (see Benchmark).
+//   - `gen` mode writes a synthetic save corpus (see SaveGenerator); `batch
+//     --generate N` scans one in memory instead.
+//   - `batch --stream FILE|-` scans saves out of one stream: concatenated
+//     frames, a tar, or a stored zip (see SaveStream).
+//   - `patch` mode diffs two saves into a SavePatch, or applies one to many saves.
+//   - `index` maintains a CorpusIndex over a save store and searches it.
+//   - `export` writes many saves into one columnar file (see ColumnarExport).
+//   - `serve` runs the Unix-socket daemon (see SaveServer); `client` talks to it.
+//
+//  Usage:
+//   SaveGenie                                  (single hardcoded save, below)
+//   SaveGenie batch [--threads N] [--backup] [--no-recursive] [--no-mmap]
+//                   [--async-io auto|io_uring|threads] [--io-depth N]
+//                   [--checksum-kernel auto|scalar|sse2|avx2|neon]
+//                   [--format text|ndjson|binary] [--cache DIR] [--metrics FILE|-]
+//                   [--where EXPR] [--select EXPR,...] <file|dir|glob>...
+//   SaveGenie batch [batch options] --generate N [generator options]
+//   SaveGenie batch [batch options] --stream FILE|- [--stream-format auto|raw|tar|zip]
+//                   [--frame-size N] [--stream-depth N]
+//   SaveGenie gen --count N --out DIR [--threads N] [generator options]
+//     generator options: --seed S, --party R, --box-fill R, --hof R, --bag R,
+//     --pc-items R, --dex R, --flags R (R = "N" or "LO-HI"),
+//     --corrupt-rate P (0..1), --corruption flip-byte|main-checksum|box-checksum|truncate
+//   SaveGenie bench [--filter SUBSTR] [--min-time SECONDS] [--format text|ndjson|binary]
+//   SaveGenie patch diff <before.sav> <after.sav> [--out FILE]
+//   SaveGenie patch apply <patch> [--threads N] [--async-io auto|io_uring|threads] [--io-depth N]
+//                         <file|dir|glob>...
+//   SaveGenie index update --index FILE [--threads N] [--no-recursive] <file|dir|glob>...
+//   SaveGenie index find --index FILE [--id N] [--name S] [--rival S] [--owns DEX]
+//                        [--min-owned N] [--min-seen N] [--min-badges N] [--all]
+//                        [--format text|ndjson|binary]
+//   SaveGenie export write --out FILE [--threads N] [--row-group N] [--no-recursive] <file|dir|glob>...
+//   SaveGenie export dump [--format text|ndjson|binary] FILE
+//   SaveGenie serve --socket PATH [--workers N] [--max-batch N] [--max-connections N]
+//   SaveGenie client --socket PATH ping|stats
+//   SaveGenie client --socket PATH summary [--format full|text|ndjson|binary] <file>
+//   SaveGenie client --socket PATH edit --script FILE [--out FILE] <file>
 //
 
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include "AsyncFileIO.hpp"
+#include "BatchScanner.hpp"
+#include "Benchmark.hpp"
+#include "ChecksumKernels.hpp"
+#include "ColumnarExport.hpp"
+#include "CorpusIndex.hpp"
 #include "FileManipulation.hpp"
+#include "Instrumentation.hpp"
 #include "SaveStructure.hpp"
 #include "ReadOnlyData.hpp"
+#include "SaveGenerator.hpp"
+#include "SavePatch.hpp"
+#include "SaveQuery.hpp"
+#include "SaveServer.hpp"
+#include "SaveStream.hpp"
+#include "SummarySink.hpp"
+#include "WorkStealingPool.hpp"
+
+namespace {
+
+void PrintUsage() {
+    std::cerr << "Usage:\n"
+              << "  SaveGenie\n"
+              << "  SaveGenie batch [--threads N] [--backup] [--no-recursive] [--no-mmap]\n"
+              << "                  [--async-io auto|io_uring|threads] [--io-depth N]\n"
+              << "                  [--checksum-kernel auto|scalar|sse2|avx2|neon]\n"
+              << "                  [--format text|ndjson|binary] [--cache DIR] [--metrics FILE|-]\n"
+              << "                  [--where EXPR] [--select EXPR,...] <file|dir|glob>...\n"
+              << "  SaveGenie batch [batch options] --generate N [generator options]\n"
+              << "  SaveGenie batch [batch options] --stream FILE|- [--stream-format auto|raw|tar|zip]\n"
+              << "                  [--frame-size N] [--stream-depth N]\n"
+              << "  SaveGenie gen --count N --out DIR [--threads N] [generator options]\n"
+              << "    generator options: --seed S --party R --box-fill R --hof R --bag R --pc-items R\n"
+              << "                       --dex R --flags R (R = N or LO-HI) --corrupt-rate P\n"
+              << "                       --corruption flip-byte|main-checksum|box-checksum|truncate\n"
+              << "  SaveGenie bench [--filter SUBSTR] [--min-time SECONDS] [--format text|ndjson|binary]\n"
+              << "  SaveGenie patch diff <before.sav> <after.sav> [--out FILE]\n"
+              << "  SaveGenie patch apply <patch> [--threads N] [--async-io auto|io_uring|threads] [--io-depth N]\n"
+              << "                        <file|dir|glob>...\n"
+              << "  SaveGenie index update --index FILE [--threads N] [--no-recursive] <file|dir|glob>...\n"
+              << "  SaveGenie index find --index FILE [--id N] [--name S] [--rival S] [--owns DEX]\n"
+              << "                       [--min-owned N] [--min-seen N] [--min-badges N] [--all]\n"
+              << "                       [--format text|ndjson|binary]\n"
+              << "  SaveGenie export write --out FILE [--threads N] [--row-group N] [--no-recursive]\n"
+              << "                         <file|dir|glob>...\n"
+              << "  SaveGenie export dump [--format text|ndjson|binary] FILE\n"
+              << "  SaveGenie serve --socket PATH [--workers N] [--max-batch N] [--max-connections N]\n"
+              << "  SaveGenie client --socket PATH ping|stats\n"
+              << "  SaveGenie client --socket PATH summary [--format full|text|ndjson|binary] <file>\n"
+              << "  SaveGenie client --socket PATH edit --script FILE [--out FILE] <file>\n";
+}
+
+// "N" or "LO-HI" (decimal, LO <= HI). Throws std::invalid_argument otherwise;
+// the limits per option are checked by SaveGenerator.
+savegenie::IntRange ParseRange(const std::string& s) {
+    const auto number = [&](const std::string& part) {
+        if (part.empty() || part.size() > 6 || part.find_first_not_of("0123456789") != std::string::npos) {
+            throw std::invalid_argument("bad range: " + s);
+        }
+        return std::stoi(part);
+    };
+    const std::size_t dash = s.find('-');
+    if (dash == std::string::npos) {
+        const int v = number(s);
+        return {v, v};
+    }
+    const savegenie::IntRange r{number(s.substr(0, dash)), number(s.substr(dash + 1))};
+    if (r.lo > r.hi) throw std::invalid_argument("bad range (LO > HI): " + s);
+    return r;
+}
+
+// Builds the generator for `spec`, or prints a usage error (nullopt).
+std::optional<savegenie::SaveGenerator> MakeGenerator(const savegenie::GeneratorSpec& spec) {
+    try {
+        return savegenie::SaveGenerator(spec);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "[ERROR] " << e.what() << "\n";
+        PrintUsage();
+        return std::nullopt;
+    }
+}
+
+// Consumes one generator option at args[i] (and its value). Returns false if
+// args[i] is not a generator option. Throws std::invalid_argument on bad values.
+bool ParseGeneratorOption(const std::vector<std::string>& args, std::size_t& i, savegenie::GeneratorSpec& spec) {
+    using namespace savegenie;
+
+    const std::string& a = args[i];
+    if (i + 1 >= args.size()) return false;
+
+    if (a == "--seed") {
+        spec.seed = std::stoull(args[++i]);
+    } else if (a == "--party") {
+        spec.partyMons = ParseRange(args[++i]);
+    } else if (a == "--box-fill") {
+        spec.monsPerBox = ParseRange(args[++i]);
+    } else if (a == "--hof") {
+        spec.hallOfFameRecords = ParseRange(args[++i]);
+    } else if (a == "--bag") {
+        spec.bagItems = ParseRange(args[++i]);
+    } else if (a == "--pc-items") {
+        spec.pcItems = ParseRange(args[++i]);
+    } else if (a == "--dex") {
+        spec.dexPercent = ParseRange(args[++i]);
+    } else if (a == "--flags") {
+        spec.flagPercent = ParseRange(args[++i]);
+    } else if (a == "--corrupt-rate") {
+        spec.corruptionRate = std::stod(args[++i]);
+    } else if (a == "--corruption") {
+        spec.corruptionKind = SaveGenerator::ParseCorruption(args[++i]);
+        if (!spec.corruptionKind) throw std::invalid_argument("unknown corruption kind: " + args[i]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int RunBatch(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    BatchOptions opts;
+    GeneratorSpec genSpec;
+    std::optional<std::size_t> generateCount;
+    std::optional<std::string> streamPath;
+    StreamFormat streamFormat = StreamFormat::Auto;
+    std::size_t frameSize = SaveStream::DefaultFrameSize;
+    std::optional<std::string> metricsPath;
+    std::optional<std::string> where;
+    std::optional<std::string> select;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        bool generatorOption = false;
+        try {
+            generatorOption = ParseGeneratorOption(args, i, genSpec);
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "[ERROR] " << e.what() << "\n";
+            PrintUsage();
+            return 2;
+        }
+        if (generatorOption) {
+            continue;
+        } else if (a == "--generate" && i + 1 < args.size()) {
+            generateCount = static_cast<std::size_t>(std::stoull(args[++i]));
+        } else if (a == "--stream" && i + 1 < args.size()) {
+            streamPath = args[++i];
+        } else if (a == "--stream-format" && i + 1 < args.size()) {
+            const auto f = SaveStream::ParseFormat(args[++i]);
+            if (!f) {
+                PrintUsage();
+                return 2;
+            }
+            streamFormat = *f;
+        } else if (a == "--frame-size" && i + 1 < args.size()) {
+            // Decimal or 0x-prefixed (0x8000, 0x802C). Every frame in the ring is this big.
+            const std::string& text = args[++i];
+            std::size_t used = 0;
+            unsigned long v = 0;
+            try {
+                v = std::stoul(text, &used, 0);
+            } catch (const std::exception&) {
+                used = 0;
+            }
+            if (used == 0 || used != text.size() || text[0] == '-' || v == 0 || v > SaveStream::MaxMemberSize) {
+                std::cerr << "[ERROR] --frame-size must be within 1.." << SaveStream::MaxMemberSize << ": " << text << "\n";
+                PrintUsage();
+                return 2;
+            }
+            frameSize = static_cast<std::size_t>(v);
+        } else if (a == "--stream-depth" && i + 1 < args.size()) {
+            opts.streamDepth = static_cast<std::size_t>(std::stoul(args[++i]));
+        } else if (a == "--threads" && i + 1 < args.size()) {
+            opts.threads = static_cast<unsigned>(std::stoul(args[++i]));
+        } else if (a == "--backup") {
+            opts.makeBackups = true;
+        } else if (a == "--no-recursive") {
+            opts.recursive = false;
+        } else if (a == "--no-mmap") {
+            opts.useMmap = false;
+        } else if (a == "--async-io" && i + 1 < args.size()) {
+            opts.asyncIo = AsyncLoader::ParseBackend(args[++i]);
+            if (!opts.asyncIo) {
+                PrintUsage();
+                return 2;
+            }
+        } else if (a == "--io-depth" && i + 1 < args.size()) {
+            opts.ioDepth = static_cast<std::size_t>(std::stoul(args[++i]));
+        } else if (a == "--checksum-kernel" && i + 1 < args.size()) {
+            const auto kind = ChecksumKernels::Parse(args[++i]);
+            if (!kind) {
+                PrintUsage();
+                return 2;
+            }
+            ChecksumKernels::Select(*kind);
+        } else if (a == "--format" && i + 1 < args.size()) {
+            opts.format = SummarySink::ParseFormat(args[++i]);
+            if (!opts.format) {
+                PrintUsage();
+                return 2;
+            }
+        } else if (a == "--cache" && i + 1 < args.size()) {
+            opts.cacheDir = args[++i];
+        } else if (a == "--metrics" && i + 1 < args.size()) {
+            metricsPath = args[++i];
+        } else if (a == "--where" && i + 1 < args.size()) {
+            where = args[++i];
+        } else if (a == "--select" && i + 1 < args.size()) {
+            select = args[++i];
+        } else if (!a.empty() && a[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else {
+            opts.inputs.push_back(a);
+        }
+    }
+
+    // Exactly one source: paths, --generate or --stream.
+    if (!opts.inputs.empty() + !!generateCount + !!streamPath != 1) {
+        PrintUsage();
+        return 2;
+    }
+
+    if (where || select) {
+        try {
+            opts.query = std::make_shared<const SaveQuery>(SaveQuery::Compile(where.value_or(""), select.value_or("")));
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "[ERROR] " << e.what() << "\nQuery fields and functions:\n" << SaveQuery::Reference();
+            return 2;
+        }
+        if (!opts.format) opts.format = SummaryFormat::Text;
+        const std::string reads = opts.query->Describe();
+        std::cerr << "Query reads: " << (reads.empty() ? "nothing (paths only)" : reads) << "\n";
+    }
+
+    Instrumentation::Reset();
+
+    // Structured records go straight to fd 1 in large writes (no iostream).
+    OutputBuffer records(opts.format ? 1 : -1);
+
+    const auto emit = [&](const BatchFileResult& r) {
+        if (!r.ok) {
+            std::cerr << "[ERROR] " << r.path << ": " << r.error << "\n";
+        }
+        if (opts.format) {
+            if (!r.matched) return;
+            records.Append(r.output);
+            records.RecordBoundary();
+        } else if (r.ok) {
+            std::cout << r.output << "\n";
+        }
+    };
+    BatchStats stats;
+    if (generateCount) {
+        const auto generator = MakeGenerator(genSpec);
+        if (!generator) return 2;
+        stats = BatchScanner::RunGenerated(opts, *generator, *generateCount, emit);
+    } else if (streamPath) {
+        SaveStream stream(*streamPath, streamFormat, frameSize);
+        stats = BatchScanner::RunStream(opts, stream, emit);
+    } else {
+        stats = BatchScanner::Run(opts, emit);
+    }
+
+    records.Flush();
+    std::cout.flush();
+    std::cerr << stats.ToString() << "\n";
+
+    if (metricsPath) {
+        if (!Instrumentation::Enabled) {
+            std::cerr << "[WARN] instrumentation is compiled out; rebuild with -DSAVEGENIE_INSTRUMENTATION=1\n";
+        }
+        const std::string metrics = Instrumentation::Snapshot().ToPrometheus();
+        if (*metricsPath == "-") {
+            std::cerr << metrics;
+        } else {
+            std::ofstream out(*metricsPath, std::ios::trunc);
+            out << metrics;
+            if (!out) {
+                std::cerr << "[ERROR] could not write metrics to " << *metricsPath << "\n";
+                return 1;
+            }
+        }
+    }
+    return stats.filesFailed == 0 ? 0 : 1;
+}
+
+int RunGen(const std::vector<std::string>& args) {
+    using namespace savegenie;
+    namespace fs = std::filesystem;
+    using Clock = std::chrono::steady_clock;
+
+    GeneratorSpec spec;
+    std::size_t count = 0;
+    unsigned threads = 0;
+    std::string outDir;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        bool generatorOption = false;
+        try {
+            generatorOption = ParseGeneratorOption(args, i, spec);
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "[ERROR] " << e.what() << "\n";
+            PrintUsage();
+            return 2;
+        }
+        if (generatorOption) {
+            continue;
+        } else if (a == "--count" && i + 1 < args.size()) {
+            count = static_cast<std::size_t>(std::stoull(args[++i]));
+        } else if (a == "--out" && i + 1 < args.size()) {
+            outDir = args[++i];
+        } else if (a == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<unsigned>(std::stoul(args[++i]));
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (outDir.empty() || count == 0) {
+        PrintUsage();
+        return 2;
+    }
+
+    const auto made = MakeGenerator(spec);
+    if (!made) return 2;
+    const SaveGenerator& generator = *made;
+    threads = WorkStealingPool::ResolveThreadCount(threads);
+
+    // 1000 saves per shard directory: <out>/0042/gen_0042017.sav
+    constexpr std::size_t kShard = 1000;
+    auto shardName = [](std::size_t shard) {
+        std::string s = std::to_string(shard);
+        return std::string(s.size() < 4 ? 4 - s.size() : 0, '0') + s;
+    };
+    for (std::size_t shard = 0; shard * kShard < count; ++shard) {
+        fs::create_directories(fs::path(outDir) / shardName(shard));
+    }
+
+    const auto t0 = Clock::now();
+    std::vector<SaveBuffer> buffers(threads);
+    std::vector<std::size_t> corrupted(threads, 0);
+    WorkStealingPool::ParallelFor(count, threads, [&](unsigned w, std::size_t i) {
+        if (generator.Generate(i, buffers[w]) != SaveCorruption::None) corrupted[w]++;
+        std::string name = BatchScanner::GeneratedName(i);
+        name[3] = '_'; // "gen:0000001" -> "gen_0000001", safe on every filesystem
+        const fs::path path = fs::path(outDir) / shardName(i / kShard) / (name + ".sav");
+        FileManipulation::WriteFile(path.string(), buffers[w].BytesView());
+    });
+    const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    std::size_t corruptedTotal = 0;
+    for (std::size_t c : corrupted) corruptedTotal += c;
+    std::cerr << "Generated " << count << " save(s) (" << corruptedTotal << " corrupted) into " << outDir
+              << " on " << threads << " thread(s) in " << std::fixed << std::setprecision(3) << seconds << "s"
+              << " -> " << std::setprecision(1) << (seconds > 0.0 ? static_cast<double>(count) / seconds : 0.0)
+              << " saves/sec\n";
+    return 0;
+}
+
+int RunBench(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    BenchOptions opts;
+    SummaryFormat format = SummaryFormat::Ndjson;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--filter" && i + 1 < args.size()) {
+            opts.filter = args[++i];
+        } else if (a == "--min-time" && i + 1 < args.size()) {
+            opts.minSeconds = std::stod(args[++i]);
+        } else if (a == "--format" && i + 1 < args.size()) {
+            const auto f = SummarySink::ParseFormat(args[++i]);
+            if (!f) {
+                PrintUsage();
+                return 2;
+            }
+            format = *f;
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    // One record per result, flushed to fd 1 as they are measured.
+    OutputBuffer records(1, 0);
+    const auto sink = SummarySink::Create(format, records);
+
+    std::size_t count = 0;
+    Benchmark::RunAll(opts, [&](const BenchResult& r) {
+        sink->BeginRecord();
+        r.WriteTo(*sink);
+        sink->EndRecord();
+        ++count;
+    });
+
+    records.Flush();
+    std::cerr << "Ran " << count << " benchmark(s) (kernel: "
+              << ChecksumKernels::Name(ChecksumKernels::Active()) << ")\n";
+    return 0;
+}
+
+// `patch diff`: store an edit as a SavePatch instead of a full (EDITED) copy.
+int RunPatchDiff(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    std::vector<std::string> files;
+    std::string outPath;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        if (args[i] == "--out" && i + 1 < args.size()) {
+            outPath = args[++i];
+        } else {
+            files.push_back(args[i]);
+        }
+    }
+    if (files.size() != 2) {
+        PrintUsage();
+        return 2;
+    }
+    if (outPath.empty()) outPath = FileManipulation::MakePatchPath(files[0]);
+
+    const SaveBuffer before(FileManipulation::LoadFile(files[0]));
+    const SaveBuffer after(FileManipulation::LoadFile(files[1]));
+    const SavePatch patch = SavePatch::Diff(before, after);
+    const std::vector<u8> encoded = patch.Serialize();
+    FileManipulation::WriteFile(outPath, encoded, Durability::Synced);
+
+    std::cerr << "Wrote " << outPath << ": " << patch.Runs().size() << " run(s), " << patch.RunBytes()
+              << " byte(s), " << patch.Checksums().size() << " checksum byte(s), " << encoded.size()
+              << " bytes encoded\n";
+    return 0;
+}
+
+// `patch apply`: one parsed patch, many targets; each result goes to "(EDITED) <file>".
+int RunPatchApply(const std::vector<std::string>& args) {
+    using namespace savegenie;
+    using Clock = std::chrono::steady_clock;
+
+    std::string patchPath;
+    std::vector<std::string> inputs;
+    unsigned threads = 0;
+    std::optional<IoBackend> asyncIo;
+    std::size_t ioDepth = AsyncLoader::DefaultDepth;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<unsigned>(std::stoul(args[++i]));
+        } else if (a == "--async-io" && i + 1 < args.size()) {
+            asyncIo = AsyncLoader::ParseBackend(args[++i]);
+            if (!asyncIo) {
+                PrintUsage();
+                return 2;
+            }
+        } else if (a == "--io-depth" && i + 1 < args.size()) {
+            ioDepth = static_cast<std::size_t>(std::stoul(args[++i]));
+        } else if (!a.empty() && a[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else if (patchPath.empty()) {
+            patchPath = a;
+        } else {
+            inputs.push_back(a);
+        }
+    }
+    if (patchPath.empty() || inputs.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    const SavePatch patch = SavePatch::Parse(FileManipulation::LoadFile(patchPath));
+    const std::vector<std::string> files = BatchScanner::CollectInputs(inputs, true);
+    threads = WorkStealingPool::ResolveThreadCount(threads);
+
+    const auto t0 = Clock::now();
+    std::vector<SaveBuffer> buffers(threads);
+    std::vector<PatchStatus> status(files.size(), PatchStatus::Conflict);
+    std::vector<std::string> errors(files.size());
+    if (asyncIo) {
+        // Reads and "(EDITED)" writes overlap the patching; tickets are settled at the end.
+        std::vector<WriteTicket> writes(files.size());
+        {
+            AsyncLoader loader(files, ioDepth, *asyncIo);
+            AsyncWriter writer(ioDepth);
+            WorkStealingPool::ParallelFor(threads, threads, [&](unsigned w, std::size_t) {
+                LoadedFile file;
+                while (loader.Next(file)) {
+                    const std::size_t i = file.index;
+                    if (!file.error.empty()) {
+                        errors[i] = file.error;
+                    } else {
+                        std::swap(buffers[w].BytesMutable(), file.bytes);
+                        status[i] = patch.Apply(buffers[w]);
+                        if (status[i] == PatchStatus::Applied) {
+                            writes[i] = writer.Submit(AsyncWriter::Mode::Replace,
+                                                      FileManipulation::MakeEditedPath(files[i]),
+                                                      buffers[w].BytesView());
+                        }
+                    }
+                    loader.Recycle(std::move(file));
+                    file = LoadedFile();
+                }
+            });
+        }
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            if (!writes[i].valid()) continue;
+            try {
+                writes[i].get();
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        }
+    } else {
+        WorkStealingPool::ParallelFor(files.size(), threads, [&](unsigned w, std::size_t i) {
+            try {
+                FileManipulation::LoadFileInto(files[i], buffers[w].BytesMutable());
+                status[i] = patch.Apply(buffers[w]);
+                if (status[i] == PatchStatus::Applied) {
+                    FileManipulation::WriteFile(FileManipulation::MakeEditedPath(files[i]), buffers[w].BytesView());
+                }
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        });
+    }
+    // The "(EDITED)" writes skip the per-file directory fsync; flush each output directory's filesystem once.
+    std::set<std::string> outputDirs;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (status[i] == PatchStatus::Applied && errors[i].empty()) {
+            outputDirs.insert(std::filesystem::path(files[i]).parent_path().string());
+        }
+    }
+    for (const std::string& dir : outputDirs) FileManipulation::SyncFileSystem(dir.empty() ? "." : dir);
+    const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
 
-int main() {
+    std::size_t counts[4] = {0, 0, 0, 0};
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (!errors[i].empty()) {
+            std::cerr << "[ERROR] " << files[i] << ": " << errors[i] << "\n";
+            ++failed;
+            continue;
+        }
+        counts[static_cast<std::size_t>(status[i])]++;
+        if (status[i] == PatchStatus::Conflict || status[i] == PatchStatus::SizeMismatch) {
+            std::cerr << "[SKIP] " << files[i] << ": " << SavePatch::StatusName(status[i]) << "\n";
+        }
+    }
+
+    std::cerr << "Patched " << files.size() << " file(s) in " << std::fixed << std::setprecision(3) << seconds
+              << "s: " << counts[0] << " applied, " << counts[1] << " already applied, " << counts[3]
+              << " conflict(s), " << counts[2] << " size mismatch(es), " << failed << " error(s)\n";
+    return (failed == 0 && counts[2] == 0 && counts[3] == 0) ? 0 : 1;
+}
+
+int RunPatch(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        PrintUsage();
+        return 2;
+    }
+    const std::vector<std::string> rest(args.begin() + 1, args.end());
+    if (args[0] == "diff") return RunPatchDiff(rest);
+    if (args[0] == "apply") return RunPatchApply(rest);
+    PrintUsage();
+    return 2;
+}
+
+int RunIndexUpdate(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    std::string indexPath;
+    IndexUpdateOptions opts;
+    std::vector<std::string> inputs;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--index" && i + 1 < args.size()) {
+            indexPath = args[++i];
+        } else if (a == "--threads" && i + 1 < args.size()) {
+            opts.threads = static_cast<unsigned>(std::stoul(args[++i]));
+        } else if (a == "--no-recursive") {
+            opts.recursive = false;
+        } else if (!a.empty() && a[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else {
+            inputs.push_back(a);
+        }
+    }
+    if (indexPath.empty() || inputs.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    const IndexUpdateStats stats = CorpusIndex::Update(indexPath, inputs, opts);
+    std::cerr << stats.ToString() << "\n";
+    return 0;
+}
+
+int RunIndexFind(const std::vector<std::string>& args) {
     using namespace savegenie;
 
+    std::string indexPath;
+    IndexFilter filter;
+    SummaryFormat format = SummaryFormat::Text;
+    // A number within lo..hi (decimal or 0x hex), or nullopt after a usage error.
+    const auto number = [](const std::string& option, const std::string& text, unsigned long lo,
+                           unsigned long hi) -> std::optional<unsigned long> {
+        std::size_t used = 0;
+        unsigned long v = 0;
+        try {
+            v = std::stoul(text, &used, 0);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != text.size() || text[0] == '-' || v < lo || v > hi) {
+            std::cerr << "[ERROR] " << option << " must be a number in " << lo << ".." << hi << ": " << text << "\n";
+            PrintUsage();
+            return std::nullopt;
+        }
+        return v;
+    };
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        std::optional<unsigned long> v;
+        if (a == "--index" && i + 1 < args.size()) {
+            indexPath = args[++i];
+        } else if (a == "--id" && i + 1 < args.size()) {
+            if (!(v = number(a, args[++i], 0, 0xFFFF))) return 2;
+            filter.trainerId = static_cast<std::uint16_t>(*v);
+        } else if (a == "--name" && i + 1 < args.size()) {
+            filter.trainerName = args[++i];
+        } else if (a == "--rival" && i + 1 < args.size()) {
+            filter.rivalName = args[++i];
+        } else if (a == "--owns" && i + 1 < args.size()) {
+            if (!(v = number(a, args[++i], 1, Gen1Layout::PokedexSpeciesCount))) return 2;
+            filter.ownsDex = static_cast<std::size_t>(*v);
+        } else if (a == "--min-owned" && i + 1 < args.size()) {
+            if (!(v = number(a, args[++i], 0, Gen1Layout::PokedexSpeciesCount))) return 2;
+            filter.minOwned = static_cast<std::size_t>(*v);
+        } else if (a == "--min-seen" && i + 1 < args.size()) {
+            if (!(v = number(a, args[++i], 0, Gen1Layout::PokedexSpeciesCount))) return 2;
+            filter.minSeen = static_cast<std::size_t>(*v);
+        } else if (a == "--min-badges" && i + 1 < args.size()) {
+            if (!(v = number(a, args[++i], 0, 8))) return 2;
+            filter.minBadges = static_cast<std::size_t>(*v);
+        } else if (a == "--all") {
+            filter.okOnly = false;
+        } else if (a == "--format" && i + 1 < args.size()) {
+            const auto f = SummarySink::ParseFormat(args[++i]);
+            if (!f) {
+                PrintUsage();
+                return 2;
+            }
+            format = *f;
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (indexPath.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const CorpusIndex index = CorpusIndex::Open(indexPath);
+    const std::vector<std::size_t> rows = index.Find(filter);
+
+    OutputBuffer out(1);
+    const auto sink = SummarySink::Create(format, out);
+    for (std::size_t row : rows) {
+        const IndexRow r = index.Row(row);
+        sink->BeginRecord();
+        sink->String("path", r.path);
+        sink->Bool("ok", r.ok);
+        sink->Uint("trainerId", r.trainerId);
+        sink->String("name", r.trainerName);
+        sink->String("rival", r.rivalName);
+        sink->Uint("badges", r.badges);
+        sink->Uint("money", r.money);
+        sink->Uint("dexOwned", r.owned.Count());
+        sink->Uint("dexSeen", r.seen.Count());
+        sink->EndRecord();
+        out.RecordBoundary();
+    }
+    out.Flush();
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::cerr << "Found " << rows.size() << " of " << index.Size() << " save(s) in " << std::fixed
+              << std::setprecision(2) << ms << " ms\n";
+    return 0;
+}
+
+int RunIndex(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        PrintUsage();
+        return 2;
+    }
+    const std::vector<std::string> rest(args.begin() + 1, args.end());
+    if (args[0] == "update") return RunIndexUpdate(rest);
+    if (args[0] == "find") return RunIndexFind(rest);
+    PrintUsage();
+    return 2;
+}
+
+int RunExportWrite(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    ExportOptions opts;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--out" && i + 1 < args.size()) {
+            opts.outPath = args[++i];
+        } else if (a == "--threads" && i + 1 < args.size()) {
+            opts.threads = static_cast<unsigned>(std::stoul(args[++i]));
+        } else if (a == "--row-group" && i + 1 < args.size()) {
+            opts.rowGroupRows = static_cast<std::size_t>(std::stoul(args[++i]));
+        } else if (a == "--no-recursive") {
+            opts.recursive = false;
+        } else if (!a.empty() && a[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else {
+            opts.inputs.push_back(a);
+        }
+    }
+    if (opts.outPath.empty() || opts.inputs.empty() || opts.rowGroupRows == 0) {
+        PrintUsage();
+        return 2;
+    }
+
+    const ExportStats stats = ColumnarExport::Run(opts);
+    std::cerr << stats.ToString() << "\n";
+    return 0;
+}
+
+int RunExportDump(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    std::string path;
+    SummaryFormat format = SummaryFormat::Text;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--format" && i + 1 < args.size()) {
+            const auto f = SummarySink::ParseFormat(args[++i]);
+            if (!f) {
+                PrintUsage();
+                return 2;
+            }
+            format = *f;
+        } else if (!a.empty() && a[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else if (path.empty()) {
+            path = a;
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (path.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    const ColumnarReader reader = ColumnarReader::Open(path);
+    OutputBuffer out(1);
+    const auto sink = SummarySink::Create(format, out);
+    reader.WriteRecords(*sink, &out);
+    out.Flush();
+    std::cerr << "Read " << reader.Rows() << " row(s) in " << reader.RowGroupCount() << " row group(s)\n";
+    return 0;
+}
+
+int RunExport(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        PrintUsage();
+        return 2;
+    }
+    const std::vector<std::string> rest(args.begin() + 1, args.end());
+    if (args[0] == "write") return RunExportWrite(rest);
+    if (args[0] == "dump") return RunExportDump(rest);
+    PrintUsage();
+    return 2;
+}
+
+// The server being run by `serve`, for the signal handler.
+savegenie::SaveServer* gServer = nullptr;
+
+extern "C" void StopServer(int) {
+    if (gServer) gServer->Stop();
+}
+
+int RunServe(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    ServerOptions opts;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--socket" && i + 1 < args.size()) {
+            opts.socketPath = args[++i];
+        } else if (a == "--workers" && i + 1 < args.size()) {
+            opts.workers = static_cast<unsigned>(std::stoul(args[++i]));
+        } else if (a == "--max-batch" && i + 1 < args.size()) {
+            opts.maxBatch = static_cast<std::size_t>(std::stoul(args[++i]));
+        } else if (a == "--max-connections" && i + 1 < args.size()) {
+            opts.maxConnections = static_cast<std::size_t>(std::stoul(args[++i]));
+            if (opts.maxConnections == 0) {
+                PrintUsage();
+                return 2;
+            }
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (opts.socketPath.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    SaveServer server(opts);
+    gServer = &server;
+    std::signal(SIGINT, StopServer);
+    std::signal(SIGTERM, StopServer);
+
+    std::cerr << "Serving on " << opts.socketPath << " ("
+              << WorkStealingPool::ResolveThreadCount(opts.workers) << " worker(s)); Ctrl-C to stop\n";
+    server.Run();
+    gServer = nullptr;
+    std::cerr << "Server stopped\n";
+    return 0;
+}
+
+int RunClient(const std::vector<std::string>& args) {
+    using namespace savegenie;
+
+    std::string socketPath;
+    std::string op;
+    std::string scriptPath;
+    std::string outPath;
+    std::string formatName = "full";
+    std::vector<std::string> files;
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& a = args[i];
+        if (a == "--socket" && i + 1 < args.size()) {
+            socketPath = args[++i];
+        } else if (a == "--script" && i + 1 < args.size()) {
+            scriptPath = args[++i];
+        } else if (a == "--out" && i + 1 < args.size()) {
+            outPath = args[++i];
+        } else if (a == "--format" && i + 1 < args.size()) {
+            formatName = args[++i];
+        } else if (!a.empty() && a[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else if (op.empty()) {
+            op = a;
+        } else {
+            files.push_back(a);
+        }
+    }
+
+    const bool needsFile = (op == "summary" || op == "edit");
+    if (socketPath.empty() || files.size() != (needsFile ? 1u : 0u) ||
+        (op == "edit" && scriptPath.empty())) {
+        PrintUsage();
+        return 2;
+    }
+
+    SaveClient client(socketPath);
+    SaveClient::Response r;
+    if (op == "ping") {
+        r = client.Ping();
+    } else if (op == "stats") {
+        r = client.Stats();
+    } else if (op == "summary") {
+        std::uint8_t format = SummaryTextFormat;
+        if (formatName != "full") {
+            const auto f = SummarySink::ParseFormat(formatName);
+            if (!f) {
+                PrintUsage();
+                return 2;
+            }
+            format = static_cast<std::uint8_t>(*f);
+        }
+        r = client.Summary(format, FileManipulation::LoadFile(files[0]));
+    } else if (op == "edit") {
+        const std::vector<u8> script = FileManipulation::LoadFile(scriptPath);
+        r = client.Edit(std::string_view(reinterpret_cast<const char*>(script.data()), script.size()),
+                        FileManipulation::LoadFile(files[0]));
+        if (r.Ok()) {
+            std::string log;
+            std::vector<u8> edited;
+            SaveClient::SplitEditBody(r.body, log, edited);
+            if (outPath.empty()) outPath = FileManipulation::MakeEditedPath(files[0]);
+            FileManipulation::WriteFile(outPath, edited, Durability::Synced);
+            std::cout << log;
+            std::cerr << "Wrote " << outPath << "\n";
+            return 0;
+        }
+    } else {
+        PrintUsage();
+        return 2;
+    }
+
+    if (!r.Ok()) {
+        std::cerr << "[" << SaveClient::StatusName(r.status) << "] " << r.Text() << "\n";
+        return 1;
+    }
+    if (op == "ping") {
+        std::cout << "pong\n";
+    } else {
+        std::cout << r.Text();
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace savegenie;
+
+    if (argc > 1) {
+        const std::string mode = argv[1];
+        const std::vector<std::string> args(argv + 2, argv + argc);
+        try {
+            if (mode == "batch") return RunBatch(args);
+            if (mode == "bench") return RunBench(args);
+            if (mode == "gen") return RunGen(args);
+            if (mode == "patch") return RunPatch(args);
+            if (mode == "index") return RunIndex(args);
+            if (mode == "export") return RunExport(args);
+            if (mode == "serve") return RunServe(args);
+            if (mode == "client") return RunClient(args);
+        } catch (const std::exception& e) {
+            std::cerr << "[FATAL] " << e.what() << "\n";
+            return 1;
+        }
+        PrintUsage();
+        return 2;
+    }
+
     // ------------------------------------------------------------
     // NOTE:
     // Replace the filename below with your own legally obtained
@@ -31,16 +1014,14 @@ int main() {
         "Pokemon - Red Version (USA, Europe) (SGB Enhanced).sav";
 
     try {
-        // 1) Create backup (safe)
-        const std::string backupPath = FileManipulation::BackupFile(inputPath);
-
-        // 2) Load bytes
-        FileManipulation::Bytes bytes = FileManipulation::LoadFile(inputPath);
+        // 1) Load bytes and create the backup from them (one read, safe)
+        FileManipulation::Bytes bytes;
+        const std::string backupPath = FileManipulation::LoadFileWithBackup(inputPath, bytes);
 
-        // 3) Wrap in SaveBuffer (safe access)
+        // 2) Wrap in SaveBuffer (safe access)
         SaveBuffer save(std::move(bytes));
 
-        // 4) Validate basic properties
+        // 3) Validate basic properties
         std::cout << "Input:  " << inputPath << "\n";
         std::cout << "Backup: " << backupPath << "\n";
         std::cout << "Size:   0x" << std::hex << save.Size() << std::dec << " bytes\n";
@@ -53,9 +1034,10 @@ int main() {
                   << (SaveValidator::HasValidMainChecksum(save) ? "VALID" : "INVALID")
                   << "\n\n";
 
-        // 5) Dump readable summary
+        // 4) Dump readable summary
         ReadOnlyData reader(save);
         std::cout << reader.DumpFullSummary() << "\n";
+        std::cout << reader.GetParty().ToString() << "\n";
 
         return 0;
     } catch (const std::exception& e) {
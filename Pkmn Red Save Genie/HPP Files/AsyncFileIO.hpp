@@ -0,0 +1,165 @@
+//
+//  AsyncFileIO.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Asynchronous load / write stages for the batch tools, so parse workers
+//     are handed finished buffers instead of blocking on every read and write.
+//   - AsyncLoader keeps a bounded number of whole-file reads in flight
+//     (io_uring on Linux, a small pool of reader threads elsewhere or when
+//     io_uring is unavailable) and delivers them in completion order.
+//   - AsyncWriter runs "(EDITED)" / "(BACKUP)" writes on dedicated I/O threads.
+//
+//  Owns:
+//   - The io_uring ring (raw syscalls, no liburing) and the reader threads.
+//   - Buffer recycling: delivered buffers come back through Recycle(), so a
+//     long run allocates at most `depth` of them.
+//   - Back-pressure: reads stop when `depth` buffers are out; Submit() blocks
+//     when `depth` writes are queued.
+//
+//  Does NOT:
+//   - Parse or validate saves (the caller does, on its own threads).
+//   - Define the write protocol (AsyncWriter calls FileManipulation, so every
+//     write is still fsync'd temp file + rename; callers sync once when done).
+//
+
+#ifndef AsyncFileIO_hpp
+#define AsyncFileIO_hpp
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace savegenie {
+
+enum class IoBackend {
+    Auto = 0, // io_uring if the kernel allows it, otherwise Threads
+    IoUring,  // Linux only; falls back to Threads if the ring cannot be set up
+    Threads,  // blocking reads on a few reader threads
+};
+
+// One finished read. `error` is non-empty if the file could not be read
+// (then `bytes` is empty).
+class LoadedFile {
+public:
+    std::size_t index = 0; // position in the loader's path list
+    std::vector<std::uint8_t> bytes;
+    std::string error;
+};
+
+class AsyncLoader {
+public:
+    static constexpr std::size_t DefaultDepth = 64;
+
+    // Starts reading immediately. `paths` must outlive the loader.
+    // depth = maximum buffers in flight or waiting for Recycle() (at least 1).
+    AsyncLoader(const std::vector<std::string>& paths, std::size_t depth = DefaultDepth,
+                IoBackend backend = IoBackend::Auto);
+
+    // Stops issuing reads, waits for the ones in flight, joins the I/O threads.
+    ~AsyncLoader();
+
+    AsyncLoader(const AsyncLoader&) = delete;
+    AsyncLoader& operator=(const AsyncLoader&) = delete;
+
+    // Block until the next read completes (any order). Returns false once every
+    // path has been delivered. Thread-safe: parse workers call it concurrently.
+    bool Next(LoadedFile& out);
+
+    // Hand a delivered file back; its buffer is reused for a later read and its
+    // in-flight slot is released. Every file from Next() must come back here.
+    void Recycle(LoadedFile&& done);
+
+    // The backend actually in use (never Auto).
+    IoBackend Backend() const { return backend_; }
+
+    // "auto", "io_uring", "threads".
+    static const char* BackendName(IoBackend backend);
+    static std::optional<IoBackend> ParseBackend(std::string_view name);
+
+private:
+    const std::vector<std::string>& paths_;
+    std::size_t depth_ = DefaultDepth;
+    IoBackend backend_ = IoBackend::Threads;
+
+    std::mutex mu_;
+    std::condition_variable readyCv_;  // ready_ gained a file, or the run ended
+    std::condition_variable creditCv_; // credits_ grew, or stop_
+    std::deque<LoadedFile> ready_;
+    std::vector<std::vector<std::uint8_t>> spare_; // recycled buffers
+    std::size_t credits_ = 0;  // reads that may still be started
+    std::size_t nextPath_ = 0; // thread backend: next index to claim
+    std::size_t delivered_ = 0;
+    std::size_t readersLeft_ = 0;
+    bool stop_ = false;
+
+    class Ring; // io_uring instance (AsyncFileIO.cpp)
+    std::unique_ptr<Ring> ring_;
+    std::vector<std::thread> threads_;
+
+    // Shared by both backends (each takes mu_).
+    bool AcquireCredit(bool wait);
+    std::vector<std::uint8_t> TakeBuffer();
+    void Complete(LoadedFile&& file);
+    void ReaderExited();
+
+    void RunThreadReader();
+    void RunUringReader();
+};
+
+// Completion of one write. get() rethrows the write's std::runtime_error.
+using WriteTicket = std::future<void>;
+
+class AsyncWriter {
+public:
+    enum class Mode {
+        Replace, // FileManipulation::WriteFile(path, bytes)
+        Backup,  // FileManipulation::BackupFromBytes(path, bytes): writes "(BACKUP) <path>"
+    };
+
+    static constexpr std::size_t DefaultDepth = 64;
+    static constexpr unsigned DefaultThreads = 4;
+
+    explicit AsyncWriter(std::size_t depth = DefaultDepth, unsigned threads = DefaultThreads);
+
+    // Finishes every queued write, then joins.
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    // Queue a write (blocks while `depth` writes are pending). The writer owns
+    // `bytes` until the ticket is ready.
+    WriteTicket Submit(Mode mode, std::string path, std::vector<std::uint8_t> bytes);
+
+private:
+    struct Job {
+        Mode mode = Mode::Replace;
+        std::string path;
+        std::vector<std::uint8_t> bytes;
+        std::promise<void> done;
+    };
+
+    std::size_t depth_ = DefaultDepth;
+    std::mutex mu_;
+    std::condition_variable workCv_;  // jobs_ non-empty, or closing_
+    std::condition_variable spaceCv_; // jobs_ below depth_
+    std::deque<Job> jobs_;
+    bool closing_ = false;
+    std::vector<std::thread> threads_;
+
+    void RunWorker();
+};
+
+} // namespace savegenie
+
+#endif /* AsyncFileIO_hpp */
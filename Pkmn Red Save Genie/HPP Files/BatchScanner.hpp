@@ -0,0 +1,167 @@
+//
+//  BatchScanner.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Batch (corpus) mode: run the read-only summary over many .sav files at once.
+//   - Expands directories / globs into a sorted file list and spreads it across
+//     a WorkStealingPool, one block of inputs at a time so the results waiting
+//     to be emitted stay bounded.
+//   - Can also scan SaveGenerator output in memory (load testing without files).
+//   - Can also scan a SaveStream (frames / tar / zip on stdin) through a fixed
+//     ring of buffers, so memory does not grow with the stream.
+//
+//  Owns:
+//   - Input expansion (files, directories, "dir/*.sav" style globs).
+//   - One SaveBuffer + ReadOnlyData per worker (reused for every file it handles),
+//     or, by default, a zero-copy SaveView over each memory-mapped input.
+//   - Deterministic output: results are emitted in sorted input order no matter
+//     which worker finished first.
+//   - Throughput statistics (files/sec).
+//   - Optional structured records (NDJSON / binary / text, see SummarySink),
+//     built in a per-worker OutputBuffer instead of the human summary.
+//   - Optional content-addressed result cache (see ResultCache): byte-identical
+//     saves are answered from disk instead of being decoded again.
+//   - Optional asynchronous reads and backups (see AsyncFileIO).
+//   - Optional filter / projection (see SaveQuery): only matching saves get a
+//     record, and it holds just the selected columns.
+//
+//  Does NOT:
+//   - Edit saves (read-only, like the default main() flow).
+//   - Decide the output medium (the caller's emit callback does).
+//
+
+#ifndef BatchScanner_hpp
+#define BatchScanner_hpp
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "AsyncFileIO.hpp"
+#include "SummarySink.hpp"
+
+namespace savegenie {
+
+class SaveGenerator;
+class SaveQuery;
+class SaveStream;
+
+class BatchOptions {
+public:
+    // Files, directories, or globs ("*" / "?" in the filename part).
+    std::vector<std::string> inputs;
+
+    // 0 = one worker per hardware thread.
+    unsigned threads = 0;
+
+    // Walk directories recursively.
+    bool recursive = true;
+
+    // Create "(BACKUP) <file>" next to each input before reading it (same as main()).
+    bool makeBackups = false;
+
+    // Read inputs through MappedFile + SaveView instead of copying them into the
+    // worker's SaveBuffer (no per-file heap allocation for the 32 KiB payload).
+    bool useMmap = true;
+
+    // Set: read through an AsyncLoader (up to ioDepth reads in flight, handed to
+    // workers in completion order) and write backups through an AsyncWriter.
+    // useMmap is ignored.
+    std::optional<IoBackend> asyncIo;
+    std::size_t ioDepth = AsyncLoader::DefaultDepth;
+
+    // Unset: the human DumpFullSummary() text. Set: one structured record per
+    // file ({path, ok, size, ...summary} or {path, ok=false, error}).
+    std::optional<SummaryFormat> format;
+
+    // Non-empty: ResultCache directory. Summaries are looked up by SaveDigest
+    // before decoding and stored after a miss (one entry per output format).
+    std::string cacheDir;
+
+    // Set: evaluate this query instead of building the summary. Matching saves
+    // get a {path, ...selected columns} record (format defaults to text);
+    // others get none. cacheDir is ignored.
+    std::shared_ptr<const SaveQuery> query;
+
+    // RunStream only: frames read ahead of the one being emitted (0 = 4 per
+    // worker). Bounds memory at about streamDepth + threads saves.
+    std::size_t streamDepth = 0;
+};
+
+class BatchFileResult {
+public:
+    std::size_t index = 0;   // position in the sorted input list
+    std::string path;
+    bool ok = false;
+    bool matched = true;     // false: filtered out by BatchOptions::query (output is empty)
+    std::size_t sizeBytes = 0;
+    std::string output;      // summary text or structured record (records are emitted for failures too)
+    std::string error;       // error message when !ok
+};
+
+class BatchStats {
+public:
+    std::size_t filesTotal = 0;
+    std::size_t filesFailed = 0;
+    std::size_t bytesRead = 0;
+    unsigned threads = 0;
+    double seconds = 0.0;
+
+    // Only counted when BatchOptions::cacheDir is set.
+    bool cacheEnabled = false;
+    std::size_t cacheHits = 0;
+    std::size_t cacheMisses = 0;
+
+    // Async I/O backend in use ("io_uring" / "threads"); empty for synchronous reads.
+    std::string ioBackend;
+
+    // Only counted when BatchOptions::query is set.
+    bool queryEnabled = false;
+    std::size_t filesMatched = 0;
+
+    double FilesPerSecond() const;
+    std::string ToString() const;
+};
+
+class BatchScanner {
+public:
+    using EmitFn = std::function<void(const BatchFileResult&)>;
+
+    // Expand inputs into a sorted, de-duplicated list of save files.
+    // Directory walks pick up *.sav and skip our own "(BACKUP) " / "(EDITED) " outputs.
+    // Throws std::runtime_error if an explicit input does not exist.
+    static std::vector<std::string> CollectInputs(const std::vector<std::string>& inputs, bool recursive);
+
+    // Scan every input. `emit` is invoked on the calling thread, once per file,
+    // strictly in sorted input order. Results are released as soon as they are emitted,
+    // and workers run at most a few results per worker ahead of the emitter, so memory
+    // does not grow with the number of inputs.
+    static BatchStats Run(const BatchOptions& opts, const EmitFn& emit);
+
+    // Scan saves #0..count-1 of `generator` in memory (nothing touches the disk;
+    // inputs / recursive / makeBackups / useMmap are ignored). Each worker
+    // generates straight into its own buffer. Results are named GeneratedName(i).
+    static BatchStats RunGenerated(const BatchOptions& opts, const SaveGenerator& generator, std::size_t count,
+                                   const EmitFn& emit);
+
+    // Scan every save in `stream` as it arrives (inputs / recursive / makeBackups /
+    // useMmap / asyncIo are ignored). Archive members are filtered like a
+    // directory walk. Results are emitted in stream order and named
+    // StreamFrame::name; per-entry stream errors become failed results.
+    // Rethrows a fatal stream error after emitting everything read before it.
+    static BatchStats RunStream(const BatchOptions& opts, SaveStream& stream, const EmitFn& emit);
+
+    // "gen:0000042" (7+ digits, so names sort in index order up to 10M saves).
+    static std::string GeneratedName(std::size_t index);
+
+    // Simple '*' / '?' wildcard match (used for glob inputs).
+    static bool WildcardMatch(const std::string& pattern, const std::string& text);
+};
+
+} // namespace savegenie
+
+#endif /* BatchScanner_hpp */
@@ -0,0 +1,80 @@
+//
+//  Benchmark.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Micro / macro benchmarks for the hot paths (checksums and kernels, text
+//     and BCD codecs, every ReadOnlyData::Get*, full summaries, WriteOnlyData::Apply).
+//   - Runs against a fixed set of synthetic saves, so numbers are comparable
+//     across machines and commits without shipping real save files.
+//
+//  Owns:
+//   - The synthetic save set (SaveGenerator specs pinned to fixed values).
+//   - Timing calibration (iterations grow until a batch runs >= minSeconds).
+//   - Allocation counting: this translation unit replaces the global
+//     operator new/delete with malloc/free plus a thread-local counter, so
+//     allocations/op is exact for the benchmarked call on the calling thread.
+//
+//  Does NOT:
+//   - Format output (results go to a SummarySink, NDJSON by default in main()).
+//   - Compare against previous runs (diff the NDJSON instead).
+//
+
+#ifndef Benchmark_hpp
+#define Benchmark_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+class SummarySink;
+
+class BenchOptions {
+public:
+    // Minimum wall time of the measured batch, per benchmark and save.
+    double minSeconds = 0.1;
+
+    // Only run benchmarks whose name contains this substring (empty = all).
+    std::string filter;
+};
+
+class BenchResult {
+public:
+    std::string name;          // e.g. "reader.GetBoxStats"
+    std::string save;          // synthetic save name, e.g. "full"
+    std::uint64_t iterations = 0;
+    double nsPerOp = 0.0;
+    double allocsPerOp = 0.0;
+    std::size_t bytesPerOp = 0; // bytes consumed per op (0 = not a byte-range op)
+    double mbPerSec = 0.0;      // bytesPerOp throughput in MB/s (10^6), 0 if bytesPerOp == 0
+
+    void WriteTo(SummarySink& sink) const;
+};
+
+class Benchmark {
+public:
+    using ReportFn = std::function<void(const BenchResult&)>;
+
+    // Runs every benchmark against every synthetic save; `report` is called as
+    // each result is measured (in a fixed order).
+    static void RunAll(const BenchOptions& opts, const ReportFn& report);
+
+    // The fixed benchmark inputs: "blank" (new game), "typical" (a partial party,
+    // random box fill, a few Hall of Fame entries), "full" (every list and box
+    // at capacity). All checksums are valid.
+    static std::vector<std::pair<std::string, SaveBuffer>> SyntheticSaves();
+
+    // Heap allocations made by the calling thread so far.
+    static std::uint64_t ThreadAllocations();
+};
+
+} // namespace savegenie
+
+#endif /* Benchmark_hpp */
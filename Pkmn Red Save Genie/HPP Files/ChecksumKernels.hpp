@@ -0,0 +1,62 @@
+//
+//  ChecksumKernels.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Byte-sum kernels behind Gen1Checksum (every Gen I checksum is "sum bytes, invert low byte").
+//   - Scalar fallback plus SIMD paths: SSE2 / AVX2 (psadbw) on x86, NEON on ARM.
+//
+//  Owns:
+//   - CPU feature detection and runtime kernel selection.
+//   - Raw span summation (callers range-check once, then hand over the span).
+//
+//  Does NOT:
+//   - Know checksum ranges or where checksums are stored (see Gen1Checksum).
+//
+
+#ifndef ChecksumKernels_hpp
+#define ChecksumKernels_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace savegenie {
+
+enum class ChecksumKernelKind {
+    Auto = 0,   // best supported kernel for this CPU
+    Scalar,
+    SSE2,
+    AVX2,
+    NEON,
+};
+
+class ChecksumKernels {
+public:
+    // Sum all bytes with the active kernel. Result is exact (no truncation) for
+    // spans up to 16 MiB, far beyond any Gen I checksum range.
+    static std::uint32_t Sum(std::span<const std::uint8_t> bytes);
+
+    // Sum with a specific kernel (benchmarks / cross-checks).
+    // Throws std::invalid_argument if the kernel is not supported on this CPU.
+    static std::uint32_t SumWith(ChecksumKernelKind kind, std::span<const std::uint8_t> bytes);
+
+    // Select the kernel used by Sum(). Auto picks the fastest supported one.
+    // Throws std::invalid_argument if the kernel is not supported on this CPU.
+    static void Select(ChecksumKernelKind kind);
+
+    // Currently active kernel (never Auto; Auto is resolved on selection / first use).
+    static ChecksumKernelKind Active();
+
+    static bool IsSupported(ChecksumKernelKind kind);
+
+    // "auto", "scalar", "sse2", "avx2", "neon".
+    static const char* Name(ChecksumKernelKind kind);
+    static std::optional<ChecksumKernelKind> Parse(std::string_view name);
+};
+
+} // namespace savegenie
+
+#endif /* ChecksumKernels_hpp */
@@ -0,0 +1,274 @@
+//
+//  ColumnarExport.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Bulk export of per-save records for analytics loaders:
+//       export write --out corpus.sgcol ./uploads
+//   - Column-major, in row groups (64K saves by default): trainer summary,
+//     per-box stats, bag / PC item stacks, Pokédex and event-flag bitsets,
+//     checksums, Hall of Fame teams. Nested data is stored Arrow-style as a
+//     u32 offsets column plus flat child columns.
+//   - Species, item and map fields hold the Gen I ids; their names are stored
+//     once per file in dictionaries (the Gen1*Lookup tables), not per row.
+//
+//  Owns:
+//   - The column schema (ExportSchema::Columns) and the file layout (below).
+//   - Row building (ExportRows, one per worker) and row-group writing.
+//   - Reading a file back (ColumnarReader), including a record dump through
+//     any SummarySink so the format can be checked without other tools.
+//
+//  Does NOT:
+//   - Write Parquet / Arrow IPC themselves (no such library in the tree). The
+//     layout maps 1:1 onto Arrow arrays (fixed-width buffers, fixed-size
+//     lists, utf8 and list offsets), so a converter is a loop over columns.
+//   - Compress: the columns are small fixed-width ints that general-purpose
+//     compressors (zstd, gzip) shrink well if the file is shipped.
+//
+
+#ifndef ColumnarExport_hpp
+#define ColumnarExport_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FileManipulation.hpp"
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+class SaveSnapshot;
+class OutputBuffer;
+class SummarySink;
+
+enum class ColumnType : std::uint8_t {
+    UInt8 = 0,
+    UInt16,
+    UInt32,
+    Float64,
+    Bytes,  // `width` raw bytes per value (bitsets)
+    Utf8,   // u32 offsets (values + 1), then the characters
+    List,   // u32 offsets (values + 1) into the child columns
+};
+
+enum class ExportDictionary : std::int8_t {
+    None = -1,
+    Species = 0, // internal species id -> name
+    Item,
+    Map,
+};
+inline constexpr std::size_t ExportDictionaryCount = 3;
+
+// One column. Values live at the row level (parent = -1) or under a List
+// column (one value per list element). Fixed-width types may hold `count`
+// values per element (a fixed-size list, e.g. 12 box counts).
+class ColumnSpec {
+public:
+    std::string_view name;
+    ColumnType type = ColumnType::UInt8;
+    std::uint16_t width = 0;       // bytes per value (Bytes: the whole value)
+    std::uint16_t count = 1;
+    std::int16_t parent = -1;      // index of the List column, or -1
+    ExportDictionary dictionary = ExportDictionary::None;
+};
+
+class ExportSchema {
+public:
+    enum class Col : std::uint8_t {
+        Path, Ok, Error, Size,
+        TrainerId, TrainerName, RivalName, Money, Coins, Badges,
+        MapId, X, Y, PlayHours, PlayMinutes, PlaySeconds,
+        DexOwned, DexSeen, EventFlags,
+        MainChecksumStored, MainChecksumComputed,
+        BankChecksumStored, BankChecksumComputed,
+        BoxChecksumStored, BoxChecksumComputed,
+        BoxCount, BoxAverageLevel,
+        Bag, BagItem, BagQuantity,
+        PcItems, PcItem, PcQuantity,
+        HallOfFame, HallOfFameEntry, HallOfFameMons, HallOfFameSpecies, HallOfFameLevel, HallOfFameNickname,
+    };
+    static constexpr std::size_t ColumnCount = static_cast<std::size_t>(Col::HallOfFameNickname) + 1;
+
+    static const std::array<ColumnSpec, ColumnCount> Columns;
+
+    static const ColumnSpec& Get(Col c) { return Columns[static_cast<std::size_t>(c)]; }
+    static std::string_view DictionaryName(ExportDictionary d);
+};
+
+// Column buffers for a run of consecutive rows (one worker's share of a row
+// group). Appending a save never reallocates once the vectors have grown.
+class ExportRows {
+public:
+    ExportRows();
+
+    // A decoded save. `sv` supplies the raw bitsets; `snap` everything else.
+    void Append(std::string_view path, SaveView sv, const SaveSnapshot& snap);
+    // A save that could not be decoded: ok = 0 and empty / zero fields.
+    void AppendFailed(std::string_view path, std::size_t size, std::string_view error);
+
+    // Append `other`'s rows after ours (offsets are rebased).
+    void Extend(const ExportRows& other);
+
+    void Clear();
+
+    std::size_t Rows() const { return rows_; }
+    std::size_t Failed() const { return failed_; }
+
+    // Elements in column c (rows, or list elements for child columns).
+    std::size_t Values(std::size_t c) const;
+    // Appends column c's bytes as stored in a row group (no header).
+    void WriteColumn(std::size_t c, std::vector<std::uint8_t>& out) const;
+
+private:
+    struct Buffer {
+        std::vector<std::uint8_t> data;     // fixed-width values / utf8 characters
+        std::vector<std::uint32_t> offsets; // Utf8 / List only; starts at {0}
+    };
+
+    std::array<Buffer, ExportSchema::ColumnCount> columns_;
+    std::size_t rows_ = 0;
+    std::size_t failed_ = 0;
+
+    Buffer& At(ExportSchema::Col c) { return columns_[static_cast<std::size_t>(c)]; }
+    void Put(ExportSchema::Col c, std::uint64_t v);
+    void PutDouble(ExportSchema::Col c, double v);
+    void PutBytes(ExportSchema::Col c, std::span<const std::uint8_t> bytes);
+    void PutText(ExportSchema::Col c, std::string_view s);
+    void EndList(ExportSchema::Col c, std::size_t elements);
+};
+
+// File layout (little-endian):
+//   "SGCF", u32 FormatVersion
+//   row group*: "SGRG", u32 rows, then per column in schema order:
+//               u64 values, u64 byte length, bytes, zero padding to 8
+//   footer:     u32 column count, per column: u16 name length + name,
+//               u8 type, u16 width, u16 count, i16 parent, i8 dictionary;
+//               u32 dictionary count, per dictionary: u16 name length + name,
+//               u32 entries, per entry u16 length + UTF-8 name (index = id);
+//               u32 row group count, per group: u64 file offset, u32 rows
+//   trailer:    u64 footer offset, "SGCF"
+// Readers locate everything from the trailer, so row groups stream out
+// without seeking back.
+class ColumnarWriter {
+public:
+    static constexpr std::uint32_t FormatVersion = 1;
+    static constexpr std::size_t DefaultRowGroupRows = 65536;
+
+    // Streams through an AtomicFileWriter: a unique temp file next to `path`,
+    // fsync'd and renamed over it in Finish(); an unfinished file is removed.
+    // Throws std::runtime_error if the file cannot be created.
+    explicit ColumnarWriter(std::string path);
+
+    ColumnarWriter(const ColumnarWriter&) = delete;
+    ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+
+    // `parts` in row order form one row group. Empty groups are skipped.
+    void WriteRowGroup(std::span<const ExportRows> parts);
+
+    // Footer, flush, rename. Throws std::runtime_error on I/O errors.
+    void Finish();
+
+    std::uint64_t BytesWritten() const { return offset_; }
+
+private:
+    struct GroupRef {
+        std::uint64_t offset = 0;
+        std::uint32_t rows = 0;
+    };
+
+    AtomicFileWriter out_;
+    std::uint64_t offset_ = 0;
+    std::vector<GroupRef> groups_;
+    std::vector<std::uint8_t> scratch_;
+    ExportRows merged_;
+
+    void Write(std::span<const std::uint8_t> bytes);
+};
+
+// Memory-mapped view of an export file.
+class ColumnarReader {
+public:
+    // One column of one row group.
+    class Chunk {
+    public:
+        std::size_t values = 0;
+        std::span<const std::uint8_t> bytes;
+
+        // Fixed-width value i (element j of a fixed-size list).
+        std::uint64_t UInt(const ColumnSpec& spec, std::size_t i, std::size_t j = 0) const;
+        double Float(const ColumnSpec& spec, std::size_t i, std::size_t j = 0) const;
+        std::span<const std::uint8_t> Raw(const ColumnSpec& spec, std::size_t i) const;
+        // Utf8 / List: offsets[i].
+        std::uint32_t Offset(std::size_t i) const;
+        std::string_view Text(std::size_t i) const;
+    };
+
+    // Throws std::runtime_error if the file is missing or malformed.
+    static ColumnarReader Open(const std::string& path);
+
+    const std::vector<ColumnSpec>& Columns() const { return columns_; }
+    std::size_t RowGroupCount() const { return groups_.size(); }
+    std::size_t RowGroupRows(std::size_t g) const { return groups_[g].rows; }
+    std::size_t Rows() const;
+
+    const Chunk& Column(std::size_t g, std::size_t c) const { return groups_[g].chunks[c]; }
+
+    // Dictionary name for `id`, or "" if the dictionary has no such entry.
+    std::string_view DictionaryEntry(ExportDictionary d, std::size_t id) const;
+
+    // Every row as one sink record: row-level columns in schema order, lists
+    // as arrays of objects, dictionary ids followed by "<name>_name".
+    void WriteRecords(SummarySink& sink, OutputBuffer* out = nullptr) const;
+
+private:
+    struct Group {
+        std::size_t rows = 0;
+        std::vector<Chunk> chunks;
+    };
+
+    MappedFile file_;
+    std::vector<ColumnSpec> columns_; // names and dictionary entries view the mapping
+    std::array<std::vector<std::string_view>, ExportDictionaryCount> dictionaries_;
+    std::vector<Group> groups_;
+
+    void WriteElement(SummarySink& sink, std::size_t g, int parent, std::size_t i) const;
+};
+
+class ExportOptions {
+public:
+    std::vector<std::string> inputs; // files, directories, globs (as for batch)
+    std::string outPath;
+    unsigned threads = 0;            // 0 = one worker per hardware thread
+    bool recursive = true;
+    std::size_t rowGroupRows = ColumnarWriter::DefaultRowGroupRows;
+};
+
+class ExportStats {
+public:
+    std::size_t rows = 0;
+    std::size_t failed = 0;
+    std::size_t rowGroups = 0;
+    std::uint64_t bytesWritten = 0;
+    unsigned threads = 0;
+    double seconds = 0.0;
+
+    std::string ToString() const;
+};
+
+class ColumnarExport {
+public:
+    // Decodes every input (workers take contiguous slices of each row group,
+    // so rows stay in sorted path order) and writes opts.outPath.
+    // Throws std::runtime_error on I/O errors writing the output; unreadable
+    // saves become ok = 0 rows.
+    static ExportStats Run(const ExportOptions& opts);
+};
+
+} // namespace savegenie
+
+#endif /* ColumnarExport_hpp */
@@ -0,0 +1,56 @@
+//
+//  ContentHash.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Fast non-cryptographic content hashing for save deduplication.
+//   - ContentHash::Hash64 is XXH64 (same output as the reference xxHash, seedable).
+//
+//  Owns:
+//   - SaveDigest: one hash per 8 KiB bank plus a whole-save hash derived from
+//     them, so a reader can tell which banks changed between two uploads.
+//
+//  Does NOT:
+//   - Resist deliberate collisions (never use it for authentication).
+//   - Store anything (see ResultCache).
+//
+
+#ifndef ContentHash_hpp
+#define ContentHash_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+class ContentHash {
+public:
+    static std::uint64_t Hash64(std::span<const std::uint8_t> bytes, std::uint64_t seed = 0);
+};
+
+class SaveDigest {
+public:
+    static constexpr std::size_t BankCount = Gen1Layout::ExpectedSize / Gen1Layout::BankSize;
+
+    std::uint64_t whole = 0;                      // identifies the whole buffer (size included)
+    std::array<std::uint64_t, BankCount> banks{}; // bank b = bytes [b * BankSize, (b + 1) * BankSize)
+    std::size_t size = 0;
+
+    // One pass over the bytes. Banks past the end of a short buffer hash the
+    // bytes that exist (possibly none); bytes beyond bank 3 only affect `whole`.
+    static SaveDigest Of(SaveView sv);
+
+    // 16 lowercase hex digits of `whole`.
+    std::string WholeHex() const;
+
+    bool operator==(const SaveDigest&) const = default;
+};
+
+} // namespace savegenie
+
+#endif /* ContentHash_hpp */
@@ -0,0 +1,166 @@
+//
+//  CorpusIndex.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Persistent index over a save store, for the searches that otherwise
+//     rescan every file ("all saves of OT 12345", "dex owned >= 150"):
+//       index update --index store.sgidx ./uploads
+//       index find   --index store.sgidx --id 12345
+//   - One columnar file, memory-mapped for lookups: trainer ID, trainer and
+//     rival names, badges, money, Pokédex owned / seen bitsets, content hash,
+//     plus the file size / mtime used to skip unchanged files on update.
+//
+//  Owns:
+//   - File layout (below), writing it atomically, validating it on open.
+//   - Incremental update: a file whose size and mtime match its row is not
+//     read; one whose bytes hash to the row's hash is not parsed; everything
+//     else is re-read. Rows for paths outside the inputs are kept while their
+//     file exists (so directories can be indexed one at a time); rows for
+//     files that disappeared are dropped. A file that cannot be read gets no
+//     stat info, so the next update tries it again.
+//   - Lookups: trainer ID via a sorted permutation column (binary search),
+//     path via the path-sorted rows, everything else by a column scan.
+//
+//  Does NOT:
+//   - Hold summaries or anything a row does not list (use batch / ResultCache).
+//   - Lock: one updater at a time; readers keep whichever file they mapped.
+//
+
+#ifndef CorpusIndex_hpp
+#define CorpusIndex_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FileManipulation.hpp"
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+// One indexed save. Views point into the mapped index file.
+class IndexRow {
+public:
+    std::string_view path;
+    std::uint64_t fileSize = 0;
+    std::int64_t mtime = 0;        // filesystem clock ticks, only compared for equality
+    std::uint64_t hash = 0;        // SaveDigest::whole
+    bool ok = false;               // false: the save could not be decoded (fields are zero)
+    std::uint16_t trainerId = 0;
+    std::uint8_t badges = 0;
+    std::uint32_t money = 0;
+    std::string_view trainerName;
+    std::string_view rivalName;
+    Gen1Bitset owned;
+    Gen1Bitset seen;
+};
+
+// All set conditions must hold; an empty filter matches every row.
+class IndexFilter {
+public:
+    std::optional<std::uint16_t> trainerId;
+    std::string trainerName;             // case-insensitive exact match
+    std::string rivalName;
+    std::optional<std::size_t> ownsDex;  // dex number 1..151
+    std::size_t minOwned = 0;
+    std::size_t minSeen = 0;
+    std::size_t minBadges = 0;           // badge count
+    bool okOnly = true;                  // skip rows whose save failed to decode
+};
+
+class IndexUpdateOptions {
+public:
+    unsigned threads = 0;   // 0 = one worker per hardware thread
+    bool recursive = true;
+};
+
+class IndexUpdateStats {
+public:
+    std::size_t rows = 0;
+    std::size_t unchanged = 0;  // size + mtime matched: file not read
+    std::size_t rehashed = 0;   // read, same hash: not parsed
+    std::size_t parsed = 0;     // new or changed
+    std::size_t failed = 0;     // parsed, but not a decodable save
+    std::size_t kept = 0;       // outside the inputs, file still present: carried over
+    std::size_t removed = 0;    // rows whose file is gone
+    bool rebuilt = false;       // no usable previous index
+    double seconds = 0.0;
+
+    std::string ToString() const;
+};
+
+// File layout (little-endian):
+//   header  "SGIX", u32 Version, u64 rows, u64 heap offset, u64 heap bytes,
+//           u64 offset[ColumnCount] (each 8-byte aligned)
+//   columns rows x width each, in Column order
+//   heap    path / name bytes referenced by (u32 offset, u32 length) pairs
+// Rows are sorted by path; the ById column is a row permutation sorted by
+// (trainer ID, path).
+class CorpusIndex {
+public:
+    static constexpr std::uint32_t Version = 1;
+
+    enum class Column : std::uint8_t {
+        Path,        // heap ref
+        FileSize,    // u64
+        Mtime,       // i64
+        Hash,        // u64
+        Ok,          // u8
+        TrainerId,   // u16
+        Badges,      // u8
+        Money,       // u32
+        TrainerName, // heap ref
+        RivalName,   // heap ref
+        Owned,       // Gen1Layout::PokedexBitsLen bytes
+        Seen,        // Gen1Layout::PokedexBitsLen bytes
+        ById,        // u32 row number
+    };
+    static constexpr std::size_t ColumnCount = static_cast<std::size_t>(Column::ById) + 1;
+
+    CorpusIndex() = default;
+
+    // Maps and validates an index. Throws std::runtime_error if the file is
+    // missing, from another version, or inconsistent.
+    static CorpusIndex Open(const std::string& path);
+
+    // Brings the index at `indexPath` up to date with `inputs` (files, dirs,
+    // globs, as for batch) and rewrites it atomically. Rows for other paths
+    // are kept if the file still exists. A missing or unusable
+    // index is rebuilt from scratch. Throws std::runtime_error on I/O errors
+    // (unreadable saves become ok = false rows instead).
+    static IndexUpdateStats Update(const std::string& indexPath, const std::vector<std::string>& inputs,
+                                   const IndexUpdateOptions& opts = {});
+
+    std::size_t Size() const { return rows_; }
+    IndexRow Row(std::size_t i) const;
+
+    // Row for `path` (as stored: the CollectInputs spelling), if indexed.
+    std::optional<std::size_t> FindPath(std::string_view path) const;
+
+    // Rows with this trainer ID, in path order. O(log n).
+    std::vector<std::size_t> WithTrainerId(std::uint16_t id) const;
+
+    // Matching rows in path order (uses the ById column when trainerId is set).
+    std::vector<std::size_t> Find(const IndexFilter& filter) const;
+
+    bool Matches(std::size_t row, const IndexFilter& filter) const;
+
+private:
+    MappedFile file_;
+    std::size_t rows_ = 0;
+    std::span<const std::uint8_t> heap_;
+    std::span<const std::uint8_t> columns_[ColumnCount];
+
+    const std::uint8_t* Cell(Column c, std::size_t row, std::size_t width) const;
+    std::string_view Text(Column c, std::size_t row) const;
+    std::uint16_t TrainerIdAt(std::size_t row) const;
+};
+
+} // namespace savegenie
+
+#endif /* CorpusIndex_hpp */
@@ -18,9 +18,14 @@
 //
 //  Owns:
 //   - Reading an entire file into memory (std::vector<uint8_t>)
-//   - Writing a byte buffer to disk (always to a new path)
-//   - Creating a "(BACKUP) <original>.sav" copy of an input file
+//   - Memory-mapping a file read-only (MappedFile) for zero-copy scans
+//   - Writing a byte buffer to disk atomically (fsync'd temp file + rename),
+//     with an opt-in directory fsync for single outputs the user asked for
+//   - Streaming the same way (AtomicFileWriter) for outputs written in pieces
+//   - Creating a "(BACKUP) <original>.sav" copy of an input file, either by
+//     copying on disk or from bytes already in memory (single-read load+backup)
 //   - Creating an "(EDITED) <original>.sav" output path
+//   - Creating a "(PATCH) <original>.sgpatch" output path
 //
 //  Does NOT:
 //   - Know Pokémon offsets/banks/save structure
@@ -28,12 +33,87 @@
 //   - Decode/encode game data
 //
 
+#include <cstddef>
 #include <cstdint>
+#include <fstream>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace savegenie {
 
+// Read-only memory mapping of a whole file (RAII, move-only).
+// On platforms without mmap the file is read into an internal buffer instead,
+// so callers can always treat Bytes() as "the file contents".
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Map `path` read-only. Throws std::runtime_error on failure.
+    // An empty file yields an empty span (nothing is mapped).
+    static MappedFile Open(const std::string& path);
+
+    std::span<const std::uint8_t> Bytes() const { return {data_, size_}; }
+    std::size_t Size() const { return size_; }
+
+    // Unmap now (also done by the destructor).
+    void Reset();
+
+private:
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;                 // true if data_ came from mmap
+    std::vector<std::uint8_t> fallback_;  // used when mmap is unavailable
+};
+
+// How far a write is pushed before it returns.
+enum class Durability {
+    Atomic = 0, // fsync'd temp file + rename: never torn, but the rename may be lost on power failure
+    Synced,     // also fsync the directory, so the new name is on disk before returning
+};
+
+// The write path behind FileManipulation::WriteFile, for outputs streamed out
+// in pieces: bytes go to a uniquely named temp sibling of `path`, and Commit()
+// fsyncs it and renames it over `path`. Until then readers see the old file;
+// a writer destroyed without Commit() removes its temp file.
+class AtomicFileWriter {
+public:
+    // `op` prefixes error messages ("<op> failed: ...").
+    // Throws std::runtime_error if the temp file cannot be created.
+    explicit AtomicFileWriter(std::string path, std::string op = "WriteFile");
+    ~AtomicFileWriter();
+
+    AtomicFileWriter(const AtomicFileWriter&) = delete;
+    AtomicFileWriter& operator=(const AtomicFileWriter&) = delete;
+
+    // Throws std::runtime_error on a write error (the temp file is removed).
+    void Write(std::span<const std::uint8_t> bytes);
+
+    // fsync, close, rename over `path` (plus the directory fsync for Synced).
+    // Throws std::runtime_error on failure (the temp file is removed).
+    void Commit(Durability durability = Durability::Atomic);
+
+private:
+    friend class FileManipulation; // BackupFromBytes publishes with link()
+
+    std::string path_;
+    std::string tmp_;
+    std::string op_;
+    int fd_ = -1;
+    std::ofstream out_; // used where there are no POSIX file descriptors
+    bool open_ = false;
+
+    // fsync + close; returns the temp path, which the caller now owns.
+    std::string Seal();
+    [[noreturn]] void Fail(const char* what, const std::string& reason);
+};
+
 class FileManipulation {
 public:
     using Byte  = std::uint8_t;
@@ -43,9 +123,24 @@ public:
     // Throws std::runtime_error on failure.
     static Bytes LoadFile(const std::string& path);
 
-    // Write an entire byte buffer to disk.
+    // Load an entire file into an existing buffer, reusing its capacity.
+    // Intended for batch workers that reload the same buffer thousands of times.
     // Throws std::runtime_error on failure.
-    static void WriteFile(const std::string& path, const Bytes& bytes);
+    static void LoadFileInto(const std::string& path, Bytes& out);
+
+    // Write an entire byte buffer to disk. The bytes go to a temp file in the
+    // same directory, which is fsync'd and renamed over `path`, so readers (and
+    // a crash) see either the old file or the complete new one, never a torn
+    // write. Synced also fsyncs the directory; bulk writers leave it off and
+    // call SyncFileSystem once at the end.
+    // Throws std::runtime_error on failure (the temp file is removed).
+    static void WriteFile(const std::string& path, std::span<const Byte> bytes,
+                          Durability durability = Durability::Atomic);
+
+    // Flush everything written to the filesystem holding `path`, an existing
+    // file or directory (syncfs(2) where available, else sync(2)). Best
+    // effort; never throws.
+    static void SyncFileSystem(const std::string& path);
 
     // Create a "(BACKUP) <original filename>" copy in the same directory.
     // Example:
@@ -56,6 +151,18 @@ public:
     // Throws std::runtime_error on failure.
     static std::string BackupFile(const std::string& path);
 
+    // Same as BackupFile, but the backup is written from `bytes` (the contents
+    // of `path` the caller already has in memory) instead of re-reading `path`.
+    // An existing backup is kept. Returns the backup file path.
+    // Throws std::runtime_error on failure.
+    static std::string BackupFromBytes(const std::string& path, std::span<const Byte> bytes,
+                                       Durability durability = Durability::Atomic);
+
+    // Single-read load + backup: read `path` once into `out`, then write the
+    // backup from that buffer. Returns the backup file path.
+    // Throws std::runtime_error on failure.
+    static std::string LoadFileWithBackup(const std::string& path, Bytes& out);
+
     // Create the "(EDITED) <original filename>" path in the same directory.
     // This does NOT write the file — it only generates the name.
     // Example:
@@ -64,6 +171,14 @@ public:
     //   "(EDITED) Pokemon - Red Version.sav"
     static std::string MakeEditedPath(const std::string& path);
 
+    // Create the "(PATCH) <original stem>.sgpatch" path in the same directory
+    // (a SavePatch stored instead of a full edited copy). Only generates the name.
+    // Example:
+    //   "Pokemon - Red Version.sav"
+    // becomes
+    //   "(PATCH) Pokemon - Red Version.sgpatch"
+    static std::string MakePatchPath(const std::string& path);
+
     // Derive a backup path from an input path.
     // Internal helper used by BackupFile.
     static std::string MakeBackupPath(const std::string& path);
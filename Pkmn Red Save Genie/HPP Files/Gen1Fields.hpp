@@ -0,0 +1,375 @@
+//
+//  Gen1Fields.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - One constexpr table describing every fixed field of the save: offset,
+//     length, encoding and checksum domain, built from Gen1Layout.
+//   - FieldCodec<F>: reader / writer for one field, specialised at compile
+//     time, so a read is just the load and decode for that encoding.
+//   - Gen1ItemList: the bag / PC item box list format, shared by ReadOnlyData,
+//     WriteOnlyData and the query engine.
+//
+//  Owns:
+//   - Field names (the query language's raw field names are these).
+//   - Compile-time checks on the table: in order, inside the layout, no field
+//     straddling two checksum domains, no duplicate names.
+//   - Table-driven runtime access (ReadNumber / ReadText by field id), one
+//     generated reader per field.
+//
+//  Does NOT:
+//   - Replace Gen1Layout: descriptors are built from its constants, and
+//     per-slot structure offsets (box / party mons) stay there.
+//   - Decide edit policy (ranges, name validation): WriteOnlyData does.
+//
+//  A regional or Yellow layout would be a second table with the same ids.
+//
+
+#ifndef Gen1Fields_hpp
+#define Gen1Fields_hpp
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+// =========================================================
+// Descriptors
+// =========================================================
+
+enum class FieldEncoding : u8 {
+    U8,
+    U16LE,
+    U16BE,
+    U24BE,
+    Bcd,      // packed decimal, two digits per byte (2 or 3 bytes)
+    Text,     // Gen I charset, 0x50-terminated, len includes the terminator
+    Bitset,   // LSB-first bits; count = number of bits
+    ItemList, // [count][(itemId, qty) * n][0xFF]; count = maximum stacks
+};
+
+enum class Gen1Field : u8 {
+    TrainerName,
+    RivalName,
+    TrainerId,
+    Money,
+    Coins,
+    Badges,
+    Options,
+    MapId,
+    XCoord,
+    YCoord,
+    PlayHours,
+    PlayMinutes,
+    PlaySeconds,
+    PlayFrames,
+    PokedexOwned,
+    PokedexSeen,
+    EventFlags,
+    BagItems,
+    PCItemBox,
+    HallOfFameCount,
+    CurrentBoxNumber,
+    PartyCount,
+};
+
+inline constexpr std::size_t Gen1FieldCount = static_cast<std::size_t>(Gen1Field::PartyCount) + 1;
+
+class FieldDescriptor {
+public:
+    Gen1Field id = Gen1Field::TrainerName;
+    std::string_view name;
+    std::size_t off = 0;
+    std::size_t len = 0;
+    FieldEncoding encoding = FieldEncoding::U8;
+    std::size_t count = 0; // Bitset: bits. ItemList: maximum stacks. Otherwise 0.
+    int domain = -1;       // ChecksumDomainSums domain of every byte (-1: not checksummed)
+    std::string_view help;
+
+    constexpr bool IsNumber() const {
+        return encoding == FieldEncoding::U8 || encoding == FieldEncoding::U16LE ||
+               encoding == FieldEncoding::U16BE || encoding == FieldEncoding::U24BE ||
+               encoding == FieldEncoding::Bcd;
+    }
+};
+
+namespace detail {
+
+constexpr FieldDescriptor MakeField(Gen1Field id, std::string_view name, std::size_t off, std::size_t len,
+                                    FieldEncoding encoding, std::string_view help, std::size_t count = 0) {
+    return FieldDescriptor{id, name, off, len, encoding, count, ChecksumDomainSums::DomainOf(off), help};
+}
+
+} // namespace detail
+
+class Gen1Fields {
+public:
+    using L = Gen1Layout;
+    using E = FieldEncoding;
+    using F = Gen1Field;
+
+    // Indexed by Gen1Field.
+    static constexpr std::array<FieldDescriptor, Gen1FieldCount> Table = {{
+        detail::MakeField(F::TrainerName, "name", L::TrainerNameOff, L::TrainerNameLen, E::Text, "trainer name"),
+        detail::MakeField(F::RivalName, "rival", L::RivalNameOff, L::RivalNameLen, E::Text, "rival name"),
+        detail::MakeField(F::TrainerId, "trainer_id", L::TrainerIdOff, 2, E::U16BE, "trainer ID"),
+        detail::MakeField(F::Money, "money", L::MoneyOff, L::MoneyLen, E::Bcd, "money (0..999999)"),
+        detail::MakeField(F::Coins, "coins", L::CoinsOff, L::CoinsLen, E::Bcd, "game corner coins"),
+        detail::MakeField(F::Badges, "badges", L::BadgesOff, 1, E::U8, "badge bitfield (0xFF = all eight)"),
+        detail::MakeField(F::Options, "options", L::OptionsOff, 1, E::U8, "options byte (text speed, battle style)"),
+        detail::MakeField(F::MapId, "map", L::MapIdOff, 1, E::U8, "current map id"),
+        detail::MakeField(F::XCoord, "x", L::XCoordOff, 1, E::U8, "x coordinate"),
+        detail::MakeField(F::YCoord, "y", L::YCoordOff, 1, E::U8, "y coordinate"),
+        detail::MakeField(F::PlayHours, "hours", L::PlayTimeHoursOff, 1, E::U8, "play time hours"),
+        detail::MakeField(F::PlayMinutes, "minutes", L::PlayTimeMinutesOff, 1, E::U8, "play time minutes"),
+        detail::MakeField(F::PlaySeconds, "seconds", L::PlayTimeSecondsOff, 1, E::U8, "play time seconds"),
+        detail::MakeField(F::PlayFrames, "frames", L::PlayTimeFramesOff, 1, E::U8, "play time frames"),
+        detail::MakeField(F::PokedexOwned, "pokedex_owned", L::PokedexOwnedOff, L::PokedexBitsLen, E::Bitset,
+                          "Pokédex owned bits", L::PokedexSpeciesCount),
+        detail::MakeField(F::PokedexSeen, "pokedex_seen", L::PokedexSeenOff, L::PokedexBitsLen, E::Bitset,
+                          "Pokédex seen bits", L::PokedexSpeciesCount),
+        detail::MakeField(F::EventFlags, "event_flags", L::EventFlagsOff, L::EventFlagsLen, E::Bitset,
+                          "event flag bits", L::EventFlagsLen * 8),
+        detail::MakeField(F::BagItems, "bag", L::BagItemsOff, L::BagItemsLen, E::ItemList, "bag item list",
+                          L::BagItemsMaxPairs),
+        detail::MakeField(F::PCItemBox, "pc_item_box", L::PCItemBoxOff, L::PCItemBoxLen, E::ItemList,
+                          "PC item box list", L::PCItemBoxMaxPairs),
+        detail::MakeField(F::HallOfFameCount, "hof_count_raw", L::HallOfFameRecordCountOff, 1, E::U8,
+                          "Hall of Fame record count byte"),
+        detail::MakeField(F::CurrentBoxNumber, "current_box_raw", L::CurrentBoxNumberOff, 1, E::U8,
+                          "current box byte (bits 0-6: box index 0..11)"),
+        detail::MakeField(F::PartyCount, "party_count_raw", L::PartyOff, 1, E::U8, "party count byte"),
+    }};
+
+    static constexpr const FieldDescriptor& Get(Gen1Field f) { return Table[static_cast<std::size_t>(f)]; }
+
+    // nullptr if no field has that name.
+    static constexpr const FieldDescriptor* Find(std::string_view name) {
+        for (const FieldDescriptor& d : Table) {
+            if (d.name == name) return &d;
+        }
+        return nullptr;
+    }
+
+    // Runtime access by id, through one generated FieldCodec reader per field.
+    // Throws std::invalid_argument if the field has a different encoding.
+    static u32 ReadNumber(Gen1Field f, SaveView sv);
+    static Gen1Name ReadText(Gen1Field f, SaveView sv);
+};
+
+namespace detail {
+
+constexpr bool FieldTableValid() {
+    for (std::size_t i = 0; i < Gen1Fields::Table.size(); ++i) {
+        const FieldDescriptor& d = Gen1Fields::Table[i];
+        if (static_cast<std::size_t>(d.id) != i) return false;
+        if (d.len == 0 || d.off + d.len > Gen1Layout::ExpectedSize) return false;
+        if (ChecksumDomainSums::DomainOf(d.off + d.len - 1) != d.domain) return false;
+        if (d.encoding == FieldEncoding::Bitset && d.count > d.len * 8) return false;
+        if (d.encoding == FieldEncoding::ItemList && 1 + 2 * d.count + 1 > d.len) return false;
+        if (d.encoding == FieldEncoding::Bcd && d.len != 2 && d.len != 3) return false;
+        for (std::size_t j = 0; j < i; ++j) {
+            if (Gen1Fields::Table[j].name == d.name) return false;
+        }
+    }
+    return true;
+}
+
+static_assert(FieldTableValid(), "Gen1Fields::Table: field out of order, out of range or straddling checksum domains");
+
+} // namespace detail
+
+// =========================================================
+// Item lists
+// =========================================================
+
+// View over one item list field. Follows the game's reading: the count byte
+// is clamped to the list's capacity and a 0xFF id ends the list early.
+class Gen1ItemList {
+public:
+    Gen1ItemList() = default;
+    // `field` = the whole list (count byte first); throws std::invalid_argument if
+    // it is too short for maxStacks.
+    Gen1ItemList(std::span<const u8> field, std::size_t maxStacks);
+
+    // Stacks before the first 0xFF id.
+    int Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+    // The count byte, clamped to the list's capacity (what the game would show).
+    int DeclaredCount() const { return static_cast<int>(pairs_.size() / 2); }
+
+    u8 ItemId(int i) const { return pairs_[static_cast<std::size_t>(i) * 2]; }
+    u8 Quantity(int i) const { return pairs_[static_cast<std::size_t>(i) * 2 + 1]; }
+
+    // Total quantity over every stack of `itemId`, or -1 if it is not listed.
+    int QuantityOf(u8 itemId) const;
+
+    // fn(itemId, quantity) per stack, in list order.
+    template <class Fn> void ForEach(Fn&& fn) const {
+        for (int i = 0; i < size_; ++i) fn(ItemId(i), Quantity(i));
+    }
+
+private:
+    std::span<const u8> pairs_;
+    int size_ = 0;
+};
+
+inline Gen1ItemList::Gen1ItemList(std::span<const u8> field, std::size_t maxStacks) {
+    if (field.size() < 1 + 2 * maxStacks) throw std::invalid_argument("Gen1ItemList: field shorter than its capacity");
+    const int count = std::min<int>(field[0], static_cast<int>(maxStacks));
+    pairs_ = field.subspan(1, static_cast<std::size_t>(count) * 2);
+    while (size_ < count && ItemId(size_) != 0xFF) ++size_;
+}
+
+inline int Gen1ItemList::QuantityOf(u8 itemId) const {
+    int total = -1;
+    for (int i = 0; i < size_; ++i) {
+        if (ItemId(i) == itemId) total = std::max(total, 0) + Quantity(i);
+    }
+    return total;
+}
+
+// =========================================================
+// FieldCodec
+// =========================================================
+
+namespace detail {
+
+template <FieldEncoding E, std::size_t Len> struct FieldValue;
+template <std::size_t Len> struct FieldValue<FieldEncoding::U8, Len> { using Type = u8; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::U16LE, Len> { using Type = u16; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::U16BE, Len> { using Type = u16; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::U24BE, Len> { using Type = u32; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::Bcd, Len> { using Type = std::conditional_t<Len == 2, u16, u32>; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::Text, Len> { using Type = Gen1Name; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::Bitset, Len> { using Type = Gen1Bitset; };
+template <std::size_t Len> struct FieldValue<FieldEncoding::ItemList, Len> { using Type = Gen1ItemList; };
+
+} // namespace detail
+
+// Satisfies SaveView::ReadField's field concept (ValueType / Off / Len / Decode),
+// so sv.ReadField<FieldCodec<F>>() is a compile-time-checked load.
+template <Gen1Field F>
+class FieldCodec {
+public:
+    static constexpr const FieldDescriptor& Descriptor = Gen1Fields::Get(F);
+    static constexpr std::size_t Off = Descriptor.off;
+    static constexpr std::size_t Len = Descriptor.len;
+    static constexpr FieldEncoding Encoding = Descriptor.encoding;
+    using ValueType = typename detail::FieldValue<Encoding, Len>::Type;
+
+    // `p` points at the field's first byte (Len bytes available).
+    static ValueType Decode(const u8* p) {
+        if constexpr (Encoding == FieldEncoding::U8) {
+            return p[0];
+        } else if constexpr (Encoding == FieldEncoding::U16LE) {
+            return static_cast<u16>(p[0] | (p[1] << 8));
+        } else if constexpr (Encoding == FieldEncoding::U16BE) {
+            return static_cast<u16>((p[0] << 8) | p[1]);
+        } else if constexpr (Encoding == FieldEncoding::U24BE) {
+            return (static_cast<u32>(p[0]) << 16) | (static_cast<u32>(p[1]) << 8) | static_cast<u32>(p[2]);
+        } else if constexpr (Encoding == FieldEncoding::Bcd) {
+            if constexpr (Len == 2) return BcdCodec::DecodeBcd2(std::span<const u8, 2>(p, 2));
+            else return BcdCodec::DecodeBcd3(std::span<const u8, 3>(p, 3));
+        } else if constexpr (Encoding == FieldEncoding::Text) {
+            return Gen1TextCodec::DecodeNameInline(SaveView(std::span<const u8>(p, Len)), 0, Len);
+        } else if constexpr (Encoding == FieldEncoding::Bitset) {
+            return Gen1Bitset(std::span<const u8>(p, Len), Descriptor.count);
+        } else {
+            return Gen1ItemList(std::span<const u8>(p, Len), Descriptor.count);
+        }
+    }
+
+    static ValueType Read(SaveView sv) { return sv.ReadField<FieldCodec>(); }
+
+    // Numbers: U8 / U16 / U24 store the low bits; BCD expects a value that fits (WriteOnlyData validates).
+    static void Write(SaveBuffer& sb, u32 value) requires(Descriptor.IsNumber()) {
+        if constexpr (Encoding == FieldEncoding::U8) {
+            sb.WriteU8(Off, static_cast<u8>(value));
+        } else if constexpr (Encoding == FieldEncoding::U16LE) {
+            sb.WriteU16LE(Off, static_cast<u16>(value));
+        } else if constexpr (Encoding == FieldEncoding::U16BE) {
+            sb.WriteU8(Off, static_cast<u8>(value >> 8));
+            sb.WriteU8(Off + 1, static_cast<u8>(value));
+        } else if constexpr (Encoding == FieldEncoding::U24BE) {
+            sb.WriteU24BE(Off, value);
+        } else if constexpr (Len == 2) {
+            BcdCodec::WriteBcd2(sb, Off, static_cast<u16>(value));
+        } else {
+            BcdCodec::WriteBcd3(sb, Off, value);
+        }
+    }
+
+    // Text: encoded, terminated and padded (see Gen1TextCodec::EncodeName).
+    static void Write(SaveBuffer& sb, std::string_view text) requires(Encoding == FieldEncoding::Text) {
+        Gen1TextCodec::EncodeName(sb, Off, Len, text);
+    }
+};
+
+using TrainerNameField = FieldCodec<Gen1Field::TrainerName>;
+using RivalNameField   = FieldCodec<Gen1Field::RivalName>;
+using TrainerIdField   = FieldCodec<Gen1Field::TrainerId>;
+using MoneyField       = FieldCodec<Gen1Field::Money>;
+using CoinsField       = FieldCodec<Gen1Field::Coins>;
+using BagItemsField    = FieldCodec<Gen1Field::BagItems>;
+using PCItemBoxField   = FieldCodec<Gen1Field::PCItemBox>;
+
+// =========================================================
+// Table-driven access
+// =========================================================
+
+namespace detail {
+
+template <Gen1Field F>
+u32 ReadNumberOf(SaveView sv) {
+    if constexpr (Gen1Fields::Get(F).IsNumber()) {
+        return FieldCodec<F>::Read(sv);
+    } else {
+        throw std::invalid_argument("Gen1Fields::ReadNumber: field is not a number");
+    }
+}
+
+template <Gen1Field F>
+Gen1Name ReadTextOf(SaveView sv) {
+    if constexpr (Gen1Fields::Get(F).encoding == FieldEncoding::Text) {
+        return FieldCodec<F>::Read(sv);
+    } else {
+        throw std::invalid_argument("Gen1Fields::ReadText: field is not text");
+    }
+}
+
+template <std::size_t... I>
+constexpr auto MakeNumberReaders(std::index_sequence<I...>) {
+    return std::array<u32 (*)(SaveView), sizeof...(I)>{&ReadNumberOf<static_cast<Gen1Field>(I)>...};
+}
+
+template <std::size_t... I>
+constexpr auto MakeTextReaders(std::index_sequence<I...>) {
+    return std::array<Gen1Name (*)(SaveView), sizeof...(I)>{&ReadTextOf<static_cast<Gen1Field>(I)>...};
+}
+
+inline constexpr auto NumberReaders = MakeNumberReaders(std::make_index_sequence<Gen1FieldCount>{});
+inline constexpr auto TextReaders = MakeTextReaders(std::make_index_sequence<Gen1FieldCount>{});
+
+} // namespace detail
+
+inline u32 Gen1Fields::ReadNumber(Gen1Field f, SaveView sv) {
+    return detail::NumberReaders[static_cast<std::size_t>(f)](sv);
+}
+
+inline Gen1Name Gen1Fields::ReadText(Gen1Field f, SaveView sv) {
+    return detail::TextReaders[static_cast<std::size_t>(f)](sv);
+}
+
+} // namespace savegenie
+
+#endif /* Gen1Fields_hpp */
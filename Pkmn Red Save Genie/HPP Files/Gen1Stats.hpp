@@ -0,0 +1,103 @@
+//
+//  Gen1Stats.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Gen I species and move data needed to keep an edited mon consistent:
+//     base stats, types and growth rate per species, base PP per move.
+//   - Stat and experience math as the game does it, driven by tables that
+//     are built at compile time: experience per level for every growth rate,
+//     and the stat-exp bonus steps (so no square root / cubic per call).
+//
+//  Owns:
+//   - The constexpr tables (Gen1Stats.cpp) and their compile-time checks.
+//   - Species lookup by internal ID (via Gen1SpeciesLookup::PokeDex).
+//
+//  Does NOT:
+//   - Read or write saves: ReadOnlyData decodes mons, WriteOnlyData edits them.
+//   - Know catch rates, learnsets or evolutions (not needed to edit stats).
+//
+
+#ifndef Gen1Stats_hpp
+#define Gen1Stats_hpp
+
+#include <array>
+#include <cstdint>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+// Growth rate ids as stored in the game's base data.
+enum class Gen1GrowthRate : u8 {
+    MediumFast = 0,
+    SlightlyFast = 1, // unused in Gen I
+    SlightlySlow = 2, // unused in Gen I
+    MediumSlow = 3,
+    Fast = 4,
+    Slow = 5,
+};
+inline constexpr std::size_t Gen1GrowthRateCount = 6;
+
+// Gen I type ids (the values stored in the mon struct).
+enum class Gen1Type : u8 {
+    Normal = 0x00, Fighting = 0x01, Flying = 0x02, Poison = 0x03, Ground = 0x04,
+    Rock = 0x05, Bug = 0x07, Ghost = 0x08,
+    Fire = 0x14, Water = 0x15, Grass = 0x16, Electric = 0x17, Psychic = 0x18,
+    Ice = 0x19, Dragon = 0x1A,
+};
+
+// Stat order everywhere below (and in the party struct): HP, Atk, Def, Spd, Spc.
+inline constexpr std::size_t Gen1StatCount = 5;
+
+class Gen1BaseStats {
+public:
+    u8 dexNo = 0;
+    std::array<u8, Gen1StatCount> base{};
+    Gen1Type type1 = Gen1Type::Normal;
+    Gen1Type type2 = Gen1Type::Normal; // same as type1 for single-type species
+    Gen1GrowthRate growth = Gen1GrowthRate::MediumFast;
+};
+
+// Computed stats: max HP, Atk, Def, Spd, Spc.
+class Gen1StatBlock {
+public:
+    std::array<u16, Gen1StatCount> values{};
+
+    u16 MaxHp() const { return values[0]; }
+    bool operator==(const Gen1StatBlock&) const = default;
+};
+
+class Gen1Stats {
+public:
+    static constexpr u8 MaxLevel = 100;
+    static constexpr u8 MaxMoveId = 165;  // STRUGGLE
+    static constexpr u8 MaxPpUps = 3;
+    static constexpr u32 MaxExp = 0xFFFFFF; // 3-byte field
+
+    // Base data for an internal species ID, or nullptr outside the 151
+    // (MISSINGNO and unused IDs).
+    static const Gen1BaseStats* ForSpecies(u8 speciesId);
+
+    // Total experience needed for `level` (1..100; clamped).
+    static u32 ExpForLevel(Gen1GrowthRate growth, u8 level);
+    // Highest level whose requirement `exp` meets (1..100).
+    static u8 LevelForExp(Gen1GrowthRate growth, u32 exp);
+
+    // floor(ceil(sqrt(statExp)) / 4), with the game's cap of 255 on the root.
+    static u8 StatExpBonus(u16 statExp);
+
+    // The game's CalcStats. `dvs` is the raw struct word (Atk|Def|Spd|Spc
+    // nibbles); the HP DV comes from their low bits.
+    static Gen1StatBlock Compute(const Gen1BaseStats& species, u16 dvs,
+                                 const std::array<u16, Gen1StatCount>& statExp, u8 level);
+
+    // Base PP for a move (1..165), 0 for "no move" / unknown moves.
+    static u8 BasePp(u8 moveId);
+    // Base PP plus one fifth of it per PP Up (0..3).
+    static u8 MaxPp(u8 moveId, u8 ppUps);
+};
+
+} // namespace savegenie
+
+#endif /* Gen1Stats_hpp */
@@ -0,0 +1,119 @@
+//
+//  InlineVector.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Fixed-capacity vector with inline storage, for summary models whose
+//     size is bounded by the save format (bag slots, Hall of Fame records,
+//     event flags, Pokédex entries).
+//   - Filling one never touches the heap, so a batch worker can rebuild every
+//     summary for every save without allocator traffic.
+//
+//  Owns:
+//   - Element lifetime inside the inline buffer (only size() elements are
+//     constructed, copied or destroyed).
+//
+//  Does NOT:
+//   - Grow: pushing past Capacity throws std::length_error (callers clamp to
+//     the Gen1Layout limits first).
+//
+
+#ifndef InlineVector_hpp
+#define InlineVector_hpp
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace savegenie {
+
+template <class T, std::size_t N>
+class InlineVector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr std::size_t Capacity = N;
+
+    InlineVector() = default;
+
+    InlineVector(const InlineVector& other) { CopyFrom(other); }
+
+    InlineVector& operator=(const InlineVector& other) {
+        if (this != &other) {
+            clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    // Storage is inline, so a move is a copy of the live elements.
+    InlineVector(InlineVector&& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        : InlineVector(static_cast<const InlineVector&>(other)) {}
+    InlineVector& operator=(InlineVector&& other) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        return *this = static_cast<const InlineVector&>(other);
+    }
+
+    ~InlineVector() { clear(); }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == N) throw std::length_error("InlineVector: capacity exceeded");
+        T* p = ::new (static_cast<void*>(data() + size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+
+    void push_back(const T& v) { emplace_back(v); }
+    void push_back(T&& v) { emplace_back(std::move(v)); }
+
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(data(), size_);
+        size_ = 0;
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    static constexpr std::size_t capacity() { return N; }
+
+    T* data() { return std::launder(reinterpret_cast<T*>(storage_)); }
+    const T* data() const { return std::launder(reinterpret_cast<const T*>(storage_)); }
+
+    T* begin() { return data(); }
+    T* end() { return data() + size_; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size_; }
+
+    T& operator[](std::size_t i) { return data()[i]; }
+    const T& operator[](std::size_t i) const { return data()[i]; }
+
+    T& front() { return data()[0]; }
+    const T& front() const { return data()[0]; }
+    T& back() { return data()[size_ - 1]; }
+    const T& back() const { return data()[size_ - 1]; }
+
+    operator std::span<const T>() const { return {data(), size_}; }
+
+private:
+    alignas(T) std::byte storage_[sizeof(T) * N];
+    std::size_t size_ = 0;
+
+    void CopyFrom(const InlineVector& other) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::uninitialized_copy_n(other.data(), other.size_, data());
+            size_ = other.size_;
+        } else {
+            for (const T& v : other) emplace_back(v);
+        }
+    }
+};
+
+} // namespace savegenie
+
+#endif /* InlineVector_hpp */
@@ -0,0 +1,132 @@
+//
+//  Instrumentation.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Per-stage wall time and hot-path counters (I/O, validation, checksums,
+//     decoding, formatting, caches), so a batch run can tell where time goes.
+//   - Compile-time switch: build with -DSAVEGENIE_INSTRUMENTATION=1 to enable.
+//     Off by default; the SAVEGENIE_STAGE / SAVEGENIE_COUNT macros then expand
+//     to nothing and their arguments are not evaluated.
+//
+//  Owns:
+//   - Stage / Counter enums and their export names.
+//   - Thread-local accumulation (no shared writes on the hot path) and the
+//     registry that merges every thread's totals into a snapshot.
+//   - Prometheus text exposition of a snapshot.
+//
+//  Does NOT:
+//   - Decide what to instrument (call sites place the macros).
+//   - Serve metrics over the network (callers write the text where they like).
+//
+
+#ifndef Instrumentation_hpp
+#define Instrumentation_hpp
+
+#ifndef SAVEGENIE_INSTRUMENTATION
+#define SAVEGENIE_INSTRUMENTATION 0
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace savegenie {
+
+enum class Stage : std::uint8_t {
+    Load = 0,   // FileManipulation::LoadFile*, MappedFile::Open
+    Backup,     // FileManipulation::BackupFile
+    Validate,   // SaveValidator
+    Checksum,   // Gen1Checksum compute / scan
+    Decode,     // ReadOnlyData::Parse* / DecodeBoxMons
+    Format,     // ToString, DumpFullSummary, WriteSummary
+};
+inline constexpr std::size_t kStageCount = 6;
+
+enum class Counter : std::uint8_t {
+    BytesRead = 0,        // bytes loaded or mapped from disk
+    ChecksumBytes,        // bytes summed by ChecksumKernels::Sum
+    StringsBuilt,         // std::string results from name decoding and ToString()
+    ResultCacheHits,      // ResultCache::Lookup
+    ResultCacheMisses,
+    SectionCacheHits,     // ReadOnlyData section memo
+    SectionCacheMisses,
+};
+inline constexpr std::size_t kCounterCount = 7;
+
+// Totals across every thread that recorded anything (live or exited).
+// Stage time is exclusive: time in a nested stage is charged to that stage only,
+// so the stage times add up to the instrumented wall time.
+struct InstrumentationSnapshot {
+    std::array<std::uint64_t, kStageCount> stageNs{};
+    std::array<std::uint64_t, kStageCount> stageCalls{};
+    std::array<std::uint64_t, kCounterCount> counters{};
+    std::size_t threads = 0;
+
+    std::uint64_t StageNs(Stage s) const { return stageNs[static_cast<std::size_t>(s)]; }
+    std::uint64_t StageCalls(Stage s) const { return stageCalls[static_cast<std::size_t>(s)]; }
+    std::uint64_t Count(Counter c) const { return counters[static_cast<std::size_t>(c)]; }
+
+    // One line per stage / counter (human-readable).
+    std::string ToString() const;
+
+    // Prometheus text exposition format (version 0.0.4), metric prefix "savegenie_".
+    std::string ToPrometheus() const;
+};
+
+class Instrumentation {
+public:
+    static constexpr bool Enabled = SAVEGENIE_INSTRUMENTATION != 0;
+
+    // Add n to a counter on the calling thread. Use SAVEGENIE_COUNT instead, so
+    // disabled builds drop the call (and the argument) entirely.
+    static void Add(Counter c, std::uint64_t n);
+
+    // Merge all threads. Safe while other threads are recording (values are
+    // read with relaxed atomics, so a snapshot may trail in-flight work slightly).
+    static InstrumentationSnapshot Snapshot();
+
+    // Zero every thread's totals (call between runs, not during one).
+    static void Reset();
+
+    // Export names: "load", "backup", ... / "bytes_read", "checksum_bytes", ...
+    static const char* StageName(Stage s);
+    static const char* CounterName(Counter c);
+};
+
+// RAII timer for one stage on the calling thread. Nested scopes subtract
+// their time from the enclosing scope.
+class ScopedStage {
+public:
+    explicit ScopedStage(Stage stage);
+    ~ScopedStage();
+
+    ScopedStage(const ScopedStage&) = delete;
+    ScopedStage& operator=(const ScopedStage&) = delete;
+
+private:
+    Stage stage_;
+    std::uint64_t startNs_ = 0;
+    std::uint64_t childNs_ = 0;
+    ScopedStage* parent_ = nullptr;
+};
+
+} // namespace savegenie
+
+#define SAVEGENIE_CONCAT_IMPL(a, b) a##b
+#define SAVEGENIE_CONCAT(a, b) SAVEGENIE_CONCAT_IMPL(a, b)
+
+#if SAVEGENIE_INSTRUMENTATION
+// Time the rest of the enclosing block as `stage` (a Stage enumerator name).
+#define SAVEGENIE_STAGE(stage) \
+    ::savegenie::ScopedStage SAVEGENIE_CONCAT(sgStage_, __LINE__)(::savegenie::Stage::stage)
+// Add `n` to `counter` (a Counter enumerator name).
+#define SAVEGENIE_COUNT(counter, n) \
+    ::savegenie::Instrumentation::Add(::savegenie::Counter::counter, static_cast<std::uint64_t>(n))
+#else
+#define SAVEGENIE_STAGE(stage) static_cast<void>(0)
+#define SAVEGENIE_COUNT(counter, n) static_cast<void>(0)
+#endif
+
+#endif /* Instrumentation_hpp */
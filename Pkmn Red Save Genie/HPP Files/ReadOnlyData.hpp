@@ -14,7 +14,12 @@
 //   - Badge interpretation
 //   - Playtime formatting
 //   - Box statistics (count / average level)
+//   - Party and single box-slot Pokémon (every struct field, stats)
 //   - Basic flag summaries
+//   - Hall of Fame range view (lazy, allocation-free)
+//   - Structured (sink-based) summaries, see SummarySink
+//   - Heap-free summary models: lists use InlineVector sized from Gen1Layout,
+//     names are views into the static lookup tables or inline Gen1Names
 //
 //  Does NOT:
 //   - Modify save data
@@ -25,10 +30,20 @@
 #ifndef ReadOnlyData_hpp
 #define ReadOnlyData_hpp
 
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <iterator>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <cstdint>
 
+#include "Gen1Fields.hpp"
+#include "Gen1Stats.hpp"
+#include "InlineVector.hpp"
 #include "SaveStructure.hpp"
 
 namespace savegenie {
@@ -36,6 +51,9 @@ namespace savegenie {
 using u8  = std::uint8_t;
 using u16 = std::uint16_t;
 using u32 = std::uint32_t;
+using u64 = std::uint64_t;
+
+class SummarySink;
 
 // =========================================================
 // Trainer Summary Model
@@ -62,6 +80,8 @@ public:
     u8 playSeconds = 0;
 
     std::string ToString() const;
+    // Structured form of ToString(): writes fields into the sink's current scope.
+    void WriteTo(SummarySink& sink) const;
 };
 
 // =========================================================
@@ -75,6 +95,107 @@ public:
     double averageLevel = 0.0;
 
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
+};
+
+// =========================================================
+// PC Box Pokémon Table (structure-of-arrays)
+// =========================================================
+
+// Every box mon from all 12 boxes, one array per field, indexed by
+// Index(box, slot) = (box - 1) * 20 + slot. Empty slots are all zero, so
+// corpus-wide aggregates can loop over the full 240 entries without branching.
+class BoxMonTable {
+public:
+    static constexpr int Boxes = 12;
+    static constexpr int SlotsPerBox = Gen1Layout::BoxMaxMons;
+    static constexpr std::size_t Capacity = static_cast<std::size_t>(Boxes * SlotsPerBox);
+
+    template <class T> using Column = std::array<T, Capacity>;
+
+    std::array<u8, Boxes> count{}; // clamped to 0..20
+
+    Column<u8>  species{};
+    Column<u8>  level{};
+    Column<u16> currentHp{};
+    Column<u8>  status{};
+    Column<u8>  type1{};
+    Column<u8>  type2{};
+    Column<u16> otId{};
+    Column<u32> exp{};
+    Column<u16> dvs{};                    // raw: Atk<<12 | Def<<8 | Spd<<4 | Spc
+    std::array<Column<u8>, 4>  moves{};
+    std::array<Column<u8>, 4>  pp{};
+    std::array<Column<u16>, 5> statExp{}; // HP, Atk, Def, Spd, Spc
+
+    Column<Gen1Name> nickname{};
+    Column<Gen1Name> otName{};
+
+    static constexpr std::size_t Index(int boxIndex1to12, int slot0to19) {
+        return static_cast<std::size_t>((boxIndex1to12 - 1) * SlotsPerBox + slot0to19);
+    }
+
+    bool Occupied(std::size_t index) const {
+        return static_cast<int>(index % SlotsPerBox) < count[index / SlotsPerBox];
+    }
+
+    std::size_t TotalCount() const;
+
+    // Histogram over occupied slots: [speciesId] / [level] -> number of mons.
+    std::array<u32, 256> SpeciesCounts() const;
+    std::array<u32, 256> LevelHistogram() const;
+
+    // DVs: 0..15 each; HP DV is derived from the low bits of the other four.
+    static u8 AttackDV(u16 dv)  { return static_cast<u8>((dv >> 12) & 0xF); }
+    static u8 DefenseDV(u16 dv) { return static_cast<u8>((dv >> 8) & 0xF); }
+    static u8 SpeedDV(u16 dv)   { return static_cast<u8>((dv >> 4) & 0xF); }
+    static u8 SpecialDV(u16 dv) { return static_cast<u8>(dv & 0xF); }
+    static u8 HpDV(u16 dv);
+};
+
+// =========================================================
+// Pokémon Model (party or box slot)
+// =========================================================
+
+// One mon, every struct field decoded. Box mons have no stats in the save:
+// theirs are computed (Gen1Stats::Compute, as the game does on withdrawal),
+// and stay zero for species outside the 151.
+class PokemonSummary {
+public:
+    int slot = 0;                  // 0-based
+    bool inParty = false;          // stats were read from the party struct
+
+    u8 speciesId = 0;
+    std::string_view speciesName;  // static storage
+    u8 level = 0;                  // party level byte for party mons
+    u16 currentHp = 0;
+    u8 status = 0;
+    u8 type1 = 0;
+    u8 type2 = 0;
+    u8 catchRate = 0;
+    u16 otId = 0;
+    u32 exp = 0;
+    u16 dvs = 0;                   // raw, see BoxMonTable::AttackDV etc.
+    std::array<u16, Gen1StatCount> statExp{};
+    std::array<u8, 4> moves{};
+    std::array<u8, 4> pp{};        // current PP (low 6 bits of the PP byte)
+    std::array<u8, 4> ppUps{};     // 0..3 (top 2 bits)
+    Gen1StatBlock stats;           // max HP, Atk, Def, Spd, Spc
+
+    Gen1Name nickname;
+    Gen1Name otName;
+
+    std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
+};
+
+class PartySummary {
+public:
+    int count = 0; // party count byte, clamped to 0..6
+    InlineVector<PokemonSummary, Gen1Layout::PartyMaxMons> mons;
+
+    std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
 };
 
 // =========================================================
@@ -83,12 +204,15 @@ public:
 
 class FlagSummary {
 public:
+    static constexpr std::size_t MaxFlags = Gen1Layout::EventFlagsLen * 8;
+
     int totalFlagsChecked = 0;
     int totalFlagsSet = 0;
 
-    std::vector<int> setFlagIndices;
+    InlineVector<u16, MaxFlags> setFlagIndices;
 
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
 };
 
 // =========================================================
@@ -100,14 +224,17 @@ public:
     int ownedCount = 0;
     int seenCount = 0;
 
+    static constexpr std::size_t MaxEntries = Gen1Layout::PokedexSpeciesCount;
+
     // Dex numbers (1..151) that are owned/seen
-    std::vector<int> ownedDexNos;
-    std::vector<int> seenDexNos;
+    InlineVector<int, MaxEntries> ownedDexNos;
+    InlineVector<int, MaxEntries> seenDexNos;
 
-    //English names (filled using Gen1SpeciesLookup::PokeDex + NameFromId)
-    std::vector<std::string> ownedNames;
-    std::vector<std::string> seenNames;
+    //English names (filled using Gen1SpeciesLookup::PokeDex + NameViewFromId; static storage)
+    InlineVector<std::string_view, MaxEntries> ownedNames;
+    InlineVector<std::string_view, MaxEntries> seenNames;
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
     
 };
 
@@ -120,21 +247,27 @@ public:
     u8 itemId = 0;
     u8 quantity = 0;
 
-    // English name via Gen1ItemLookup
-    std::string itemName;
+    // English name via Gen1ItemLookup (static storage)
+    std::string_view itemName;
 
-    // Hex string via Gen1ItemLookup
-    std::string itemHex;
+    // Hex string via Gen1ItemLookup (static storage)
+    std::string_view itemHex;
 
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
 };
 
+// Used for both the bag and the PC item box, so sized for the larger list.
 class BagSummary {
 public:
+    static constexpr std::size_t MaxItems = Gen1Layout::PCItemBoxMaxPairs;
+    static_assert(Gen1Layout::BagItemsMaxPairs <= Gen1Layout::PCItemBoxMaxPairs);
+
     int itemCount = 0;
-    std::vector<BagItem> items;
+    InlineVector<BagItem, MaxItems> items;
 
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
 };
 
 // =========================================================
@@ -145,18 +278,167 @@ class HallOfFamePokemon {
 public:
     u8 speciesId = 0;
     u8 level = 0;
-    std::string name; // Gen I text decoded Ex: "PIKAPI"
-    std::string speciesName; // Ex: "PIKACHU"
+    Gen1Name name; // Gen I text decoded Ex: "PIKAPI"
+    std::string_view speciesName; // Ex: "PIKACHU" (static storage)
 
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
 };
 
 class HallOfFameEntry {
 public:
     int entryIndex = 0; // 1..N
-    std::vector<HallOfFamePokemon> team; // up to 6
+    InlineVector<HallOfFamePokemon, Gen1Layout::HallOfFameMonsPerRecord> team;
 
     std::string ToString() const;
+    void WriteTo(SummarySink& sink) const;
+};
+
+// Every valid record, newest first (as GetHallOfFame() returns them).
+using HallOfFameList = InlineVector<HallOfFameEntry, Gen1Layout::HallOfFameMaxRecords>;
+
+// One Hall of Fame slot, viewed in place (nothing decoded until asked).
+class HallOfFameMonView {
+public:
+    HallOfFameMonView() = default;
+    explicit HallOfFameMonView(std::span<const u8> entry) : entry_(entry) {}
+
+    u8 SpeciesId() const { return entry_[0]; }
+    u8 Level() const { return entry_[1]; }
+
+    // Raw Gen I name bytes (field length, terminator included).
+    std::span<const u8> RawName() const {
+        return entry_.subspan(Gen1Layout::HallOfFameMonNameRel, Gen1Layout::HallOfFameMonNameLen);
+    }
+
+    std::string_view SpeciesName() const { return Gen1SpeciesLookup::NameViewFromId(SpeciesId()); }
+    Gen1Name DecodeName() const;
+
+    HallOfFamePokemon ToModel() const;
+    void WriteTo(SummarySink& sink) const; // same fields as HallOfFamePokemon
+
+private:
+    std::span<const u8> entry_; // HallOfFameMonEntrySize bytes
+};
+
+// One valid Hall of Fame record: the slots that passed validation, in order.
+class HallOfFameRecordView {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = HallOfFameMonView;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const HallOfFameRecordView* rec, u8 remaining) : rec_(rec), remaining_(remaining) {}
+
+        HallOfFameMonView operator*() const;
+        Iterator& operator++() { remaining_ &= static_cast<u8>(remaining_ - 1); return *this; }
+        Iterator operator++(int) { Iterator t = *this; ++*this; return t; }
+        bool operator==(const Iterator& o) const { return remaining_ == o.remaining_; }
+
+    private:
+        const HallOfFameRecordView* rec_ = nullptr;
+        u8 remaining_ = 0; // unvisited slots, bit j = slot j
+    };
+
+    HallOfFameRecordView() = default;
+    HallOfFameRecordView(std::span<const u8> record, u8 slotMask, int entryIndex)
+        : record_(record), slotMask_(slotMask), entryIndex_(entryIndex) {}
+
+    int EntryIndex() const { return entryIndex_; } // 1..N in display order
+    int Size() const { return std::popcount(slotMask_); }
+
+    Iterator begin() const { return Iterator(this, slotMask_); }
+    Iterator end() const { return Iterator(this, 0); }
+
+    HallOfFameEntry ToModel() const;
+    void WriteTo(SummarySink& sink) const;
+
+private:
+    friend class HallOfFameRange; // validates slots through Slot()
+
+    std::span<const u8> record_; // HallOfFameRecordSize bytes
+    u8 slotMask_ = 0;
+    int entryIndex_ = 0;
+
+    HallOfFameMonView Slot(int j) const {
+        return HallOfFameMonView(record_.subspan(static_cast<std::size_t>(j) * Gen1Layout::HallOfFameMonEntrySize,
+                                                 Gen1Layout::HallOfFameMonEntrySize));
+    }
+};
+
+// The Hall of Fame records GetHallOfFame() would return, as views.
+// Construction range-checks Bank 0 once and validates records from the newest
+// down until the Bank 1 count hint is met; older records are never touched.
+// The range borrows the save bytes: keep them alive and unchanged while in use.
+class HallOfFameRange {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = HallOfFameRecordView;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const HallOfFameRange* range, u64 remaining, int ordinal)
+            : range_(range), remaining_(remaining), ordinal_(ordinal) {}
+
+        HallOfFameRecordView operator*() const;
+        Iterator& operator++() { remaining_ &= remaining_ - 1; ++ordinal_; return *this; }
+        Iterator operator++(int) { Iterator t = *this; ++*this; return t; }
+        bool operator==(const Iterator& o) const { return remaining_ == o.remaining_; }
+
+    private:
+        const HallOfFameRange* range_ = nullptr;
+        u64 remaining_ = 0; // unvisited records, bit i = record slot i
+        int ordinal_ = 1;
+    };
+
+    explicit HallOfFameRange(SaveView data);
+
+    int Size() const { return std::popcount(records_); }
+    bool Empty() const { return records_ == 0; }
+
+    Iterator begin() const { return Iterator(this, records_, 1); }
+    Iterator end() const { return Iterator(this, 0, 0); }
+
+private:
+    static_assert(Gen1Layout::HallOfFameMaxRecords <= 64, "record mask is one u64");
+    static_assert(Gen1Layout::HallOfFameMonsPerRecord <= 8, "slot mask is one u8");
+
+    std::span<const u8> block_;  // HallOfFameLen bytes
+    u64 records_ = 0;            // selected records
+    std::array<u8, Gen1Layout::HallOfFameMaxRecords> slotMasks_{};
+
+    HallOfFameRecordView Record(int i, int entryIndex) const;
+
+    // Valid slots of record i (0 = record rejected).
+    u8 ValidateRecord(int i) const;
+};
+
+// =========================================================
+// Save Snapshot (every summary section, one decode)
+// =========================================================
+
+// What DumpFullSummary / WriteSummary show, filled by ReadOnlyData::DecodeAll
+// in one walk of the save. Member order follows the save's address order.
+// Names are always included (lookup-table views, no heap use beyond the two
+// trainer name strings).
+class SaveSnapshot {
+public:
+    HallOfFameList hallOfFame;       // Bank 0
+    TrainerSummary trainer;          // Bank 1 ...
+    PokedexSummary pokedex;
+    BagSummary bag;
+    BagSummary pcItemBox;
+    FlagSummary eventFlags;
+    IntegrityReport integrity;       // main, bank-all and per-box checksums
+    std::array<BoxStats, 12> boxes;  // Banks 2 and 3, [0] = box 1
+
+    std::string ToString() const;        // DumpFullSummary text
+    void WriteTo(SummarySink& sink) const; // WriteSummary fields
 };
 
 // =========================================================
@@ -165,14 +447,40 @@ public:
 
 class ReadOnlyData {
 public:
+    // Bind to a SaveBuffer (reference semantics: the buffer may be reloaded in place).
     explicit ReadOnlyData(const SaveBuffer& buffer);
 
+    // Bind to bytes owned elsewhere, e.g. a memory-mapped file (zero-copy).
+    explicit ReadOnlyData(SaveView view);
+
+    // --- Section cache (opt-in) ---
+    // When enabled, each section is parsed on first access and reused until the
+    // bound SaveBuffer's Generation() changes (any write, e.g. via WriteOnlyData
+    // on the same buffer). A SaveView-bound reader assumes its bytes never change.
+    // The cache is not synchronized: use one reader per thread.
+    void EnableCache(bool enabled = true);
+    bool CacheEnabled() const { return cache_ != nullptr; }
+    void InvalidateCache();
+
+    // --- Checksums ---
+    IntegrityReport GetIntegrityReport() const;
+
     // --- Core Data ---
     TrainerSummary GetTrainerSummary() const;
 
     // --- PC Box Statistics ---
     BoxStats GetBoxStats(int boxIndex1to12) const;
 
+    // --- PC Box Pokémon (all 12 boxes, every field) ---
+    // DecodeBoxMons overwrites `out` in place (reusable across saves, no heap use).
+    void DecodeBoxMons(BoxMonTable& out) const;
+    BoxMonTable GetBoxMons() const;
+
+    // --- Party / single slots ---
+    PartySummary GetParty() const;
+    // Throws std::out_of_range if the box index or slot is out of range / empty.
+    PokemonSummary GetBoxMon(int boxIndex1to12, int slot0to19) const;
+
     // --- Flags ---
     FlagSummary GetEventFlagSummary() const;
 
@@ -187,16 +495,67 @@ public:
 
     // --- Hall of Fame (Bank 0) ---
     // Returns an empty list if Hall of Fame record count is 0.
-    std::vector<HallOfFameEntry> GetHallOfFame() const;
+    HallOfFameList GetHallOfFame() const;
+
+    // Same records as GetHallOfFame(), as lazy views (no allocation, not cached).
+    HallOfFameRange GetHallOfFameRange() const { return HallOfFameRange(Data()); }
+
+    // --- Full decode ---
+    // Every section of the summary in one pass: a single range check, then the
+    // banks in address order, checksums summed as each region goes by.
+    // DecodeAll overwrites `out` in place (reusable across saves).
+    // Throws std::out_of_range if the save is shorter than the Gen I layout.
+    // With the cache on, the snapshot is kept and the Get* calls above read from it.
+    void DecodeAll(SaveSnapshot& out) const;
+    SaveSnapshot GetSnapshot() const;
 
     // --- Raw Dump ---
     std::string DumpFullSummary() const;
 
-private:
-    const SaveBuffer& buffer_;
+    // --- Structured Dump ---
+    // Writes the same sections as DumpFullSummary into the sink's current
+    // record (the caller owns BeginRecord/EndRecord, e.g. to add a path field).
+    void WriteSummary(SummarySink& sink) const;
 
-    // Internal helpers
-    int CountBits(u8 byte) const;
+private:
+    // Parsed sections; empty optionals are parsed on demand.
+    class SectionCache {
+    public:
+        std::uint64_t generation = 0;
+        std::optional<TrainerSummary> trainer;
+        std::optional<IntegrityReport> integrity;
+        std::array<std::optional<BoxStats>, 12> boxes;
+        std::optional<FlagSummary> eventFlags;
+        std::array<std::optional<PokedexSummary>, 2> pokedex;  // [includeNames]
+        std::array<std::optional<BagSummary>, 2> bag;          // [includeNamesAndHex]
+        std::array<std::optional<BagSummary>, 2> pcItemBox;    // [includeNamesAndHex]
+        std::optional<HallOfFameList> hallOfFame;
+        std::optional<BoxMonTable> boxMons;
+        std::optional<PartySummary> party;
+        std::optional<SaveSnapshot> snapshot; // takes precedence over the sections above
+    };
+
+    const SaveBuffer* source_ = nullptr; // set when bound to a SaveBuffer
+    SaveView view_;                      // used when bound to a SaveView
+    mutable std::unique_ptr<SectionCache> cache_; // null = caching off
+
+    SaveView Data() const;
+
+    // Cache for the current buffer generation (reset if stale), or null if off.
+    SectionCache* FreshCache() const;
+
+    // The cached snapshot (decoded on first use), or `scratch` filled by DecodeAll if caching is off.
+    const SaveSnapshot& Snapshot(SaveSnapshot& scratch) const;
+
+    // Uncached parsers behind the public Get* functions.
+    TrainerSummary ParseTrainerSummary() const;
+    BoxStats ParseBoxStats(int boxIndex1to12) const;
+    FlagSummary ParseEventFlagSummary() const;
+    PokedexSummary ParsePokedexSummary(bool includeNames) const;
+    BagSummary ParseBagSummary(bool includeNamesAndHex) const;
+    BagSummary ParsePCItemBoxSummary(bool includeNamesAndHex) const;
+    HallOfFameList ParseHallOfFame() const;
+    PartySummary ParseParty() const;
 };
 
 } // namespace savegenie
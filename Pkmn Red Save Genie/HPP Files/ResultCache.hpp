@@ -0,0 +1,76 @@
+//
+//  ResultCache.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - On-disk cache of rendered summaries, keyed by save content (SaveDigest).
+//   - A re-upload of a byte-identical save is answered from the cache without
+//     decoding anything.
+//
+//  Owns:
+//   - Entry layout and naming: <dir>/<first 2 hex digits>/<16 hex digits>.<kind>
+//   - Hit / miss / store counters (thread-safe).
+//
+//  Does NOT:
+//   - Render summaries (the caller stores whatever bytes it produced, and
+//     splices them back, e.g. via SummarySink::AppendRendered).
+//   - Evict entries (delete the directory to reset it).
+//
+
+#ifndef ResultCache_hpp
+#define ResultCache_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "ContentHash.hpp"
+
+namespace savegenie {
+
+// Entry file:
+//   "SGRC", u32 LE SchemaVersion, u64 LE size, u64 LE whole, 4 x u64 LE bank
+//   hashes, u32 LE kind length + kind, u64 LE payload length + payload.
+// The full digest and kind are checked on lookup, so a hash collision on the
+// file name (or a truncated file) reads as a miss.
+class ResultCache {
+public:
+    // Bump whenever summary output changes, so stale entries stop matching.
+    static constexpr std::uint32_t SchemaVersion = 1;
+
+    // Directories are created on first Store().
+    explicit ResultCache(std::string dir);
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    // Cached payload for (digest, kind), e.g. kind = "ndjson". Never throws:
+    // missing, unreadable or mismatching entries are misses.
+    std::optional<std::string> Lookup(const SaveDigest& digest, std::string_view kind) const;
+
+    // Best effort (a cache must never fail a scan): returns false if the entry
+    // could not be written. Written to a temporary file, then renamed into
+    // place, so concurrent readers never see a partial entry.
+    bool Store(const SaveDigest& digest, std::string_view kind, std::string_view payload) const;
+
+    std::string EntryPath(const SaveDigest& digest, std::string_view kind) const;
+    const std::string& Directory() const { return dir_; }
+
+    std::size_t Hits() const { return hits_.load(std::memory_order_relaxed); }
+    std::size_t Misses() const { return misses_.load(std::memory_order_relaxed); }
+    std::size_t Stores() const { return stores_.load(std::memory_order_relaxed); }
+
+private:
+    std::string dir_;
+    mutable std::atomic<std::size_t> hits_{0};
+    mutable std::atomic<std::size_t> misses_{0};
+    mutable std::atomic<std::size_t> stores_{0};
+    mutable std::atomic<std::size_t> tempCounter_{0};
+};
+
+} // namespace savegenie
+
+#endif /* ResultCache_hpp */
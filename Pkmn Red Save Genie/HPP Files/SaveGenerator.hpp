@@ -0,0 +1,96 @@
+//
+//  SaveGenerator.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Seeded synthetic Gen I saves for load testing and benchmarks (no real
+//     user saves needed).
+//   - Every save is a pure function of (spec, index): generation order and
+//     thread count never change the bytes.
+//
+//  Owns:
+//   - Content policy: party, box fill, Hall of Fame records, bag / PC item
+//     lists, Pokédex and event-flag density, each drawn from a per-save range.
+//   - Optional corruption injection (applied after the checksums are fixed).
+//
+//  Does NOT:
+//   - Write files (see main.cpp `gen`) or scan saves (see BatchScanner::RunGenerated).
+//   - Produce game-legal saves (filler bytes such as moves and DVs are random).
+//
+
+#ifndef SaveGenerator_hpp
+#define SaveGenerator_hpp
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+// Inclusive [lo, hi]; drawn uniformly per save.
+class IntRange {
+public:
+    int lo = 0;
+    int hi = 0;
+};
+
+enum class SaveCorruption {
+    None = 0,
+    FlipByte,       // one bit flipped inside the main checksum range
+    MainChecksum,   // stored main checksum byte altered
+    BoxChecksum,    // one stored per-box checksum byte altered
+    Truncate,       // file cut short (below 0x8000 bytes)
+};
+
+class GeneratorSpec {
+public:
+    std::uint64_t seed = 1;
+
+    IntRange partyMons{0, Gen1Layout::PartyMaxMons};
+    IntRange monsPerBox{0, Gen1Layout::BoxMaxMons};
+    IntRange hallOfFameRecords{0, Gen1Layout::HallOfFameMaxRecords};
+    IntRange bagItems{0, Gen1Layout::BagItemsMaxPairs};
+    IntRange pcItems{0, Gen1Layout::PCItemBoxMaxPairs};
+    IntRange dexPercent{0, 100};   // chance a species is owned (seen is a superset)
+    IntRange flagPercent{0, 100};  // chance an event-flag byte is non-zero
+
+    // Fraction of saves (0..1) that get exactly one corruption.
+    double corruptionRate = 0.0;
+    // Unset: a random kind per corrupted save.
+    std::optional<SaveCorruption> corruptionKind;
+};
+
+class SaveGenerator {
+public:
+    explicit SaveGenerator(GeneratorSpec spec);
+
+    const GeneratorSpec& Spec() const { return spec_; }
+
+    // Overwrite `out` with save #index (its capacity is reused). Returns the
+    // corruption that was injected, if any. Thread-safe (const, no shared state).
+    SaveCorruption Generate(std::uint64_t index, SaveBuffer& out) const;
+    SaveBuffer Generate(std::uint64_t index) const;
+
+    // "none", "flip-byte", "main-checksum", "box-checksum", "truncate".
+    static const char* CorruptionName(SaveCorruption kind);
+    static std::optional<SaveCorruption> ParseCorruption(std::string_view name);
+
+private:
+    using EncodedName = std::array<u8, Gen1Layout::NameFieldLen>;
+
+    GeneratorSpec spec_;
+
+    // Name pools, encoded once with Gen1TextCodec::EncodeName; per save they
+    // are copied in as bytes (re-encoding ~500 names per save dominated the cost).
+    std::vector<EncodedName> trainerNames_;
+    std::vector<EncodedName> rivalNames_;
+    std::vector<EncodedName> nicknames_;
+};
+
+} // namespace savegenie
+
+#endif /* SaveGenerator_hpp */
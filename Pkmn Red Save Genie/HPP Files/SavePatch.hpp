@@ -0,0 +1,108 @@
+//
+//  SavePatch.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Compact binary patch between two saves of the same size: byte runs with
+//     their old and new contents, plus the checksum bytes the edit changed.
+//   - Stored instead of a full 32 KiB "(EDITED)" copy; applied to the original
+//     (or to many other saves) on demand.
+//
+//  Owns:
+//   - Diff: word-wise XOR scan of two buffers into runs.
+//   - Apply: verifies every old byte first, then writes (a conflicting target
+//     is left untouched).
+//   - The serialized format (see below) and its validation.
+//
+//  Does NOT:
+//   - Read or write files (see FileManipulation).
+//   - Validate edits semantically (see WriteOnlyData).
+//
+
+#ifndef SavePatch_hpp
+#define SavePatch_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+enum class PatchStatus {
+    Applied = 0,
+    AlreadyApplied, // every run already holds its new bytes (nothing written)
+    SizeMismatch,
+    Conflict,       // some old bytes differ: target is not the patch's base
+};
+
+// Checksum bytes (main, bank-all, per-box table) are kept out of the runs.
+// Gen I checksums are inverted 8-bit sums, so an edit moves each one by a fixed
+// amount: Apply adds (after - before) to the target's current byte. On the
+// base save that yields exactly `after`; on any other save whose data bytes
+// match the runs, a valid checksum stays valid.
+//
+// Serialized layout (varints are LEB128):
+//   "SGPT", u8 FormatVersion, varint save size,
+//   varint run count, per run: varint gap from the previous run's end,
+//     varint length, old bytes, new bytes,
+//   varint checksum count, per checksum: varint offset, u8 before, u8 after,
+//   u64 LE XXH64 of everything before it.
+class SavePatch {
+public:
+    static constexpr std::uint8_t FormatVersion = 1;
+
+    struct Run {
+        u32 off = 0;
+        u32 len = 0;
+    };
+
+    struct ChecksumByte {
+        u32 off = 0;
+        u8 before = 0;
+        u8 after = 0;
+    };
+
+    SavePatch() = default;
+
+    // Patch turning `before` into `after`. Throws std::invalid_argument if the
+    // sizes differ.
+    static SavePatch Diff(SaveView before, SaveView after);
+
+    // Throws std::runtime_error on a malformed or corrupted patch.
+    static SavePatch Parse(std::span<const u8> bytes);
+    std::vector<u8> Serialize() const;
+
+    // Verify, then write. Only PatchStatus::Applied modifies `target`.
+    PatchStatus Apply(SaveBuffer& target) const;
+
+    // Apply to every target in order (one status per target).
+    std::vector<PatchStatus> ApplyAll(std::span<SaveBuffer> targets) const;
+
+    // Patch that undoes this one (old and new swapped).
+    SavePatch Inverted() const;
+
+    std::size_t SaveSize() const { return size_; }
+    const std::vector<Run>& Runs() const { return runs_; }
+    const std::vector<ChecksumByte>& Checksums() const { return checksums_; }
+    bool Empty() const { return runs_.empty() && checksums_.empty(); }
+
+    // Bytes covered by runs (changed bytes plus short unchanged gaps merged into runs).
+    std::size_t RunBytes() const { return before_.size(); }
+
+    // "applied", "already-applied", "size-mismatch", "conflict".
+    static const char* StatusName(PatchStatus status);
+
+private:
+    std::size_t size_ = 0;
+    std::vector<Run> runs_;
+    std::vector<u8> before_; // run contents, concatenated in run order
+    std::vector<u8> after_;
+    std::vector<ChecksumByte> checksums_;
+};
+
+} // namespace savegenie
+
+#endif /* SavePatch_hpp */
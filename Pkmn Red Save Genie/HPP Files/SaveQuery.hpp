@@ -0,0 +1,122 @@
+//
+//  SaveQuery.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Filter / projection language for corpus scans:
+//       batch --where 'badges == 0xFF && money > 500000' --select 'name, money' ./saves
+//       batch --where 'owns("MEW")' ./saves
+//   - A query compiles once into a small expression tree whose leaves read
+//     Gen1Layout fields straight from a SaveView. Only the bytes a query names
+//     are touched: no name decoding, lookup tables, Hall of Fame or box walks
+//     unless a referenced field needs them (with mmap, untouched pages are
+//     never even read from disk).
+//
+//  Owns:
+//   - Lexing, parsing and type checking (errors carry the column).
+//   - Constant resolution at compile time: species / item names become ids,
+//     function arguments are range-checked.
+//   - Evaluation (a compiled query is immutable, so one instance serves every
+//     worker thread).
+//
+//  Does NOT:
+//   - Load files or schedule work (BatchScanner runs it, see BatchOptions::query).
+//   - Decode anything it is not asked for.
+//
+
+#ifndef SaveQuery_hpp
+#define SaveQuery_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SaveStructure.hpp"
+
+namespace savegenie {
+
+class SummarySink;
+
+enum class QueryType : std::uint8_t {
+    Bool,
+    Number,
+    String,
+};
+
+// Grammar (C-style precedence, keywords `and` / `or` / `not` also accepted):
+//   expr    := and ( '||' and )*
+//   and     := cmp ( '&&' cmp )*
+//   cmp     := unary ( ('=='|'!='|'<'|'<='|'>'|'>=') unary )?
+//   unary   := '!' unary | primary
+//   primary := NUMBER | STRING | FIELD | FUNCTION '(' ARG ')' | '(' expr ')'
+// Numbers are decimal or 0x-prefixed hex; strings use "..." or '...'.
+// Strings compare with == / != only. Fields and functions: see Reference().
+class SaveQuery {
+public:
+    // Matches every save and selects nothing.
+    SaveQuery() = default;
+
+    // `where` may be empty (no filter). `select` is a comma-separated list of
+    // expressions; each becomes one output column keyed by its source text.
+    // Throws std::invalid_argument ("query: ... (column N)") on any error.
+    static SaveQuery Compile(std::string_view where, std::string_view select = {});
+
+    bool HasFilter() const { return root_ >= 0; }
+
+    // True if the save passes the filter (always true without one).
+    // Throws std::out_of_range if a referenced field lies outside the save.
+    bool Matches(SaveView sv) const;
+
+    // Writes every selected column into the sink's current record.
+    void Project(SaveView sv, SummarySink& sink) const;
+
+    const std::vector<std::string>& Columns() const { return columnNames_; }
+
+    // The fields and calls the query reads, in first-use order
+    // (e.g. "badges, money, owns(151)").
+    std::string Describe() const;
+
+    // One line per field / function with its type, for usage text.
+    static std::string Reference();
+
+private:
+    enum class NodeKind : std::uint8_t {
+        Number,      // value
+        String,      // text
+        Field,       // arg = computed field id
+        Raw,         // arg = Gen1Field (read through its FieldCodec)
+        Call,        // arg = function id, value = resolved argument
+        Not,         // lhs
+        And,         // lhs, rhs (short-circuit)
+        Or,          // lhs, rhs (short-circuit)
+        Compare,     // arg = comparison, lhs, rhs (numbers / bools)
+        CompareText, // arg = comparison, lhs, rhs (strings)
+    };
+
+    struct Node {
+        NodeKind kind = NodeKind::Number;
+        QueryType type = QueryType::Number;
+        std::uint8_t arg = 0;
+        int lhs = -1;
+        int rhs = -1;
+        std::int64_t value = 0;
+        std::string text;
+    };
+
+    class Parser; // SaveQuery.cpp
+
+    std::vector<Node> nodes_;
+    int root_ = -1;
+    std::vector<int> columns_;
+    std::vector<std::string> columnNames_;
+
+    std::int64_t EvalNumber(int node, SaveView sv) const;
+    // `scratch` holds decoded names; the result may point into it.
+    std::string_view EvalString(int node, SaveView sv, Gen1Name& scratch) const;
+};
+
+} // namespace savegenie
+
+#endif /* SaveQuery_hpp */
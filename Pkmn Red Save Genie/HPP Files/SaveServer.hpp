@@ -0,0 +1,195 @@
+//
+//  SaveServer.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Long-running daemon: clients send save bytes over a Unix domain socket
+//     and get back a summary (ReadOnlyData) or an edited save (WriteOnlyData
+//     edit batch), without paying process start-up per save.
+//   - Matching client (SaveClient) for scripts and the `client` subcommand.
+//
+//  Owns:
+//   - The wire protocol (framing, ops, status codes) and the edit script format.
+//   - Connection threads (one per client, at most maxConnections, each with
+//     its own receive buffer).
+//   - A worker pool with warm per-worker state (SaveBuffer, reader, sinks,
+//     response buffer). Idle workers take up to maxBatch queued requests per
+//     wake-up and run them back to back.
+//
+//  Does NOT:
+//   - Touch the filesystem beyond the socket path (saves arrive as bytes).
+//   - Speak HTTP (put a reverse proxy in front if needed).
+//
+
+#ifndef SaveServer_hpp
+#define SaveServer_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "WriteOnlyData.hpp"
+
+namespace savegenie {
+
+// Wire format (integers little-endian):
+//   request:  u32 length (of everything after it), u32 id, u8 op, payload
+//   response: u32 length, u32 id (echoed), u8 status, body
+// A connection has one request in flight at a time; send the next one after
+// its response arrives (open more connections for concurrency).
+enum class ServerOp : std::uint8_t {
+    Ping = 0,    // payload: none            body: none
+    Summary = 1, // payload: u8 format, save body: summary text / record
+                 //   format: SummaryFormat value, or SummaryTextFormat for DumpFullSummary()
+    Edit = 2,    // payload: u32 script length, script, save
+                 //   body (Ok): u32 log length, edit log, edited save
+                 //   body (EditRejected): message, then the edit log
+    Stats = 3,   // payload: none            body: Prometheus text (server counters)
+};
+
+enum class ServerStatus : std::uint8_t {
+    Ok = 0,
+    BadRequest,    // malformed frame, unknown op, bad edit script, unreadable save
+    EditRejected,  // WriteOnlyData refused the batch (save unchanged)
+    InternalError,
+    Busy,          // maxConnections reached; sent once (id 0), then the connection is closed
+};
+
+inline constexpr std::uint8_t SummaryTextFormat = 0xFF;
+
+class ServerOptions {
+public:
+    std::string socketPath;
+
+    // 0 = one worker per hardware thread.
+    unsigned workers = 0;
+
+    // Requests a worker takes from the queue per wake-up.
+    std::size_t maxBatch = 16;
+
+    // Larger requests are answered with BadRequest and the connection is closed.
+    std::size_t maxRequestBytes = 1 << 20;
+
+    // Open connections (one thread each). Clients past the limit get Busy.
+    std::size_t maxConnections = 64;
+};
+
+class SaveServer {
+public:
+    explicit SaveServer(ServerOptions opts);
+    ~SaveServer();
+
+    SaveServer(const SaveServer&) = delete;
+    SaveServer& operator=(const SaveServer&) = delete;
+
+    // Bind, listen and serve until Stop(). Replaces a stale socket file at the
+    // path and removes it on return. Throws std::runtime_error on setup failure,
+    // including when another server already answers on the socket path.
+    void Run();
+
+    // Ask Run() to return (async-signal-safe: only writes to a pipe).
+    void Stop();
+
+    // Edit script: one edit per line, '#' starts a comment, numbers are decimal
+    // or 0x-prefixed hex. Each line becomes one entry of the batch, in order.
+    //   trainer-name NAME        rival-name NAME
+    //   money N                  coins N                  badges N
+    //   location MAP X Y
+    //   item add|set|remove bag|pc ITEM [QTY]
+    //   mon party|current|box:B SLOT [species=N] [level=N] [nickname=NAME] [ot=NAME]
+    //       [dvs=A,D,S,C] [statexp=H,A,D,S,C] [moves=M1[,M2..]] [ppups=U1[,U2..]] [restore-pp]
+    //   mons party|boxes|all [level=N] [dvs=..] [statexp=..] [ppups=..] [restore-pp]
+    // Throws std::invalid_argument (with the line number) on a malformed line.
+    static EditBatch ParseEditScript(std::string_view script);
+
+private:
+    class Connection;
+    class Worker;
+
+    struct Job {
+        Connection* conn = nullptr;
+        std::uint32_t id = 0;
+        ServerOp op = ServerOp::Ping;
+        std::span<const std::uint8_t> payload; // in conn's receive buffer
+    };
+
+    ServerOptions opts_;
+    int listenFd_ = -1;
+    int wakeFds_[2] = {-1, -1}; // self-pipe for Stop()
+
+    std::mutex mu_;
+    std::condition_variable jobsCv_;
+    std::deque<Job> jobs_;
+    bool stopping_ = false;
+
+    std::vector<std::thread> workers_;
+    std::vector<std::shared_ptr<Connection>> conns_; // guarded by mu_
+
+    std::atomic<std::uint64_t> requests_{0};
+    std::atomic<std::uint64_t> failures_{0};
+    std::atomic<std::uint64_t> batches_{0};
+    std::atomic<std::uint64_t> connections_{0};
+    std::atomic<std::uint64_t> rejected_{0};
+
+    void RunWorker(Worker& w);
+    void ServeConnection(const std::shared_ptr<Connection>& conn);
+    void Handle(Worker& w, const Job& job);
+    void Respond(Connection& conn, std::uint32_t id, ServerStatus status, std::span<const std::uint8_t> body);
+    std::string StatsText() const;
+    void Shutdown();
+};
+
+// Blocking client for one connection.
+class SaveClient {
+public:
+    class Response {
+    public:
+        ServerStatus status = ServerStatus::Ok;
+        std::vector<std::uint8_t> body;
+
+        bool Ok() const { return status == ServerStatus::Ok; }
+        std::string_view Text() const {
+            return {reinterpret_cast<const char*>(body.data()), body.size()};
+        }
+    };
+
+    // Throws std::runtime_error if the socket cannot be reached.
+    explicit SaveClient(const std::string& socketPath);
+    ~SaveClient();
+
+    SaveClient(const SaveClient&) = delete;
+    SaveClient& operator=(const SaveClient&) = delete;
+
+    // Throws std::runtime_error on I/O failure.
+    Response Call(ServerOp op, std::span<const std::uint8_t> payload);
+
+    Response Ping();
+    Response Summary(std::uint8_t format, std::span<const std::uint8_t> save);
+    Response Edit(std::string_view script, std::span<const std::uint8_t> save);
+    Response Stats();
+
+    // Split an Edit Ok body into the log text and the edited save.
+    // Throws std::runtime_error if the body is malformed.
+    static void SplitEditBody(std::span<const std::uint8_t> body, std::string& log, std::vector<std::uint8_t>& save);
+
+    // "ok", "bad-request", "edit-rejected", "internal-error".
+    static const char* StatusName(ServerStatus status);
+
+private:
+    int fd_ = -1;
+    std::uint32_t nextId_ = 1;
+    std::vector<std::uint8_t> tx_;
+};
+
+} // namespace savegenie
+
+#endif /* SaveServer_hpp */
@@ -0,0 +1,131 @@
+//
+//  SaveStream.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Read many saves out of one byte stream (stdin or a file) without
+//     unpacking it to disk: a concatenation of fixed-size frames, a tar
+//     archive, or a zip archive.
+//   - One frame at a time into a caller-owned, reused buffer, so memory use is
+//     the same for a 10-save bundle and a 10-million-save one.
+//
+//  Owns:
+//   - Container detection (zip / tar magic, otherwise raw frames).
+//   - Tar parsing: ustar / GNU / PAX names and sizes, header checksums.
+//   - Zip parsing: local file headers, Zip64 sizes, CRC-32 of stored entries.
+//   - Per-entry problems (unsupported compression, oversized member, short
+//     final frame) are reported on the frame; only an unreadable container
+//     throws.
+//
+//  Does NOT:
+//   - Know the save format or decide which members are saves (BatchScanner
+//     filters names the same way it filters directory walks).
+//   - Decompress: zip members must be stored (zip -0); deflated members are
+//     reported and skipped.
+//   - Seek: everything is a single forward pass, so pipes work.
+//
+
+#ifndef SaveStream_hpp
+#define SaveStream_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace savegenie {
+
+enum class StreamFormat {
+    Auto = 0, // zip / tar by magic, otherwise raw frames
+    Raw,      // back-to-back frames of frameSize bytes
+    Tar,
+    Zip,
+};
+
+// One unit read from the stream. Buffers are reused across Next() calls.
+class StreamFrame {
+public:
+    std::uint64_t index = 0;        // 0-based position among the stream's frames / members
+    std::string name;               // "<label>:<member path>" or "<label>:0000042" for raw frames
+    std::string member;             // archive member path; empty for raw frames
+    std::vector<std::uint8_t> bytes;
+    std::string error;              // non-empty: this entry could not be read (bytes is empty)
+};
+
+class SaveStream {
+public:
+    // Standard Gen I SRAM dump, and the same with the emulator's 44-byte RTC footer.
+    static constexpr std::size_t DefaultFrameSize = 0x8000;
+    static constexpr std::size_t RtcFrameSize = 0x802C;
+
+    // Archive members larger than this are reported, not buffered; raw frames
+    // may not be larger either.
+    static constexpr std::size_t MaxMemberSize = 1u << 20;
+
+    // `path` "-" = stdin (named "stdin" in frame names). `frameSize` only applies to raw streams.
+    // Throws std::runtime_error if the file cannot be opened, std::invalid_argument if frameSize
+    // is not within 1..MaxMemberSize.
+    SaveStream(const std::string& path, StreamFormat format = StreamFormat::Auto,
+               std::size_t frameSize = DefaultFrameSize);
+    ~SaveStream();
+
+    SaveStream(const SaveStream&) = delete;
+    SaveStream& operator=(const SaveStream&) = delete;
+
+    // Reads the next frame / regular member into `out`. Returns false at the end
+    // of the stream. Throws std::runtime_error if the container is corrupt beyond
+    // recovery (bad tar header checksum, zip entry of unknown length, I/O error).
+    bool Next(StreamFrame& out);
+
+    // Detected (or forced) container; Auto until the first Next() call.
+    StreamFormat Format() const { return format_; }
+
+    std::uint64_t BytesConsumed() const { return offset_; }
+
+    static std::optional<StreamFormat> ParseFormat(std::string_view s); // auto|raw|tar|zip
+    static std::string_view FormatName(StreamFormat f);
+
+private:
+    std::FILE* file_ = nullptr;
+    bool ownsFile_ = false;
+    std::string label_;
+    StreamFormat format_;
+    std::size_t frameSize_;
+
+    std::vector<std::uint8_t> buf_; // read-ahead window
+    std::size_t pos_ = 0;
+    std::size_t end_ = 0;
+    bool eof_ = false;
+    std::uint64_t offset_ = 0;      // bytes consumed from the stream
+    std::uint64_t nextIndex_ = 0;
+    bool finished_ = false;
+
+    // GNU 'L' / PAX 'x' records apply to the next tar member.
+    std::string pendingName_;
+    std::optional<std::uint64_t> pendingSize_;
+
+    // Buffer at least n bytes (fewer at end of stream); returns what is buffered.
+    std::size_t Fill(std::size_t n);
+    // Copy up to n bytes into dst; returns the number copied (short only at end of stream).
+    std::size_t Read(std::uint8_t* dst, std::size_t n);
+    // Discard n bytes; returns false if the stream ended first.
+    bool Skip(std::uint64_t n);
+
+    void Detect();
+    bool NextRaw(StreamFrame& out);
+    bool NextTar(StreamFrame& out);
+    bool NextZip(StreamFrame& out);
+
+    // Member payload of `size` bytes: buffered into out.bytes, or skipped with an
+    // error if it is larger than MaxMemberSize.
+    void ReadMember(StreamFrame& out, std::uint64_t size, const char* container);
+
+    [[noreturn]] void Fail(const std::string& what) const;
+};
+
+} // namespace savegenie
+
+#endif /* SaveStream_hpp */
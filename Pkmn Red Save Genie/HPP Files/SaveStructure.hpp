@@ -9,10 +9,12 @@
 //
 //  Owns:
 //   - SaveBuffer: encapsulates raw bytes and exposes safe Read/Write helpers.
+//   - SaveView: non-owning, read-only window over save bytes (e.g. an mmap'd file).
 //   - Gen1Layout: bank bases + offsets/lengths for core fields (expand over time).
-//   - Gen1TextCodec: minimal Gen I text encoding/decoding (names first; expandable later).
+//   - Gen1TextCodec: table-driven Gen I text encoding/decoding (full charset).
 //   - BcdCodec: money/coins helpers.
 //   - Gen1Checksum: compute/validate/fix routines for main and box banks.
+//   - Gen1Bitset: word-wide view over flag/Pokédex bitfields.
 //
 //  Does NOT:
 //   - Perform file I/O (see FileManipulation).
@@ -23,8 +25,13 @@
 #ifndef SaveStructure_hpp
 #define SaveStructure_hpp
 
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -37,6 +44,78 @@ namespace savegenie {
 using u8  = std::uint8_t;
 using u16 = std::uint16_t;
 using u32 = std::uint32_t;
+using u64 = std::uint64_t;
+
+// =========================
+// SaveView (non-owning, read-only byte access)
+// =========================
+// Same bounds-checked read API as SaveBuffer, but over bytes owned elsewhere
+// (a SaveBuffer, a memory-mapped file, a network frame...).
+// The caller guarantees the underlying bytes outlive the view.
+//
+// The fixed-offset overloads (ReadU8<Off>(), ReadField<Field>()) check the range
+// against Gen1Layout::ExpectedSize at compile time; the runtime size check is done
+// once, when the view is constructed, so on a full-size save they are plain loads.
+class SaveView {
+public:
+    SaveView() = default;
+    explicit SaveView(std::span<const u8> bytes);
+
+    std::size_t Size() const { return bytes_.size(); }
+    std::span<const u8> Span() const { return bytes_; }
+
+    // True if the view covers the whole Gen I layout (size >= Gen1Layout::ExpectedSize).
+    bool HasFullLayout() const { return fullLayout_; }
+
+    // --- Bounds checking ---
+    void RequireRange(std::size_t off, std::size_t len) const;
+
+    // --- Basic reads ---
+    u8  ReadU8(std::size_t off) const;
+    u16 ReadU16LE(std::size_t off) const;
+    u32 ReadU24BE(std::size_t off) const; // 3 bytes: [hi][mid][lo]
+
+    // --- Bit helpers ---
+    bool GetBit(std::size_t byteOff, u8 bitIndex0to7) const;
+
+    // --- Sub-ranges (bounds-checked, no copy) ---
+    std::span<const u8> Subspan(std::size_t off, std::size_t len) const;
+
+    // --- Fixed-offset reads (compile-time checked; see Gen I fields below) ---
+    // Short buffers fall back to the checked path and throw like ReadU8(off).
+    template <std::size_t Off> u8  ReadU8() const;
+    template <std::size_t Off> u16 ReadU16LE() const;
+    template <std::size_t Off> u32 ReadU24BE() const;
+    template <class Field> typename Field::ValueType ReadField() const;
+
+private:
+    std::span<const u8> bytes_;
+    bool fullLayout_ = false;
+};
+
+// =========================
+// Checksum domain sums (incremental checksum support)
+// =========================
+// Running 8-bit byte sums for each checksum domain: the main range plus the
+// 12 box blocks (the two bank-all sums are derived from their six boxes).
+// A sum is only trusted once Gen1Checksum has seeded it with a full recompute;
+// from then on every SaveBuffer write keeps it current by adding (new - old).
+class ChecksumDomainSums {
+public:
+    static constexpr int MainDomain  = 0;  // 0x2598..0x3522
+    static constexpr int DomainCount = 13; // 1..12 = boxes 1..12
+
+    std::array<u8, DomainCount> sum{};
+    std::array<bool, DomainCount> known{};
+
+    // Domain containing `off`, or -1 if the byte is not checksummed
+    // (Bank 0, checksum bytes themselves, unused tails, etc.).
+    static constexpr int DomainOf(std::size_t off);
+
+    void InvalidateAll() { known.fill(false); }
+};
+
+class Gen1Checksum;
 
 // =========================
 // SaveBuffer (safe byte access)
@@ -54,7 +133,12 @@ public:
     // Read-only access to raw bytes (for writing out to disk).
     const Bytes& BytesView() const;
 
+    // Non-owning read view. Invalidated if the buffer is resized through BytesMutable().
+    SaveView View() const { return SaveView(std::span<const u8>(bytes_.data(), bytes_.size())); }
+    operator SaveView() const { return View(); }
+
     // Mutable access (used only by editing layers).
+    // Raw access bypasses write tracking, so it drops all incremental checksum sums.
     Bytes& BytesMutable();
 
     // --- Bounds checking ---
@@ -63,22 +147,79 @@ public:
     // --- Basic reads ---
     u8  ReadU8(std::size_t off) const;
     u16 ReadU16LE(std::size_t off) const;
+    u16 ReadU16BE(std::size_t off) const; // mon struct words are big-endian
     u32 ReadU24BE(std::size_t off) const; // 3 bytes: [hi][mid][lo]
 
     // --- Basic writes ---
     void WriteU8(std::size_t off, u8 v);
     void WriteU16LE(std::size_t off, u16 v);
+    void WriteU16BE(std::size_t off, u16 v);
     void WriteU24BE(std::size_t off, u32 v);
+    void WriteBytes(std::size_t off, std::span<const u8> src);
 
     // --- Bit helpers ---
     bool GetBit(std::size_t byteOff, u8 bitIndex0to7) const;
     void SetBit(std::size_t byteOff, u8 bitIndex0to7, bool value);
 
+    // --- Fixed-offset reads (forward to View(); see SaveView) ---
+    template <std::size_t Off> u8  ReadU8() const { return View().template ReadU8<Off>(); }
+    template <std::size_t Off> u16 ReadU16LE() const { return View().template ReadU16LE<Off>(); }
+    template <std::size_t Off> u32 ReadU24BE() const { return View().template ReadU24BE<Off>(); }
+    template <class Field> typename Field::ValueType ReadField() const { return View().template ReadField<Field>(); }
+
     // --- Slices ---
     Bytes Slice(std::size_t off, std::size_t len) const;
 
+    // --- Incremental checksum state (maintained by the Write* helpers above) ---
+    const ChecksumDomainSums& DomainSums() const { return sums_; }
+
+    // --- Change tracking ---
+    // Bumped by every Write*/SetBit call and every BytesMutable() access, so
+    // readers can tell whether anything they cached may be stale.
+    std::uint64_t Generation() const { return generation_; }
+
+    // --- Undo journal (edit transactions) ---
+    // While a journal is open, the first pre-image of every byte changed through
+    // Write*/SetBit is recorded (one entry per byte, however often it is
+    // rewritten). BytesMutable() cannot be tracked, so it falls back to one
+    // full copy of the buffer. Begin/Commit/Rollback throw std::logic_error
+    // when a journal is already open / not open.
+    void BeginJournal();
+    void CommitJournal();
+    // Restore every recorded byte and close the journal. Domain sums stay
+    // valid when only byte entries were recorded (restores go through the same
+    // bookkeeping as writes); restoring a full image invalidates them.
+    void RollbackJournal();
+
+    bool JournalOpen() const { return journal_.has_value(); }
+    // Bytes recorded by the open journal (0 if none is open).
+    std::size_t JournalSize() const;
+    // Checksum domains (see ChecksumDomainSums) written since BeginJournal().
+    std::array<bool, ChecksumDomainSums::DomainCount> JournalDirtyDomains() const;
+
 private:
+    friend class Gen1Checksum; // seeds domain sums after a full recompute
+
+    struct Journal {
+        struct Entry {
+            u32 off;
+            u8 before;
+        };
+        std::vector<Entry> entries;
+        std::vector<u64> touched;          // one bit per buffer byte
+        std::optional<Bytes> image;        // full pre-image after BytesMutable()
+        std::array<bool, ChecksumDomainSums::DomainCount> dirty{};
+
+        void Record(std::size_t off, u8 before, int domain);
+    };
+
     Bytes bytes_;
+    ChecksumDomainSums sums_;
+    std::uint64_t generation_ = 0;
+    std::optional<Journal> journal_;
+
+    // Fold one byte change into the running domain sums.
+    void NoteWrite(std::size_t off, u8 oldValue, u8 newValue);
 };
 
 // =========================
@@ -132,6 +273,8 @@ public:
     static constexpr std::size_t HallOfFameRecordSize    = 0x0060;
     static constexpr int HallOfFameMonsPerRecord         = 6;
     static constexpr std::size_t HallOfFameMonEntrySize  = 0x0010;
+    static constexpr std::size_t HallOfFameMonNameRel    = 0x0002;
+    static constexpr std::size_t HallOfFameMonNameLen    = 0x000B;
 
     // Bank 1 field: Hall of Fame record count
     static constexpr std::size_t HallOfFameRecordCountOff = 0x284E; // 1 byte
@@ -142,6 +285,7 @@ public:
     static constexpr std::size_t PokedexOwnedOff  = 0x25A3;
     static constexpr std::size_t PokedexSeenOff   = 0x25B6;
     static constexpr std::size_t PokedexBitsLen   = 0x13;  // 19 bytes
+    static constexpr std::size_t PokedexSpeciesCount = 151; // bit i = Dex #i+1
 
     static constexpr std::size_t BagItemsOff      = 0x25C9;
     static constexpr std::size_t BagItemsLen      = 0x2A;  // 42 bytes
@@ -150,8 +294,6 @@ public:
     // - Byte 0: item count
     // - Then `count` pairs of (itemId, quantity)
     // - Many lists are terminated by 0xFF; we parse defensively (stop if itemId == 0xFF).
-    static constexpr std::size_t BagItemsCountOff = BagItemsOff;          // 0x25C9
-    static constexpr std::size_t BagItemsPairsOff = BagItemsOff + 1;      // 0x25CA
     static constexpr int BagItemsMaxPairs         = 20;                   // typical max carried items in Gen I
     
     // PC Item Box ("Item Box")
@@ -160,8 +302,6 @@ public:
     static constexpr std::size_t PCItemBoxOff      = 0x27E6;
     static constexpr std::size_t PCItemBoxLen      = 0x68;
 
-    static constexpr std::size_t PCItemBoxCountOff = PCItemBoxOff;
-    static constexpr std::size_t PCItemBoxPairsOff = PCItemBoxOff + 1;
     static constexpr int PCItemBoxMaxPairs         = 50;
     
 
@@ -193,6 +333,10 @@ public:
     static constexpr std::size_t PlayTimeSecondsOff= 0x2CF0;
     static constexpr std::size_t PlayTimeFramesOff = 0x2CF1;
 
+    // Completed-game-events bitfield (Bulbapedia: 0x29F3, length 0x140).
+    static constexpr std::size_t EventFlagsOff     = 0x29F3;
+    static constexpr std::size_t EventFlagsLen     = 0x0140;
+
     // Coins (slot machine) are stored as 2-byte BCD at 0x2850.
     static constexpr std::size_t CoinsOff          = 0x2850;
     static constexpr std::size_t CoinsLen          = 2;
@@ -207,6 +351,54 @@ public:
     // Each full box block is 0x462 bytes.
     static constexpr std::size_t BoxBlockSize      = 0x0462;
 
+    // Box block internals (relative to the box base):
+    //   +0x000 count, +0x001 species list (20 + 0xFF), +0x016 20 x 0x21-byte mons,
+    //   +0x2AA 20 x 11-byte OT names, +0x386 20 x 11-byte nicknames.
+    static constexpr int BoxMaxMons                = 20;
+    static constexpr std::size_t BoxMonDataRel     = 0x0016;
+    static constexpr std::size_t BoxMonStructSize  = 0x0021;
+    static constexpr std::size_t BoxOTNamesRel     = 0x02AA;
+    static constexpr std::size_t BoxNicknamesRel   = 0x0386;
+
+    // OT names / nicknames (includes terminator).
+    static constexpr std::size_t NameFieldLen      = 11;
+
+    // Box Pokémon struct (0x21 bytes; multi-byte values are big-endian).
+    static constexpr std::size_t MonSpeciesRel     = 0x00;
+    static constexpr std::size_t MonCurrentHpRel   = 0x01; // u16
+    static constexpr std::size_t MonBoxLevelRel    = 0x03;
+    static constexpr std::size_t MonStatusRel      = 0x04;
+    static constexpr std::size_t MonType1Rel       = 0x05;
+    static constexpr std::size_t MonType2Rel       = 0x06;
+    static constexpr std::size_t MonCatchRateRel   = 0x07;
+    static constexpr std::size_t MonMovesRel       = 0x08; // 4 bytes
+    static constexpr std::size_t MonOTIdRel        = 0x0C; // u16
+    static constexpr std::size_t MonExpRel         = 0x0E; // u24
+    static constexpr std::size_t MonStatExpRel     = 0x11; // 5 x u16: HP, Atk, Def, Spd, Spc
+    static constexpr std::size_t MonDVsRel         = 0x1B; // u16: Atk|Def|Spd|Spc nibbles
+    static constexpr std::size_t MonPPRel          = 0x1D; // 4 bytes (top 2 bits = PP Ups)
+
+    // --- Party (Bank 1, 0x2F2C, 0x194 bytes) ---
+    //   +0x000 count, +0x001 species list (6 + 0xFF), +0x008 6 x 0x2C-byte mons,
+    //   +0x110 6 x 11-byte OT names, +0x152 6 x 11-byte nicknames.
+    // A party mon is the box struct followed by its level and computed stats.
+    static constexpr std::size_t PartyOff          = 0x2F2C;
+    static constexpr std::size_t PartyBlockSize    = 0x0194;
+    static constexpr int PartyMaxMons              = 6;
+    static constexpr std::size_t PartyMonDataRel   = 0x0008;
+    static constexpr std::size_t PartyMonStructSize= 0x002C;
+    static constexpr std::size_t PartyOTNamesRel   = 0x0110;
+    static constexpr std::size_t PartyNicknamesRel = 0x0152;
+
+    static constexpr std::size_t MonPartyLevelRel  = 0x21;
+    static constexpr std::size_t MonMaxHpRel       = 0x22; // u16, then Atk, Def, Spd, Spc (u16 each)
+
+    // --- Current PC box (Bank 1) ---
+    // The selected box lives in bank 1 (same 0x462-byte layout as a box block)
+    // and is copied back to its bank 2/3 slot when the player switches boxes.
+    static constexpr std::size_t CurrentBoxNumberOff = 0x284C; // bits 0-6: box index 0..11
+    static constexpr std::size_t CurrentBoxDataOff   = 0x30C0;
+
     // Bank 2 boxes (1-6)
     static constexpr std::size_t Box1Off           = 0x4000;
     static constexpr std::size_t Box2Off           = 0x4462;
@@ -243,16 +435,20 @@ public:
 //
 class Gen1SpeciesLookup {
 public:
-    static const std::string SpeciesName[256];
+    // Names/hex strings are constant-initialized string_views (no startup
+    // construction, no copies on lookup).
+    static const std::array<std::string_view, 256> SpeciesName;
     static const int SpeciesNo[256];
-    static const std::string SpeciesHex[256];
+    static const std::array<std::string_view, 256> SpeciesHex;
 
     // Pokédex number (index) -> Gen I internal SpeciesID mapping.
     // Example: PokeDex[1] (Bulbasaur) -> 0x99 (153)
     // Invalid/unused entries should be -1.
     static const int PokeDex[256];
 
-    static std::string NameFromId(u8 speciesId);
+    // Never empty: unused entries read as "INVALID".
+    static std::string_view NameViewFromId(u8 speciesId);
+    static std::string NameFromId(u8 speciesId); // owning copy of NameViewFromId
 };
 
 // =========================
@@ -263,7 +459,7 @@ public:
 //
 // Notes:
 //  - Map IDs are dense (0..255), so a fixed-size lookup is simplest.
-//  - We store three parallel vectors (as requested):
+//  - We store three parallel tables (as requested):
 //      MapIDName[256] -> human-readable map name (or "INVALID")
 //      MapIDNo[256]   -> decimal ID (0..255)
 //      MapIDHex[256]  -> hex string ("0x00".."0xFF")
@@ -273,10 +469,11 @@ public:
 
 class Gen1MapLookup {
 public:
-    static const std::string MapIDName[256]; // size 256
+    static const std::array<std::string_view, 256> MapIDName;
     static const int MapIDNo[256];           // size 256
-    static const std::string MapIDHex[256];  // size 256
-    static std::string NameFromId(u8 mapId);
+    static const std::array<std::string_view, 256> MapIDHex;
+    static std::string_view NameViewFromId(u8 mapId);
+    static std::string NameFromId(u8 mapId); // owning copy of NameViewFromId
 };
 
 // =========================
@@ -287,27 +484,83 @@ public:
 //
 class Gen1ItemLookup {
 public:
-    static const std::string ItemName[256]; // size 256
+    static const std::array<std::string_view, 256> ItemName;
     static const int ItemNo[256];           // size 256
-    static const std::string ItemHex[256];  // size 256
+    static const std::array<std::string_view, 256> ItemHex;
 
-    static std::string NameFromId(u8 itemId);
+    static std::string_view NameViewFromId(u8 itemId);
+    static std::string NameFromId(u8 itemId); // owning copy of NameViewFromId
 };
 
 // =========================
-// Gen I text codec (minimal; names first)
+// Gen I name string (inline, no heap)
 // =========================
+// A decoded name in UTF-8. Sized for the longest in-save name field where every
+// glyph takes its widest form (3 UTF-8 bytes, e.g. "♂"), so it never truncates
+// a real name field.
+class Gen1Name {
+public:
+    static constexpr std::size_t Capacity = Gen1Layout::NameFieldLen * 3;
+
+    std::string_view View() const { return std::string_view(chars_.data(), size_); }
+    std::size_t Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+    std::string ToString() const { return std::string(View()); }
+
+private:
+    friend class Gen1TextCodec;
+
+    std::array<char, Capacity> chars_{};
+    u8 size_ = 0;
+};
+
+// One name field in the save (offset + field length incl. terminator).
+class Gen1NameField {
+public:
+    std::size_t off = 0;
+    std::size_t len = 0;
+};
+
+// =========================
+// Gen I text codec
+// =========================
+// Table-driven over the full English Gen I charset (letters, digits,
+// punctuation, 'd/'l/'s..., PK/MN, ♂/♀, é, box-drawing glyphs).
+// Decoded text is UTF-8; control codes and unmapped bytes decode as "?".
 class Gen1TextCodec {
 public:
-    // Decode an in-save name field (Gen I charset) into ASCII.
+    static constexpr u8 Terminator = 0x50;
+
+    // Decode an in-save name field (Gen I charset) into UTF-8.
     // Stops at 0x50 terminator or length.
-    static std::string DecodeName(const SaveBuffer& sb, std::size_t off, std::size_t len);
+    static std::string DecodeName(SaveView sv, std::size_t off, std::size_t len);
+
+    // Allocation-free decode into a caller buffer (no NUL appended).
+    // Stops at the terminator, at `len`, or when the next glyph would not fit.
+    // Returns the number of bytes written.
+    static std::size_t DecodeNameInto(SaveView sv, std::size_t off, std::size_t len, std::span<char> out);
 
-    // Encode ASCII into Gen I charset and write into the save.
+    // Allocation-free decode into an inline string.
+    static Gen1Name DecodeNameInline(SaveView sv, std::size_t off, std::size_t len);
+
+    // Decode many fields in one call; out[i] receives fields[i].
+    // Throws std::invalid_argument if the spans differ in size.
+    static void DecodeNames(SaveView sv, std::span<const Gen1NameField> fields, std::span<Gen1Name> out);
+
+    // Append every populated name field in the save: trainer, rival, Hall of Fame
+    // nicknames, then OT name + nickname for each occupied slot of boxes 1..12.
+    static void AppendNameFields(SaveView sv, std::vector<Gen1NameField>& out);
+
+    // Encode UTF-8 into Gen I charset and write into the save.
     // Writes a 0x50 terminator and pads remaining bytes with 0x50.
+    // Characters outside the charset are written as spaces.
     static void EncodeName(SaveBuffer& sb, std::size_t off, std::size_t len, std::string_view name);
 
+    // Glyph for one byte (UTF-8). Empty for the terminator, "?" if unmapped.
+    static std::string_view Glyph(u8 byte);
+
     // Expose per-character conversions (useful for debugging).
+    // ByteToAscii returns '\0' for the terminator and '?' for non-ASCII glyphs.
     static char ByteToAscii(u8 byte);
     static u8   AsciiToByte(char c);
 };
@@ -318,54 +571,261 @@ public:
 class BcdCodec {
 public:
     // Read 3-byte BCD (money) into an integer.
-    static u32 ReadBcd3(const SaveBuffer& sb, std::size_t off);
+    static u32 ReadBcd3(SaveView sv, std::size_t off);
+
+    // Decode already range-checked BCD bytes (invalid nibbles read as 0).
+    static u32 DecodeBcd3(std::span<const u8, 3> bytes);
+    static u16 DecodeBcd2(std::span<const u8, 2> bytes);
 
     // Write integer into 3-byte BCD.
     // Valid range for Gen I money is 0..999999.
     static void WriteBcd3(SaveBuffer& sb, std::size_t off, u32 value);
 
     // Read 2-byte BCD (coins) into an integer.
-    static u16 ReadBcd2(const SaveBuffer& sb, std::size_t off);
+    static u16 ReadBcd2(SaveView sv, std::size_t off);
 
     // Write integer into 2-byte BCD.
     // Coins are typically 0..9999.
     static void WriteBcd2(SaveBuffer& sb, std::size_t off, u16 value);
 };
 
+// =========================
+// Inline / template definitions (need Gen1Layout)
+// =========================
+constexpr int ChecksumDomainSums::DomainOf(std::size_t off) {
+    if (off >= Gen1Layout::MainChecksumStart && off <= Gen1Layout::MainChecksumEnd) {
+        return MainDomain;
+    }
+    if (off >= Gen1Layout::Bank2Base && off < Gen1Layout::Bank2AllChecksumOff) {
+        return 1 + static_cast<int>((off - Gen1Layout::Bank2Base) / Gen1Layout::BoxBlockSize);
+    }
+    if (off >= Gen1Layout::Bank3Base && off < Gen1Layout::Bank3AllChecksumOff) {
+        return 7 + static_cast<int>((off - Gen1Layout::Bank3Base) / Gen1Layout::BoxBlockSize);
+    }
+    return -1;
+}
+
+inline SaveView::SaveView(std::span<const u8> bytes)
+    : bytes_(bytes), fullLayout_(bytes.size() >= Gen1Layout::ExpectedSize) {}
+
+template <std::size_t Off>
+u8 SaveView::ReadU8() const {
+    static_assert(Off + 1 <= Gen1Layout::ExpectedSize, "ReadU8<Off>: offset outside the Gen I layout");
+    if (!fullLayout_) return ReadU8(Off);
+    return bytes_.data()[Off];
+}
+
+template <std::size_t Off>
+u16 SaveView::ReadU16LE() const {
+    static_assert(Off + 2 <= Gen1Layout::ExpectedSize, "ReadU16LE<Off>: range outside the Gen I layout");
+    if (!fullLayout_) return ReadU16LE(Off);
+    const u8* p = bytes_.data() + Off;
+    return static_cast<u16>(p[0] | (p[1] << 8));
+}
+
+template <std::size_t Off>
+u32 SaveView::ReadU24BE() const {
+    static_assert(Off + 3 <= Gen1Layout::ExpectedSize, "ReadU24BE<Off>: range outside the Gen I layout");
+    if (!fullLayout_) return ReadU24BE(Off);
+    const u8* p = bytes_.data() + Off;
+    return (static_cast<u32>(p[0]) << 16) | (static_cast<u32>(p[1]) << 8) | static_cast<u32>(p[2]);
+}
+
+template <class Field>
+typename Field::ValueType SaveView::ReadField() const {
+    static_assert(Field::Off + Field::Len <= Gen1Layout::ExpectedSize, "ReadField: field outside the Gen I layout");
+    if (!fullLayout_) RequireRange(Field::Off, Field::Len);
+    return Field::Decode(bytes_.data() + Field::Off);
+}
+
 // =========================
 // Checksums
 // =========================
+
+// Every checksum in the save: stored byte vs. freshly computed value.
+// Produced by Gen1Checksum::ScanAll in a single pass over the buffer.
+class IntegrityReport {
+public:
+    u8 mainStored = 0;
+    u8 mainComputed = 0;
+
+    // [0] = Bank 2, [1] = Bank 3.
+    std::array<u8, 2> bankAllStored{};
+    std::array<u8, 2> bankAllComputed{};
+
+    // [0..11] = boxes 1..12.
+    std::array<u8, 12> boxStored{};
+    std::array<u8, 12> boxComputed{};
+
+    bool MainValid() const { return mainStored == mainComputed; }
+    bool BankAllValid(int bankIndex2or3) const;
+    bool BoxValid(int boxIndex1to12) const;
+
+    // Number of boxes whose per-box checksum matches (0..12).
+    int ValidBoxCount() const;
+
+    // Main + both bank-all + all 12 box checksums.
+    bool AllValid() const;
+};
+
+// Compute/Validate take a SaveView, so they work on a SaveBuffer (implicit
+// conversion) or directly on memory-mapped bytes. Fix* need a mutable SaveBuffer.
+//
+// Fix* are incremental: the first call on a buffer does a full recompute and
+// seeds SaveBuffer's domain sums; later calls only pay for the bytes written
+// since (tracked through SaveBuffer::Write*/SetBit). With cross-checking on,
+// every incremental fix is verified against a full recompute.
 class Gen1Checksum {
 public:
     // Main checksum for Bank 1.
-    static u8 ComputeMain(const SaveBuffer& sb);
-    static bool ValidateMain(const SaveBuffer& sb);
+    static u8 ComputeMain(SaveView sv);
+    static bool ValidateMain(SaveView sv);
     static void FixMain(SaveBuffer& sb);
 
     // Bank checksum for Banks 2 and 3 (the "all checksum" byte).
     // Note: This is NOT the same as the per-box checksums.
-    static u8 ComputeBankAll(const SaveBuffer& sb, int bankIndex2or3);
-    static bool ValidateBankAll(const SaveBuffer& sb, int bankIndex2or3);
+    static u8 ComputeBankAll(SaveView sv, int bankIndex2or3);
+    static bool ValidateBankAll(SaveView sv, int bankIndex2or3);
     static void FixBankAll(SaveBuffer& sb, int bankIndex2or3);
 
     // Per-box checksums (one byte per box).
     // These are required if you edit box data.
-    static u8 ComputeBox(const SaveBuffer& sb, int boxIndex1to12);
-    static bool ValidateBox(const SaveBuffer& sb, int boxIndex1to12);
+    static u8 ComputeBox(SaveView sv, int boxIndex1to12);
+    static bool ValidateBox(SaveView sv, int boxIndex1to12);
     static void FixBox(SaveBuffer& sb, int boxIndex1to12);
+
+    // Whole-save integrity scan: each checksummed byte is summed exactly once.
+    // The 12 per-box sums are reused to derive both bank-all sums
+    // (a bank-all range is exactly its six box blocks).
+    // Throws std::out_of_range if the buffer is smaller than the Gen I layout.
+    static IntegrityReport ScanAll(SaveView sv);
+
+    // Debug aid: verify incremental sums against a full recompute on every Fix*.
+    // Throws std::logic_error on divergence. Defaults to on in DEBUG builds.
+    static void SetIncrementalCrossCheck(bool enabled);
+    static bool IncrementalCrossCheck();
+};
+
+// =========================
+// Bitsets (event flags, Pokédex owned/seen)
+// =========================
+// Non-owning view over a Gen I bitfield (bit i = byte i / 8, bit i % 8, LSB
+// first), processed 64 bits at a time with std::popcount / std::countr_zero.
+// Bits past BitCount() are masked off, so a 151-bit Pokédex in 19 bytes
+// never counts the spare bit.
+class Gen1Bitset {
+public:
+    enum class Op { And, Or, AndNot }; // AndNot: in a, not in b
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    Gen1Bitset() = default;
+
+    // Throws std::invalid_argument if bitCount exceeds bytes.size() * 8.
+    Gen1Bitset(std::span<const u8> bytes, std::size_t bitCount);
+
+    // Bounds-checked view into a save.
+    static Gen1Bitset FromSave(SaveView sv, std::size_t off, std::size_t len, std::size_t bitCount);
+
+    // Standard Gen I bitfields.
+    static Gen1Bitset PokedexOwned(SaveView sv);
+    static Gen1Bitset PokedexSeen(SaveView sv);
+    static Gen1Bitset EventFlags(SaveView sv);
+
+    std::size_t BitCount() const { return bitCount_; }
+    std::size_t WordCount() const { return (bitCount_ + 63) / 64; }
+
+    // 64 bits starting at bit 64 * w (little-endian), tail bits masked to zero.
+    u64 Word(std::size_t w) const;
+
+    bool Test(std::size_t bit) const;
+
+    std::size_t Count() const;
+    bool AnySet() const;
+    bool AllSet() const;
+    bool NoneSet() const { return !AnySet(); }
+
+    // First set bit at or after `from`, or npos.
+    std::size_t NextSet(std::size_t from) const;
+
+    // Calls fn(bitIndex) for each set bit in ascending order (no allocation).
+    template <class Fn> void ForEachSet(Fn&& fn) const;
+
+    // Pairwise queries (e.g. two saves). Throws std::invalid_argument if the
+    // bit counts differ.
+    static std::size_t CountCombined(const Gen1Bitset& a, const Gen1Bitset& b, Op op);
+    template <class Fn> static void ForEachCombined(const Gen1Bitset& a, const Gen1Bitset& b, Op op, Fn&& fn);
+
+private:
+    std::span<const u8> bytes_;
+    std::size_t bitCount_ = 0;
+
+    static u64 Combine(u64 a, u64 b, Op op);
+    static void RequireSameSize(const Gen1Bitset& a, const Gen1Bitset& b);
+
+    template <class Fn> static void ForEachBitInWord(u64 word, std::size_t base, Fn& fn);
 };
 
+inline u64 Gen1Bitset::Word(std::size_t w) const {
+    const std::size_t byteOff = w * 8;
+    const std::size_t n = std::min<std::size_t>(8, bytes_.size() - byteOff);
+    const u8* p = bytes_.data() + byteOff;
+
+    u64 v = 0;
+    if (n == 8 && std::endian::native == std::endian::little) {
+        std::memcpy(&v, p, 8);
+    } else {
+        for (std::size_t k = 0; k < n; ++k) v |= static_cast<u64>(p[k]) << (8 * k);
+    }
+
+    const std::size_t tail = bitCount_ - w * 64;
+    if (tail < 64) v &= (u64{1} << tail) - 1;
+    return v;
+}
+
+inline u64 Gen1Bitset::Combine(u64 a, u64 b, Op op) {
+    switch (op) {
+        case Op::And:    return a & b;
+        case Op::Or:     return a | b;
+        case Op::AndNot: return a & ~b;
+    }
+    return 0;
+}
+
+template <class Fn>
+void Gen1Bitset::ForEachBitInWord(u64 word, std::size_t base, Fn& fn) {
+    while (word != 0) {
+        fn(base + static_cast<std::size_t>(std::countr_zero(word)));
+        word &= word - 1; // clear lowest set bit
+    }
+}
+
+template <class Fn>
+void Gen1Bitset::ForEachSet(Fn&& fn) const {
+    for (std::size_t w = 0; w < WordCount(); ++w) {
+        ForEachBitInWord(Word(w), w * 64, fn);
+    }
+}
+
+template <class Fn>
+void Gen1Bitset::ForEachCombined(const Gen1Bitset& a, const Gen1Bitset& b, Op op, Fn&& fn) {
+    RequireSameSize(a, b);
+    for (std::size_t w = 0; w < a.WordCount(); ++w) {
+        ForEachBitInWord(Combine(a.Word(w), b.Word(w), op), w * 64, fn);
+    }
+}
+
 // =========================
 // Basic save validation
 // =========================
 class SaveValidator {
 public:
     // Throws if size is unexpected.
-    static void RequireExpectedSize(const SaveBuffer& sb);
+    static void RequireExpectedSize(SaveView sv);
 
     // Non-throwing checks for UX.
-    static bool HasExpectedSize(const SaveBuffer& sb);
-    static bool HasValidMainChecksum(const SaveBuffer& sb);
+    static bool HasExpectedSize(SaveView sv);
+    static bool HasValidMainChecksum(SaveView sv);
 };
 
 } // namespace savegenie
@@ -0,0 +1,203 @@
+//
+//  SummarySink.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Structured output for save summaries (machine-readable alternative to the
+//     human ToString()/DumpFullSummary() text).
+//   - One record per save; fields are written straight into a reusable OutputBuffer.
+//
+//  Owns:
+//   - OutputBuffer: growable byte buffer, optionally flushed to a file descriptor.
+//   - SummarySink interface + NDJSON, compact binary and plain-text implementations.
+//
+//  Does NOT:
+//   - Know the save format (ReadOnlyData and the summary models drive the sink).
+//   - Open files (the caller supplies the fd).
+//
+
+#ifndef SummarySink_hpp
+#define SummarySink_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace savegenie {
+
+// =========================
+// OutputBuffer
+// =========================
+// Bytes accumulate in one reusable string. With fd >= 0, RecordBoundary()
+// flushes once the buffer passes flushThreshold (never mid-record, so binary
+// length prefixes can still be patched). With fd < 0 the caller reads Data().
+class OutputBuffer {
+public:
+    explicit OutputBuffer(int fd = -1, std::size_t flushThreshold = 64 * 1024);
+    ~OutputBuffer();
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    void Append(std::string_view s) { buf_.append(s); }
+    void Append(char c) { buf_.push_back(c); }
+
+    std::string_view Data() const { return buf_; }
+    std::size_t Size() const { return buf_.size(); }
+
+    // Keeps capacity for the next record.
+    void Clear() { buf_.clear(); }
+
+    // Overwrite 4 bytes at `pos` with `v` (little-endian). Used for length prefixes.
+    void PatchU32LE(std::size_t pos, std::uint32_t v);
+
+    // Called by sinks after each record.
+    void RecordBoundary();
+
+    // Write everything to the fd (no-op without one). Throws std::runtime_error on failure.
+    void Flush();
+
+private:
+    std::string buf_;
+    int fd_ = -1;
+    std::size_t flushThreshold_ = 0;
+};
+
+// =========================
+// SummarySink
+// =========================
+enum class SummaryFormat {
+    Text = 0,   // indented "key: value" lines, blank line between records
+    Ndjson,     // one JSON object per line
+    Binary,     // length-prefixed tagged records (see BinarySink)
+};
+
+// Streaming structured writer. Keys are ignored inside arrays.
+// Records may nest objects and arrays; every Begin* needs its End*.
+class SummarySink {
+public:
+    virtual ~SummarySink() = default;
+
+    virtual void BeginRecord() = 0;
+    virtual void EndRecord() = 0;
+
+    virtual void BeginObject(std::string_view key) = 0;
+    virtual void EndObject() = 0;
+    virtual void BeginArray(std::string_view key) = 0;
+    virtual void EndArray() = 0;
+
+    virtual void String(std::string_view key, std::string_view value) = 0;
+    virtual void Uint(std::string_view key, std::uint64_t value) = 0;
+    virtual void Bool(std::string_view key, bool value) = 0;
+    virtual void Double(std::string_view key, double value) = 0;
+
+    // Append top-level fields rendered earlier by a sink of the same format
+    // (the bytes it wrote between two top-level fields, e.g. a cached summary).
+    virtual void AppendRendered(std::string_view fields) = 0;
+
+    // Sink for `format` writing into `out` (which must outlive the sink).
+    static std::unique_ptr<SummarySink> Create(SummaryFormat format, OutputBuffer& out);
+
+    // "text", "ndjson", "binary".
+    static const char* FormatName(SummaryFormat format);
+    static std::optional<SummaryFormat> ParseFormat(std::string_view name);
+};
+
+// NDJSON: strings are emitted as UTF-8 with JSON escapes; doubles with 2 decimals.
+class NdjsonSink : public SummarySink {
+public:
+    explicit NdjsonSink(OutputBuffer& out) : out_(out) {}
+
+    void BeginRecord() override;
+    void EndRecord() override;
+    void BeginObject(std::string_view key) override;
+    void EndObject() override;
+    void BeginArray(std::string_view key) override;
+    void EndArray() override;
+    void String(std::string_view key, std::string_view value) override;
+    void Uint(std::string_view key, std::uint64_t value) override;
+    void Bool(std::string_view key, bool value) override;
+    void Double(std::string_view key, double value) override;
+    void AppendRendered(std::string_view fields) override;
+
+private:
+    OutputBuffer& out_;
+    std::vector<bool> inArray_;   // one entry per open scope
+    std::vector<bool> firstItem_; // parallel to inArray_
+
+    void Open(std::string_view key, char bracket, bool isArray);
+    void Close(char bracket);
+    void Key(std::string_view key);
+    void Quoted(std::string_view s);
+};
+
+// Binary record layout:
+//   u32 LE payload length, then a sequence of entries:
+//     tag (u8), key (varint length + bytes; absent for End), value:
+//       0x01 uint    LEB128 varint
+//       0x02 string  varint length + bytes (UTF-8)
+//       0x03 bool    u8 (0/1)
+//       0x04 double  8 bytes, IEEE-754 little-endian
+//       0x05 object begin / 0x06 array begin (no value)
+//       0x07 end of the innermost object/array (no key, no value)
+//   Array elements carry an empty key.
+class BinarySink : public SummarySink {
+public:
+    enum Tag : std::uint8_t {
+        TagUint = 0x01, TagString = 0x02, TagBool = 0x03, TagDouble = 0x04,
+        TagObject = 0x05, TagArray = 0x06, TagEnd = 0x07,
+    };
+
+    explicit BinarySink(OutputBuffer& out) : out_(out) {}
+
+    void BeginRecord() override;
+    void EndRecord() override;
+    void BeginObject(std::string_view key) override;
+    void EndObject() override;
+    void BeginArray(std::string_view key) override;
+    void EndArray() override;
+    void String(std::string_view key, std::string_view value) override;
+    void Uint(std::string_view key, std::uint64_t value) override;
+    void Bool(std::string_view key, bool value) override;
+    void Double(std::string_view key, double value) override;
+    void AppendRendered(std::string_view fields) override;
+
+private:
+    OutputBuffer& out_;
+    std::size_t recordStart_ = 0;
+
+    void Varint(std::uint64_t v);
+    void Entry(Tag tag, std::string_view key);
+};
+
+// Plain text: "key: value", two spaces of indent per level, "- value" in arrays.
+class TextSink : public SummarySink {
+public:
+    explicit TextSink(OutputBuffer& out) : out_(out) {}
+
+    void BeginRecord() override;
+    void EndRecord() override;
+    void BeginObject(std::string_view key) override;
+    void EndObject() override;
+    void BeginArray(std::string_view key) override;
+    void EndArray() override;
+    void String(std::string_view key, std::string_view value) override;
+    void Uint(std::string_view key, std::uint64_t value) override;
+    void Bool(std::string_view key, bool value) override;
+    void Double(std::string_view key, double value) override;
+    void AppendRendered(std::string_view fields) override;
+
+private:
+    OutputBuffer& out_;
+    std::vector<bool> inArray_;
+
+    void Line(std::string_view key, std::string_view value);
+};
+
+} // namespace savegenie
+
+#endif /* SummarySink_hpp */
@@ -0,0 +1,44 @@
+//
+//  WorkStealingPool.hpp
+//  Pkmn Red Save Genie
+//
+//  Purpose:
+//   - Minimal work-stealing parallel-for used by the batch tools.
+//   - Each worker owns a contiguous range of indices and pops from its front;
+//     an idle worker steals the back half of the busiest-looking victim.
+//
+//  Owns:
+//   - Thread lifetime for one ParallelFor call (threads are joined before return).
+//   - Exception propagation (first exception thrown by a task is rethrown).
+//
+//  Does NOT:
+//   - Know anything about saves, files, or output ordering (see BatchScanner).
+//
+
+#ifndef WorkStealingPool_hpp
+#define WorkStealingPool_hpp
+
+#include <cstddef>
+#include <functional>
+
+namespace savegenie {
+
+class WorkStealingPool {
+public:
+    // Task signature: (workerIndex, itemIndex).
+    // workerIndex is stable for the lifetime of the call (0..threads-1), so callers
+    // can keep per-worker scratch state (buffers, readers) in a vector indexed by it.
+    using Task = std::function<void(unsigned workerIndex, std::size_t itemIndex)>;
+
+    // Resolve a requested thread count (0 = hardware concurrency, at least 1).
+    static unsigned ResolveThreadCount(unsigned requested);
+
+    // Run task(worker, i) for every i in [0, count).
+    // Blocks until all items are done. Rethrows the first exception raised by a task;
+    // remaining items are abandoned once an exception is seen.
+    static void ParallelFor(std::size_t count, unsigned threads, const Task& task);
+};
+
+} // namespace savegenie
+
+#endif /* WorkStealingPool_hpp */
@@ -16,11 +16,15 @@
 #ifndef WriteOnlyData_hpp
 #define WriteOnlyData_hpp
 
+#include <array>
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <variant>
 #include <vector>
 #include <optional>
 
+#include "Gen1Fields.hpp"
 #include "SaveStructure.hpp"
 
 namespace savegenie {
@@ -114,9 +118,16 @@ public:
     std::string itemHex;  // optional convenience (filled by code)
 };
 
+enum class ItemEditAction {
+    AddOrUpdate = 0, // add, or increase the quantity of an existing stack
+    SetQuantity,     // exact quantity of an existing stack (0 removes it)
+    Remove,
+};
+
 class ItemEditRequest {
 public:
     ItemListKind list = ItemListKind::Bag;
+    ItemEditAction action = ItemEditAction::AddOrUpdate;
 
     // Add / set
     u8 itemId = 0;
@@ -130,7 +141,7 @@ public:
 };
 
 // =========================================================
-// Future Pokémon editing placeholders
+// Pokémon editing
 // =========================================================
 
 enum class PokemonSlotKind {
@@ -143,20 +154,75 @@ class PokemonEditRequest {
 public:
     PokemonSlotKind kind = PokemonSlotKind::Party;
 
-    // Which slot
+    // Which slot (must already hold a Pokémon)
     int boxIndex1to12 = 1; // for PCBox
     int slotIndex0to19 = 0;
 
-    // Minimal safe fields (expand later)
-    std::optional<u8> newSpeciesId;
-    std::optional<u8> newLevel;
+    std::optional<u8> newSpeciesId;   // one of the 151; types follow the species
+    std::optional<u8> newLevel;       // 1..100; experience is set to that level's minimum
     std::optional<std::string> newNickname;
     std::optional<std::string> newOtName;
+
+    std::optional<std::array<u8, 4>> newDVs;       // Atk, Def, Spd, Spc (0..15); HP DV follows
+    std::optional<std::array<u16, 5>> newStatExp;  // HP, Atk, Def, Spd, Spc
+    std::optional<std::array<u8, 4>> newMoves;     // move IDs 1..165, 0 = empty (trailing only)
+    std::optional<std::array<u8, 4>> newPpUps;     // 0..3 per move slot
+    bool restorePp = false;                        // refill every move to its max PP
+
+    // Species, level, DV and stat-exp edits recompute the stats (party mons
+    // store them) and keep the mon's HP damage. A changed move starts with
+    // full PP and no PP Ups unless newPpUps says otherwise.
+};
+
+// Which blocks a bulk Pokémon edit walks.
+enum class PokemonScope {
+    Party = 0,
+    PCBoxes = 1, // all 12 boxes, plus the bank 1 copy of the current box
+    All = 2,
+};
+
+// One edit applied to every stored mon in `scope`, in a single pass over the
+// blocks (e.g. "every box mon to level 50"). Slots whose species has no base
+// stats (MISSINGNO) are skipped and counted, not treated as errors.
+class PokemonBulkEditRequest {
+public:
+    PokemonScope scope = PokemonScope::PCBoxes;
+
+    std::optional<u8> newLevel;
+    std::optional<std::array<u8, 4>> newDVs;
+    std::optional<std::array<u16, 5>> newStatExp;
+    std::optional<std::array<u8, 4>> newPpUps;
+    bool restorePp = false;
+};
+
+// =========================================================
+// Batched edits
+// =========================================================
+
+// Edits applied in insertion order as one transaction (see WriteOnlyData::ApplyBatch).
+class EditBatch {
+public:
+    using Edit = std::variant<EditRequest, ItemEditRequest, PokemonEditRequest, PokemonBulkEditRequest>;
+
+    std::vector<Edit> edits;
+
+    EditBatch& Add(EditRequest req) { edits.emplace_back(std::move(req)); return *this; }
+    EditBatch& Add(ItemEditRequest req) { edits.emplace_back(std::move(req)); return *this; }
+    EditBatch& Add(PokemonEditRequest req) { edits.emplace_back(std::move(req)); return *this; }
+    EditBatch& Add(PokemonBulkEditRequest req) { edits.emplace_back(std::move(req)); return *this; }
+
+    bool Empty() const { return edits.empty(); }
+    std::size_t Size() const { return edits.size(); }
 };
 
 // =========================================================
 // WriteOnlyData (safe mutation engine)
 // =========================================================
+//
+// Transactions: Apply, the item edits, the Pokémon edits and ApplyBatch each
+// run under the buffer's undo journal (SaveBuffer::BeginJournal). Either every
+// edit succeeds and checksums are repaired once at the end, or the journal
+// restores every byte written so far and the save is left untouched.
 
 class WriteOnlyData {
 public:
@@ -171,14 +237,17 @@ public:
     EditMessage SetBadges(u8 badgesBitfield);
     EditMessage SetLocation(u8 mapId, u8 x, u8 y);
 
-    // Apply an EditRequest as one transaction (recommended).
-    // Implementations should:
-    //  - validate inputs
-    //  - apply mutations
-    //  - write checksum(s)
+    // Apply an EditRequest as one transaction (recommended):
+    //  - validate inputs and apply mutations
+    //  - on the first failure, roll back everything this call wrote
+    //  - otherwise write checksum(s)
     //  - append log lines
     EditMessage Apply(const EditRequest& req, EditLog* log = nullptr);
 
+    // Apply many edits as one transaction: all or nothing, with a single
+    // checksum repair (main + every box the batch touched) at the end.
+    EditMessage ApplyBatch(const EditBatch& batch, EditLog* log = nullptr);
+
     // ---------- Item edits ----------
     // Read current list
     std::vector<ItemStack> ReadItemList(ItemListKind kind, bool includeNamesAndHex = true) const;
@@ -189,11 +258,14 @@ public:
     // Remove item entirely
     EditMessage RemoveItem(ItemListKind kind, u8 itemId, EditLog* log = nullptr);
 
-    // Set exact quantity for an item; if qty==0 may remove (implementation-defined)
+    // Set exact quantity for an item; qty==0 removes it
     EditMessage SetItemQuantity(ItemListKind kind, u8 itemId, u8 quantity, EditLog* log = nullptr);
 
-    // ---------- Future Pokémon edits (placeholders) ----------
+    // ---------- Pokémon edits ----------
     EditMessage ApplyPokemonEdit(const PokemonEditRequest& req, EditLog* log = nullptr);
+    // Checksums are repaired once at the end: main, plus one FixBox per
+    // touched box and one FixBankAll per touched bank.
+    EditMessage ApplyBulkPokemonEdit(const PokemonBulkEditRequest& req, EditLog* log = nullptr);
 
     // ---------- Integrity ----------
     // Recompute and write required checksum(s) for a mutated save.
@@ -223,24 +295,30 @@ private:
     static EditMessage ValidateItemId(u8 itemId, bool allowInvalidIds);
     static EditMessage ValidateQuantity(u8 qty, u8 minQty, u8 maxQty);
 
+    // Transaction wrapper: runs `body` under the undo journal. `body` sets
+    // `requested` if it asked for any edit (which triggers checksum repair).
+    using TransactionBody = std::function<EditMessage(bool& requested)>;
+    EditMessage Transact(const TransactionBody& body, EditLog* log);
+
+    // Un-journaled edit steps (Transact supplies rollback + checksums).
+    EditMessage ApplyFields(const EditRequest& req, EditLog* log, bool& requested);
+    EditMessage ApplyItemFields(const ItemEditRequest& req, EditLog* log);
+    EditMessage ApplyPokemonFields(const PokemonEditRequest& req, EditLog* log, bool& requested);
+    EditMessage ApplyBulkPokemonFields(const PokemonBulkEditRequest& req, EditLog* log, bool& requested);
+
+    // Main checksum, plus box and bank-all checksums for every dirty box domain.
+    EditMessage FixDirtyChecksums(const std::array<bool, ChecksumDomainSums::DomainCount>& dirty);
+
     // Encode helpers (use SaveStructure codecs)
     EditMessage WriteTrainerNameBytes(const std::string& name);
     EditMessage WriteRivalNameBytes(const std::string& name);
 
-    // List manipulation (Bag / PC Item Box)
-    struct ListRegion {
-        std::size_t base = 0;
-        std::size_t len = 0;
-        std::size_t countOff = 0;
-        std::size_t pairsOff = 0;
-        int maxPairs = 0;
-    };
-
-    static ListRegion RegionFor(ItemListKind kind);
+    // List manipulation (Bag / PC Item Box): the list's Gen1Fields descriptor.
+    static const FieldDescriptor& RegionFor(ItemListKind kind);
 
     // Low-level list operations (do not expose publicly)
-    std::vector<ItemStack> ReadItemListInternal(const ListRegion& r, bool includeNamesAndHex) const;
-    EditMessage WriteItemListInternal(const ListRegion& r, const std::vector<ItemStack>& items, EditLog* log);
+    std::vector<ItemStack> ReadItemListInternal(const FieldDescriptor& list, bool includeNamesAndHex) const;
+    EditMessage WriteItemListInternal(const FieldDescriptor& list, const std::vector<ItemStack>& items);
 };
 
 } // namespace savegenie